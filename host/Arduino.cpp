@@ -0,0 +1,175 @@
+#include "Arduino.h"
+#include "freertos/task.h"
+#include <stdio.h>
+#include <ctype.h>
+
+HardwareSerial Serial;
+
+// Virtual time in microseconds since "boot"
+static uint64_t clockMicros = 0;
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ============================================================================
+// TIME
+// ============================================================================
+unsigned long millis() {
+    return (unsigned long)(clockMicros / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(clockMicros++);
+}
+
+void delay(unsigned long ms) {
+    clockMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    clockMicros += us;
+}
+
+void advanceHostClock(unsigned long us) {
+    clockMicros += us;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    clockMicros += (uint64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(clockMicros / (portTICK_PERIOD_MS * 1000));
+}
+
+// ============================================================================
+// STRING
+// ============================================================================
+static std::string formatInteger(unsigned long value, unsigned char base, bool negative) {
+    if (base < 2) base = 10;
+    std::string digits;
+    do {
+        int digit = value % base;
+        digits.insert(digits.begin(), (char)(digit < 10 ? '0' + digit : 'A' + digit - 10));
+        value /= base;
+    } while (value > 0);
+    if (negative) digits.insert(digits.begin(), '-');
+    return digits;
+}
+
+static std::string formatFloat(double value, unsigned int decimals) {
+    char text[64];
+    snprintf(text, sizeof(text), "%.*f", (int)decimals, value);
+    return text;
+}
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base)
+    : s(base == 10 && value < 0 ? formatInteger(-(unsigned long)value, base, true)
+                                : formatInteger((unsigned long)value, base, false)) {}
+
+String::String(unsigned long value, unsigned char base) : s(formatInteger(value, base, false)) {}
+
+String::String(double value, unsigned int decimals) : s(formatFloat(value, decimals)) {}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t at = s.find(c, from);
+    return at == std::string::npos ? -1 : (int)at;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    size_t at = s.find(text.s, from);
+    return at == std::string::npos ? -1 : (int)at;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t at = s.rfind(c);
+    return at == std::string::npos ? -1 : (int)at;
+}
+
+bool String::startsWith(const String& prefix) const {
+    return s.compare(0, prefix.s.size(), prefix.s) == 0 && s.size() >= prefix.s.size();
+}
+
+bool String::endsWith(const String& suffix) const {
+    return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+String String::substring(unsigned int from) const {
+    return substring(from, s.size());
+}
+
+// Like Arduino, the bounds are swapped if need be and clamped to the string
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    to = min(to, (unsigned int)s.size());
+    return String(s.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t first = 0;
+    while (first < s.size() && isspace((unsigned char)s[first])) first++;
+    size_t last = s.size();
+    while (last > first && isspace((unsigned char)s[last - 1])) last--;
+    s = s.substr(first, last - first);
+}
+
+void String::toUpperCase() {
+    for (char& c : s) c = (char)toupper((unsigned char)c);
+}
+
+void String::toLowerCase() {
+    for (char& c : s) c = (char)tolower((unsigned char)c);
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (s.size() != other.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// PRINT
+// ============================================================================
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    for (size_t i = 0; i < size; i++) {
+        n += write(buffer[i]);
+    }
+    return n;
+}
+
+size_t Print::print(long value, int base) {
+    return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(double value, int decimals) {
+    return print(String(value, (unsigned int)decimals));
+}
+
+void HardwareSerial::flush() {
+    fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (c != '\r') putchar(c);
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        write(buffer[i]);
+    }
+    return size;
+}
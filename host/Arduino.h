@@ -0,0 +1,156 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// The parts of the Arduino core the display code uses, for building it on a
+// host. Time is virtual: it stands still unless delay() moves it on, except
+// that every micros() call ticks it by 1 us so busy waits still end. Runs are
+// therefore repeatable to the pixel.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define IRAM_ATTR
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define DEC 10
+#define HEX 16
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+inline uint8_t pgm_read_byte(const void* p) { return *(const uint8_t*)p; }
+inline uint16_t pgm_read_word(const void* p) { return *(const uint16_t*)p; }
+inline uint32_t pgm_read_dword(const void* p) { return *(const uint32_t*)p; }
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L low, H high) {
+  return x < low ? low : (x > high ? high : x);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+// ============================================================================
+// TIME
+// ============================================================================
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Moves the virtual clock on without anything waiting
+void advanceHostClock(unsigned long us);
+
+// ============================================================================
+// STRING
+// ============================================================================
+class String {
+public:
+  String() {}
+  String(const char* text) : s(text ? text : "") {}
+  String(const std::string& text) : s(text) {}
+  explicit String(char c) : s(1, c) {}
+  explicit String(int value, unsigned char base = DEC);
+  explicit String(unsigned int value, unsigned char base = DEC);
+  explicit String(long value, unsigned char base = DEC);
+  explicit String(unsigned long value, unsigned char base = DEC);
+  explicit String(double value, unsigned int decimals = 2);
+
+  unsigned int length() const { return s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  const char* c_str() const { return s.c_str(); }
+  bool reserve(unsigned int size) { s.reserve(size); return true; }
+
+  char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char& operator[](unsigned int index) { return s[index]; }
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String& text, unsigned int from = 0) const;
+  int lastIndexOf(char c) const;
+  bool startsWith(const String& prefix) const;
+  bool endsWith(const String& suffix) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+
+  void trim();
+  void toUpperCase();
+  void toLowerCase();
+  long toInt() const { return atol(s.c_str()); }
+  bool equals(const String& other) const { return s == other.s; }
+  bool equalsIgnoreCase(const String& other) const;
+
+  String& operator+=(const String& other) { s += other.s; return *this; }
+  String& operator+=(const char* other) { s += other; return *this; }
+  String& operator+=(char c) { s += c; return *this; }
+  bool concat(const String& other) { s += other.s; return true; }
+
+  bool operator==(const String& other) const { return s == other.s; }
+  bool operator==(const char* other) const { return s == other; }
+  bool operator!=(const String& other) const { return s != other.s; }
+  bool operator!=(const char* other) const { return s != other; }
+  bool operator<(const String& other) const { return s < other.s; }
+
+private:
+  std::string s;
+};
+
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+
+// ============================================================================
+// PRINT
+// ============================================================================
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+
+  size_t print(const String& text) { return write((const uint8_t*)text.c_str(), text.length()); }
+  size_t print(const char* text) { return write(text); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC);
+  size_t print(unsigned long value, int base = DEC);
+  size_t print(long long value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned long long value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(double value, int decimals = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template <typename T>
+  size_t println(const T& value, int format) { size_t n = print(value, format); return n + println(); }
+};
+
+// Serial output goes to stdout
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) {}
+  void flush();
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+#endif // ARDUINO_H
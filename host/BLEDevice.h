@@ -0,0 +1,8 @@
+#ifndef BLE_DEVICE_H
+#define BLE_DEVICE_H
+
+// globals.h only needs the names. The BLE handler is not built on the host.
+class BLEServer;
+class BLECharacteristic;
+
+#endif // BLE_DEVICE_H
@@ -0,0 +1,25 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <Arduino.h>
+
+// Settings storage held in memory. It starts erased (0xFF) like new flash, so
+// every setting loads its default.
+const int HOST_EEPROM_BYTES = 512;
+
+class EEPROMClass {
+public:
+  EEPROMClass() { memset(bytes, 0xFF, sizeof(bytes)); }
+  bool begin(size_t size) { return size <= sizeof(bytes); }
+  uint8_t read(int address) const { return (address >= 0 && address < HOST_EEPROM_BYTES) ? bytes[address] : 0; }
+  void write(int address, uint8_t value) { if (address >= 0 && address < HOST_EEPROM_BYTES) bytes[address] = value; }
+  bool commit() { return true; }
+  void end() {}
+
+private:
+  uint8_t bytes[HOST_EEPROM_BYTES];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_H
@@ -0,0 +1,49 @@
+#ifndef FS_H
+#define FS_H
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <memory>
+
+namespace fs {
+
+// Read-only file on the host file system. Copies share the open file, as
+// they do on the device.
+class File {
+public:
+  File() {}
+  explicit File(FILE* file);
+
+  operator bool() const { return handle != nullptr; }
+  size_t read(uint8_t* buffer, size_t size);
+  int read();
+  bool seek(uint32_t position);
+  size_t position() const;
+  size_t size() const;
+  void close() { handle.reset(); }
+
+private:
+  std::shared_ptr<FILE> handle;
+};
+
+class FS {
+public:
+  // Files are looked up under root, which stands in for the mounted partition
+  explicit FS(const char* root) : root(root) {}
+  void setRoot(const char* path) { root = path; }
+
+  File open(const char* path, const char* mode = "r");
+  File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+
+protected:
+  std::string root;
+};
+
+} // namespace fs
+
+using fs::FS;
+using fs::File;
+
+#endif // FS_H
@@ -0,0 +1,21 @@
+#ifndef LITTLEFS_H
+#define LITTLEFS_H
+
+#include "FS.h"
+
+namespace fs {
+
+// The LittleFS image is built from the data folder, so that is where files are
+// read from unless setRoot() says otherwise
+class LittleFSFS : public FS {
+public:
+  LittleFSFS() : FS("data") {}
+  bool begin(bool formatOnFail = false) { return true; }
+  void end() {}
+};
+
+} // namespace fs
+
+extern fs::LittleFSFS LittleFS;
+
+#endif // LITTLEFS_H
@@ -0,0 +1,592 @@
+#include "TFT_eSPI.h"
+
+#ifdef LOAD_GLCD
+#include <Fonts/glcdfont.c>
+#endif
+
+// MADCTL TFT_eSPI programs for each rotation, as in display_dma.cpp
+static const uint8_t ROTATION_MADCTL[4] = {
+    TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MX | TFT_MAD_MV | TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MX | TFT_MAD_MY | TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MV | TFT_MAD_MY | TFT_MAD_COLOR_ORDER
+};
+
+#ifdef CGRAM_OFFSET
+// TFT_eSPI's ST7789 offsets for the 135x240 glass, which sits inside 240x320
+// of controller memory, by rotation
+static const int32_t OFFSETS_135X240[4][2] = { { 52, 40 }, { 40, 53 }, { 53, 40 }, { 40, 52 } };
+#endif
+
+static const uint16_t DEFAULT_4BIT_PALETTE[16] = {
+    TFT_BLACK, TFT_BROWN, TFT_RED, TFT_ORANGE, TFT_YELLOW, TFT_GREEN, TFT_BLUE, TFT_PURPLE,
+    TFT_DARKGREY, TFT_WHITE, TFT_CYAN, TFT_MAGENTA, TFT_MAROON, TFT_DARKGREEN, TFT_NAVY, TFT_PINK
+};
+
+// Every string drawn, and the problems found with them: the string, and for an
+// overlap the one it overlaps (-1 otherwise)
+struct TextProblem {
+    const char* what;
+    int run;
+    int other;
+};
+static std::vector<std::string> textRuns;
+static std::vector<TextProblem> textProblems;
+
+static inline uint16_t swapBytes(uint16_t color) {
+    return (uint16_t)((color << 8) | (color >> 8));
+}
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+    _init_width = _width = w;
+    _init_height = _height = h;
+    rotation = 0;
+    colstart = rowstart = 0;
+    madctl = ROTATION_MADCTL[0];
+    lastCommand = 0;
+
+    // Other sizes fill the controller memory exactly
+    memoryWidth = w;
+    memoryHeight = h;
+    glassColumn = glassRow = 0;
+#ifdef CGRAM_OFFSET
+    if (w == 135 && h == 240) {
+        memoryWidth = 240;
+        memoryHeight = 320;
+        glassColumn = OFFSETS_135X240[0][0];
+        glassRow = OFFSETS_135X240[0][1];
+    }
+#endif
+
+    cursor_x = cursor_y = 0;
+    textcolor = textbgcolor = TFT_WHITE;
+    textfont = 1;
+    textsize = 1;
+    textwrapX = true;
+    textwrapY = false;
+    _swapBytes = false;
+#ifdef LOAD_GFXFF
+    gfxFont = nullptr;
+#endif
+    textRun = -1;
+    drawingText = false;
+}
+
+void TFT_eSPI::init(uint8_t tc) {
+    panel.assign((size_t)_init_width * _init_height, TFT_BLACK);
+    setRotation(0);
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+    rotation = r & 3;
+    madctl = ROTATION_MADCTL[rotation];
+    colstart = rowstart = 0;
+#ifdef CGRAM_OFFSET
+    if (_init_width == 135 && _init_height == 240) {
+        colstart = OFFSETS_135X240[rotation][0];
+        rowstart = OFFSETS_135X240[rotation][1];
+    }
+#endif
+    _width = (rotation & 1) ? _init_height : _init_width;
+    _height = (rotation & 1) ? _init_width : _init_height;
+}
+
+void TFT_eSPI::writedata(uint8_t d) {
+    if (lastCommand == TFT_MADCTL) madctl = d;
+}
+
+// Where logical (x, y) lands in the native framebuffer, as the controller
+// works it out: TFT_eSPI adds its offsets to make the column and row
+// addresses, MV swaps them, and MX and MY then reverse the memory's columns
+// and rows. Returns false for pixels outside the glass.
+bool TFT_eSPI::panelIndex(int32_t x, int32_t y, size_t& index) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height || panel.empty()) return false;
+
+    int32_t columnAddress = x + colstart;
+    int32_t rowAddress = y + rowstart;
+    int32_t col = (madctl & TFT_MAD_MV) ? rowAddress : columnAddress;
+    int32_t row = (madctl & TFT_MAD_MV) ? columnAddress : rowAddress;
+    if (madctl & TFT_MAD_MX) col = memoryWidth - 1 - col;
+    if (madctl & TFT_MAD_MY) row = memoryHeight - 1 - row;
+
+    col -= glassColumn;
+    row -= glassRow;
+    if (col < 0 || row < 0 || col >= _init_width || row >= _init_height) return false;
+    index = (size_t)row * _init_width + col;
+    return true;
+}
+
+// ============================================================================
+// DRAWING
+// ============================================================================
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    size_t index;
+    if (panelIndex(x, y, index)) panel[index] = (uint16_t)color;
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (!drawingText) coverText(x, y, w, h);
+    int32_t x0 = max(x, (int32_t)0);
+    int32_t y0 = max(y, (int32_t)0);
+    int32_t x1 = min(x + w, (int32_t)width());
+    int32_t y1 = min(y + h, (int32_t)height());
+    for (int32_t j = y0; j < y1; j++) {
+        for (int32_t i = x0; i < x1; i++) {
+            drawPixel(i, j, color);
+        }
+    }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+    size_t index;
+    return panelIndex(x, y, index) ? panel[index] : 0;
+}
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+    fillRect(0, 0, width(), height(), color);
+}
+
+void TFT_eSPI::drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void TFT_eSPI::drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y + 1, h - 2, color);
+    drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+// Bresenham, split into runs the same way as TFT_eSPI
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+
+    int32_t dx = x1 - x0;
+    int32_t dy = abs(y1 - y0);
+    int32_t err = dx >> 1;
+    int32_t ystep = (y0 < y1) ? 1 : -1;
+    int32_t xs = x0;
+    int32_t dlen = 0;
+
+    for (; x0 <= x1; x0++) {
+        dlen++;
+        err -= dy;
+        if (err < 0) {
+            if (steep) drawFastVLine(y0, xs, dlen, color);
+            else drawFastHLine(xs, y0, dlen, color);
+            dlen = 0;
+            y0 += ystep;
+            xs = x0 + 1;
+            err += dx;
+        }
+    }
+    if (dlen) {
+        if (steep) drawFastVLine(y0, xs, dlen, color);
+        else drawFastHLine(xs, y0, dlen, color);
+    }
+}
+
+// ============================================================================
+// TEXT
+// ============================================================================
+void TFT_eSPI::setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+    textRun = -1;
+}
+
+void TFT_eSPI::setTextColor(uint16_t color) {
+    textcolor = textbgcolor = color;
+}
+
+void TFT_eSPI::setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill) {
+    textcolor = fgcolor;
+    textbgcolor = bgcolor;
+}
+
+void TFT_eSPI::setTextSize(uint8_t size) {
+    textsize = size > 0 ? size : 1;
+}
+
+void TFT_eSPI::setTextFont(uint8_t font) {
+    textfont = font > 0 ? font : 1;
+#ifdef LOAD_GFXFF
+    gfxFont = nullptr;
+#endif
+}
+
+#ifdef LOAD_GFXFF
+void TFT_eSPI::setFreeFont(const GFXfont* font) {
+    if (font == nullptr) {
+        setTextFont(1);
+        return;
+    }
+    textfont = 1;
+    gfxFont = font;
+}
+#endif
+
+void TFT_eSPI::setTextWrap(bool wrapX, bool wrapY) {
+    textwrapX = wrapX;
+    textwrapY = wrapY;
+}
+
+// The last character counts its ink rather than its advance, as in TFT_eSPI
+int16_t TFT_eSPI::textWidth(const char* text) {
+    int32_t width = 0;
+#ifdef LOAD_GFXFF
+    if (gfxFont) {
+        for (const char* p = text; *p; p++) {
+            uint8_t c = (uint8_t)*p;
+            if (c < gfxFont->first || c > gfxFont->last) continue;
+            const GFXglyph& glyph = gfxFont->glyph[c - gfxFont->first];
+            if (p[1]) width += glyph.xAdvance;
+            else width += glyph.xOffset + glyph.width;
+        }
+        return width * textsize;
+    }
+#endif
+    if (textfont == 1) width = 6 * strlen(text);
+    return width * textsize;
+}
+
+int16_t TFT_eSPI::fontHeight() {
+#ifdef LOAD_GFXFF
+    if (gfxFont) return gfxFont->yAdvance * textsize;
+#endif
+    return 8 * textsize;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+    if (c == '\r') return 1;
+    if (c != '\n') {
+        if (textRun < 0) {
+            textRuns.emplace_back();
+            textRun = (int)textRuns.size() - 1;
+        }
+        textRuns[textRun] += (char)c;
+    }
+
+#ifdef LOAD_GFXFF
+    if (gfxFont) {
+        if (c == '\n') {
+            cursor_x = 0;
+            cursor_y += textsize * gfxFont->yAdvance;
+            return 1;
+        }
+        if (c < gfxFont->first || c > gfxFont->last) return 1;
+
+        const GFXglyph& glyph = gfxFont->glyph[c - gfxFont->first];
+        if (glyph.width > 0 && glyph.height > 0) {
+            bool wrapped = false;
+            if (textwrapX && cursor_x + textsize * (glyph.xOffset + glyph.width) > width()) {
+                cursor_x = 0;
+                cursor_y += textsize * gfxFont->yAdvance;
+                wrapped = true;
+            }
+            if (textwrapY && cursor_y >= height()) cursor_y = 0;
+            int32_t x0 = cursor_x + glyph.xOffset * textsize;
+            int32_t y0 = cursor_y + glyph.yOffset * textsize;
+            checkGlyph(x0, y0, x0 + glyph.width * textsize, y0 + glyph.height * textsize, wrapped);
+            drawingText = true;
+            drawGfxChar(cursor_x, cursor_y, c, textcolor, textsize);
+            drawingText = false;
+        }
+        cursor_x += glyph.xAdvance * textsize;
+        return 1;
+    }
+#endif
+
+    // Only the built-in font 1 of the numbered fonts is drawn
+    if (textfont != 1) return 1;
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += 8 * textsize;
+        return 1;
+    }
+    bool wrapped = false;
+    if (textwrapX && cursor_x + 6 * textsize > width()) {
+        cursor_x = 0;
+        cursor_y += 8 * textsize;
+        wrapped = true;
+    }
+    if (textwrapY && cursor_y >= height()) cursor_y = 0;
+    checkGlyph(cursor_x, cursor_y, cursor_x + 5 * textsize, cursor_y + 8 * textsize, wrapped);
+    drawingText = true;
+    drawGlcdChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
+    drawingText = false;
+    cursor_x += 6 * textsize;
+    return 1;
+}
+
+// 5x8 columns, LSB at the top, plus a blank sixth column. The cell is filled
+// with the background unless it is the same as the foreground.
+void TFT_eSPI::drawGlcdChar(int32_t x, int32_t y, uint8_t c, uint32_t color, uint32_t bg, uint8_t size) {
+#ifdef LOAD_GLCD
+    if (x >= width() || y >= height() || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) return;
+    bool fillbg = bg != color;
+
+    for (int32_t i = 0; i < 6; i++) {
+        uint8_t line = (i < 5) ? pgm_read_byte(font + c * 5 + i) : 0;
+        for (int32_t j = 0; j < 8; j++, line >>= 1) {
+            if (line & 1) {
+                fillRect(x + i * size, y + j * size, size, size, color);
+            } else if (fillbg) {
+                fillRect(x + i * size, y + j * size, size, size, bg);
+            }
+        }
+    }
+#endif
+}
+
+#ifdef LOAD_GFXFF
+// Set pixels only, in horizontal runs. Bits run on from one row of the glyph
+// to the next without padding.
+void TFT_eSPI::drawGfxChar(int32_t x, int32_t y, uint8_t c, uint32_t color, uint8_t size) {
+    const GFXglyph& glyph = gfxFont->glyph[c - gfxFont->first];
+    const uint8_t* bitmap = gfxFont->bitmap + glyph.bitmapOffset;
+    int32_t w = glyph.width;
+    int32_t h = glyph.height;
+    int32_t xo = glyph.xOffset;
+    int32_t yo = glyph.yOffset;
+
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (int32_t yy = 0; yy < h; yy++) {
+        int32_t run = 0;
+        for (int32_t xx = 0; xx < w; xx++) {
+            if (bit == 0) {
+                bits = pgm_read_byte(bitmap++);
+                bit = 0x80;
+            }
+            if (bits & bit) {
+                run++;
+            } else if (run) {
+                fillRect(x + (xo + xx - run) * size, y + (yo + yy) * size, run * size, size, color);
+                run = 0;
+            }
+            bit >>= 1;
+        }
+        if (run) {
+            fillRect(x + (xo + w - run) * size, y + (yo + yy) * size, run * size, size, color);
+        }
+    }
+}
+#endif
+
+// ============================================================================
+// TEXT CHECKS
+// ============================================================================
+// A glyph is a problem if it wraps, leaves the surface or overlaps a glyph of
+// another string. The same glyph box drawn again replaces the old one.
+void TFT_eSPI::checkGlyph(int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool wrapped) {
+    if (wrapped) textProblems.push_back({ "wraps at the right edge", textRun, -1 });
+    if (x0 < 0 || y0 < 0 || x1 > width() || y1 > height()) {
+        textProblems.push_back({ "runs off the edge", textRun, -1 });
+    }
+    for (size_t i = 0; i < glyphBoxes.size();) {
+        const GlyphBox& box = glyphBoxes[i];
+        if (box.x0 == x0 && box.y0 == y0 && box.x1 == x1 && box.y1 == y1) {
+            glyphBoxes.erase(glyphBoxes.begin() + i);
+            continue;
+        }
+        if (box.run != textRun && box.x0 < x1 && x0 < box.x1 && box.y0 < y1 && y0 < box.y1) {
+            textProblems.push_back({ "overlaps", textRun, box.run });
+        }
+        i++;
+    }
+    glyphBoxes.push_back({ x0, y0, x1, y1, textRun });
+}
+
+void TFT_eSPI::coverText(int32_t x, int32_t y, int32_t w, int32_t h) {
+    for (size_t i = 0; i < glyphBoxes.size();) {
+        const GlyphBox& box = glyphBoxes[i];
+        if (box.x0 >= x && box.y0 >= y && box.x1 <= x + w && box.y1 <= y + h) {
+            glyphBoxes.erase(glyphBoxes.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+std::vector<std::string> takeTextProblems() {
+    std::vector<std::string> lines;
+    for (const TextProblem& problem : textProblems) {
+        std::string line = "\"" + textRuns[problem.run] + "\" " + problem.what;
+        if (problem.other >= 0) line += " \"" + textRuns[problem.other] + "\"";
+        if (std::find(lines.begin(), lines.end(), line) == lines.end()) lines.push_back(line);
+    }
+    textProblems.clear();
+    return lines;
+}
+
+// ============================================================================
+// PIXEL PUSHES
+// ============================================================================
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+    coverText(x, y, w, h);
+    for (int32_t j = 0; j < h; j++) {
+        for (int32_t i = 0; i < w; i++) {
+            uint16_t color = data[j * w + i];
+            drawPixel(x + i, y + j, _swapBytes ? color : swapBytes(color));
+        }
+    }
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+    pushImage(x, y, w, h, data);
+}
+
+// ============================================================================
+// SPRITES
+// ============================================================================
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI() {
+    _tft = tft;
+    buffer = nullptr;
+    spriteWidth = spriteHeight = 0;
+    stride = 0;
+    bpp = 16;
+    memcpy(palette, DEFAULT_4BIT_PALETTE, sizeof(palette));
+    bitmapForeground = TFT_WHITE;
+    bitmapBackground = TFT_BLACK;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+    if (buffer) return buffer;
+    if (w < 1 || h < 1) return nullptr;
+
+    switch (bpp) {
+        case 1: stride = (w + 7) / 8; break;
+        case 4: stride = (w + 1) / 2; break;
+        case 8: stride = w; break;
+        default: stride = w * 2; break;
+    }
+    buffer = (uint8_t*)calloc((size_t)stride * h, 1);
+    if (!buffer) return nullptr;
+    glyphBoxes.clear();
+
+    spriteWidth = w;
+    spriteHeight = h;
+    _width = w;
+    _height = h;
+    if (bpp == 4) memcpy(palette, DEFAULT_4BIT_PALETTE, sizeof(palette));
+    return buffer;
+}
+
+void TFT_eSprite::deleteSprite() {
+    free(buffer);
+    buffer = nullptr;
+}
+
+void* TFT_eSprite::setColorDepth(int8_t depth) {
+    if (depth != 1 && depth != 4 && depth != 8) depth = 16;
+    if (buffer && depth != bpp) {
+        int32_t w = spriteWidth;
+        int32_t h = spriteHeight;
+        deleteSprite();
+        bpp = depth;
+        return createSprite(w, h);
+    }
+    bpp = depth;
+    return buffer;
+}
+
+void TFT_eSprite::createPalette(const uint16_t* colors, uint8_t count) {
+    if (!buffer) return;
+    if (colors == nullptr) {
+        memcpy(palette, DEFAULT_4BIT_PALETTE, sizeof(palette));
+        return;
+    }
+    for (int i = 0; i < min((int)count, 16); i++) {
+        palette[i] = colors[i];
+    }
+}
+
+void TFT_eSprite::setPaletteColor(uint8_t index, uint16_t color) {
+    palette[index & 0x0F] = color;
+}
+
+void TFT_eSprite::setBitmapColor(uint16_t fg, uint16_t bg) {
+    bitmapForeground = fg;
+    bitmapBackground = bg;
+}
+
+void TFT_eSprite::drawPixel(int32_t x, int32_t y, uint32_t color) {
+    if (!buffer || x < 0 || y < 0 || x >= spriteWidth || y >= spriteHeight) return;
+    uint8_t* row = buffer + y * stride;
+
+    switch (bpp) {
+        case 1:
+            if (color) row[x >> 3] |= 0x80 >> (x & 7);
+            else row[x >> 3] &= ~(0x80 >> (x & 7));
+            break;
+        case 4: {
+            uint8_t index = color & 0x0F;
+            uint8_t& pair = row[x >> 1];
+            pair = (x & 1) ? (uint8_t)((pair & 0xF0) | index) : (uint8_t)((pair & 0x0F) | (index << 4));
+            break;
+        }
+        case 8:
+            row[x] = (uint8_t)(((color & 0xE000) >> 8) | ((color & 0x0700) >> 6) | ((color & 0x0018) >> 3));
+            break;
+        default:
+            ((uint16_t*)row)[x] = swapBytes((uint16_t)color);
+            break;
+    }
+}
+
+void TFT_eSprite::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+    if (!drawingText) coverText(x, y, w, h);
+    int32_t x0 = max(x, (int32_t)0);
+    int32_t y0 = max(y, (int32_t)0);
+    int32_t x1 = min(x + w, spriteWidth);
+    int32_t y1 = min(y + h, spriteHeight);
+    for (int32_t j = y0; j < y1; j++) {
+        for (int32_t i = x0; i < x1; i++) {
+            drawPixel(i, j, color);
+        }
+    }
+}
+
+// RGB565, whatever the depth
+uint16_t TFT_eSprite::readPixel(int32_t x, int32_t y) {
+    if (!buffer || x < 0 || y < 0 || x >= spriteWidth || y >= spriteHeight) return 0;
+    const uint8_t* row = buffer + y * stride;
+
+    switch (bpp) {
+        case 1:
+            return (row[x >> 3] & (0x80 >> (x & 7))) ? bitmapForeground : bitmapBackground;
+        case 4:
+            return palette[(x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4)];
+        case 8: {
+            uint8_t c = row[x];
+            uint16_t red = (c & 0xE0) >> 5;
+            uint16_t green = (c & 0x1C) >> 2;
+            uint16_t blue = c & 0x03;
+            return (uint16_t)((red << 13) | (red << 10) | (green << 8) | (green << 5) | (blue << 3) | (blue << 1) | (blue >> 1));
+        }
+        default:
+            return swapBytes(((const uint16_t*)row)[x]);
+    }
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+    _tft->coverText(x, y, spriteWidth, spriteHeight);
+    for (int32_t j = 0; j < spriteHeight; j++) {
+        for (int32_t i = 0; i < spriteWidth; i++) {
+            _tft->drawPixel(x + i, y + j, readPixel(i, j));
+        }
+    }
+}
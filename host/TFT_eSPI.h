@@ -0,0 +1,214 @@
+#ifndef TFT_ESPI_H
+#define TFT_ESPI_H
+
+// Stand-in for TFT_eSPI on a host: the panel is an RGB565 framebuffer in the
+// controller's native (portrait) orientation. Each pixel is addressed as the
+// ST7789 would: x and y plus TFT_eSPI's offsets for the rotation give the
+// column and row address, and MADCTL's MV, MX and MY bits map those onto the
+// controller's memory, of which the glass shows a window. So pixels land where
+// they would on the device, mirrored or not. Drawing follows TFT_eSPI closely enough that text,
+// lines and sprites come out pixel for pixel the same. Only the parts of the
+// API this project uses are here. Fonts are TFT_eSPI's own, from its library
+// folder, or the DejaVu stand-ins in host/fonts for the golden render test.
+//
+// Text is also checked as it is drawn. Every glyph's box is kept until
+// something is drawn over it, and a string that overlaps another one, wraps or
+// runs off the edge of the screen or sprite it is drawn on is reported by
+// takeTextProblems().
+
+#include <Arduino.h>
+#include <vector>
+#include <string>
+
+#ifdef LOAD_GFXFF
+#include <Fonts/GFXFF/gfxfont.h>
+// The FONT_SANS_* fonts in globals.h
+#include <Fonts/GFXFF/FreeSans9pt7b.h>
+#include <Fonts/GFXFF/FreeSans12pt7b.h>
+#include <Fonts/GFXFF/FreeSans18pt7b.h>
+#include <Fonts/GFXFF/FreeSans24pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold9pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold12pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold18pt7b.h>
+#include <Fonts/GFXFF/FreeSansBold24pt7b.h>
+#endif
+
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+#define TFT_BROWN       0x9A60
+#define TFT_GOLD        0xFEA0
+#define TFT_SILVER      0xC618
+#define TFT_SKYBLUE     0x867D
+#define TFT_VIOLET      0x915C
+
+// ST7789 memory access control
+#define TFT_MADCTL  0x36
+#define TFT_MAD_MY  0x80
+#define TFT_MAD_MX  0x40
+#define TFT_MAD_MV  0x20
+#define TFT_MAD_ML  0x10
+#define TFT_MAD_RGB 0x00
+#define TFT_MAD_BGR 0x08
+#define TFT_MAD_COLOR_ORDER TFT_MAD_RGB
+
+class TFT_eSPI : public Print {
+public:
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI() {}
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() { return rotation; }
+  virtual int16_t width() { return _width; }
+  virtual int16_t height() { return _height; }
+
+  // Drawing. Sprites override the pixel level calls.
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t color);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+  void fillScreen(uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color);
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t color);
+
+  // Text in the built-in font 1 or a GFX free font. GFX fonts draw only their
+  // set pixels; font 1 fills its cell when the background differs.
+  void setCursor(int16_t x, int16_t y);
+  int16_t getCursorX() { return cursor_x; }
+  int16_t getCursorY() { return cursor_y; }
+  void setTextColor(uint16_t color);
+  void setTextColor(uint16_t fgcolor, uint16_t bgcolor, bool bgfill = false);
+  void setTextSize(uint8_t size);
+  void setTextFont(uint8_t font);
+#ifdef LOAD_GFXFF
+  void setFreeFont(const GFXfont* font = nullptr);
+#endif
+  void setTextWrap(bool wrapX, bool wrapY = false);
+  int16_t textWidth(const char* text);
+  int16_t textWidth(const String& text) { return textWidth(text.c_str()); }
+  int16_t fontHeight();
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  // Pixels are taken in the byte order the panel wants (swapped) unless
+  // setSwapBytes(true). DMA pushes complete before they return.
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() { return _swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+  bool initDMA(bool ctrl_cs = false) { return true; }
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+  void startWrite() {}
+  void endWrite() {}
+
+  // Controller commands. Only MADCTL has an effect.
+  void writecommand(uint8_t c) { lastCommand = c; }
+  void writedata(uint8_t d);
+
+  // Host only: drops the glyph boxes a rectangle about to be drawn over holds
+  // in full
+  void coverText(int32_t x, int32_t y, int32_t w, int32_t h);
+
+protected:
+  void drawGlcdChar(int32_t x, int32_t y, uint8_t c, uint32_t color, uint32_t bg, uint8_t size);
+#ifdef LOAD_GFXFF
+  void drawGfxChar(int32_t x, int32_t y, uint8_t c, uint32_t color, uint8_t size);
+  const GFXfont* gfxFont;
+#endif
+
+  int32_t _init_width, _init_height; // native panel size
+  int32_t _width, _height;           // in the current rotation
+  uint8_t rotation;
+  int32_t colstart, rowstart;        // address offsets for the rotation
+
+  int32_t cursor_x, cursor_y;
+  uint32_t textcolor, textbgcolor;
+  uint8_t textfont, textsize;
+  bool textwrapX, textwrapY;
+  bool _swapBytes;
+
+  // Text checking: the glyphs on this surface, each with the string it is
+  // part of (an index into a list shared by every surface)
+  struct GlyphBox {
+    int32_t x0, y0, x1, y1;
+    int run;
+  };
+  std::vector<GlyphBox> glyphBoxes;
+  int textRun;      // string being drawn, -1 until the next one starts
+  bool drawingText; // glyph pixels are not drawing over text
+  void checkGlyph(int32_t x0, int32_t y0, int32_t x1, int32_t y1, bool wrapped);
+
+private:
+  bool panelIndex(int32_t x, int32_t y, size_t& index);
+
+  uint8_t madctl;
+  uint8_t lastCommand;
+  int32_t memoryWidth, memoryHeight; // controller memory, native orientation
+  int32_t glassColumn, glassRow;     // where the glass's top left sits in it
+  std::vector<uint16_t> panel;
+};
+
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() { deleteSprite(); }
+
+  // 1bpp rows are MSB first and 4bpp rows high nibble first, each row padded
+  // to a whole byte. 16bpp pixels are stored byte-swapped. Memory is zeroed.
+  void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() { return buffer != nullptr; }
+  void* getPointer() { return buffer; }
+  void* setColorDepth(int8_t depth);
+  int8_t getColorDepth() { return bpp; }
+
+  // 4bpp sprites draw with palette indices as colours
+  void createPalette(const uint16_t* colors = nullptr, uint8_t count = 16);
+  void setPaletteColor(uint8_t index, uint16_t color);
+  uint16_t getPaletteColor(uint8_t index) { return palette[index & 0x0F]; }
+  void setBitmapColor(uint16_t fg, uint16_t bg);
+
+  void fillSprite(uint32_t color) { fillRect(0, 0, spriteWidth, spriteHeight, color); }
+  void pushSprite(int32_t x, int32_t y);
+
+  int16_t width() override { return spriteWidth; }
+  int16_t height() override { return spriteHeight; }
+  void drawPixel(int32_t x, int32_t y, uint32_t color) override;
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) override;
+  uint16_t readPixel(int32_t x, int32_t y) override;
+
+private:
+  TFT_eSPI* _tft;
+  uint8_t* buffer;
+  int32_t spriteWidth, spriteHeight;
+  int32_t stride; // bytes per row
+  int8_t bpp;
+  uint16_t palette[16];
+  uint16_t bitmapForeground, bitmapBackground;
+};
+
+// Problems found with the text drawn since the last call, one line each
+std::vector<std::string> takeTextProblems();
+
+#endif // TFT_ESPI_H
@@ -0,0 +1,47 @@
+#ifndef DRIVER_LEDC_H
+#define DRIVER_LEDC_H
+
+#include <stdint.h>
+
+// LEDC calls accepted and ignored: the host has no backlight
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef enum { LEDC_LOW_SPEED_MODE } ledc_mode_t;
+typedef enum { LEDC_TIMER_0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3 } ledc_timer_t;
+typedef enum { LEDC_CHANNEL_0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3 } ledc_channel_t;
+typedef enum { LEDC_TIMER_8_BIT = 8, LEDC_TIMER_10_BIT = 10, LEDC_TIMER_12_BIT = 12 } ledc_timer_bit_t;
+typedef enum { LEDC_AUTO_CLK } ledc_clk_cfg_t;
+typedef enum { LEDC_INTR_DISABLE } ledc_intr_type_t;
+typedef enum { LEDC_FADE_NO_WAIT, LEDC_FADE_WAIT_DONE } ledc_fade_mode_t;
+
+typedef struct {
+  ledc_mode_t speed_mode;
+  ledc_timer_bit_t duty_resolution;
+  ledc_timer_t timer_num;
+  uint32_t freq_hz;
+  ledc_clk_cfg_t clk_cfg;
+} ledc_timer_config_t;
+
+typedef struct {
+  int gpio_num;
+  ledc_mode_t speed_mode;
+  ledc_channel_t channel;
+  ledc_intr_type_t intr_type;
+  ledc_timer_t timer_sel;
+  uint32_t duty;
+  int hpoint;
+} ledc_channel_config_t;
+
+inline esp_err_t ledc_timer_config(const ledc_timer_config_t* config) { return ESP_OK; }
+inline esp_err_t ledc_channel_config(const ledc_channel_config_t* config) { return ESP_OK; }
+inline esp_err_t ledc_fade_func_install(int flags) { return ESP_OK; }
+inline esp_err_t ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty) { return ESP_OK; }
+inline esp_err_t ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel) { return ESP_OK; }
+inline esp_err_t ledc_set_fade_with_time(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty, int ms) { return ESP_OK; }
+inline esp_err_t ledc_fade_start(ledc_mode_t mode, ledc_channel_t channel, ledc_fade_mode_t wait) { return ESP_OK; }
+inline esp_err_t ledc_fade_stop(ledc_mode_t mode, ledc_channel_t channel) { return ESP_OK; }
+inline esp_err_t ledc_stop(ledc_mode_t mode, ledc_channel_t channel, uint32_t idle) { return ESP_OK; }
+
+#endif // DRIVER_LEDC_H
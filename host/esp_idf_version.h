@@ -0,0 +1,9 @@
+#ifndef ESP_IDF_VERSION_H
+#define ESP_IDF_VERSION_H
+
+// The IDF release the device build uses, so host builds take the same paths
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(4, 4, 0)
+
+#endif // ESP_IDF_VERSION_H
@@ -0,0 +1,240 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSans12pt7bBitmaps[] PROGMEM = {
+  0xBF, 0xFF, 0xE0, 0xF0, // '!'
+  0x8C, 0xE7, 0x39, 0x80, // '"'
+  0x02, 0x20, 0x11, 0x01, 0x98, 0x08, 0xC3, 0xFF, 0x9F, 0xFC, 0x33, 0x01, 0x18, 0x08, 0xC7, 0xFF,
+  0x86, 0x60, 0x23, 0x01, 0x10, 0x08, 0x80, // '#'
+  0x10, 0x10, 0x7E, 0xD3, 0x90, 0x90, 0xD0, 0x7C, 0x1F, 0x13, 0x11, 0x13, 0xDF, 0xFC, 0x10, 0x10, // '$'
+  0x38, 0x18, 0x4C, 0x10, 0xC4, 0x20, 0xC4, 0x60, 0xC4, 0x40, 0xC4, 0xC0, 0x78, 0x80, 0x01, 0x1E,
+  0x03, 0x32, 0x02, 0x23, 0x06, 0x23, 0x04, 0x23, 0x08, 0x32, 0x18, 0x1E, // '%'
+  0x1F, 0x01, 0xFC, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x1C, 0x00, 0xF0, 0x0D, 0xC2, 0xC7, 0x36, 0x1D,
+  0xB0, 0x78, 0xC1, 0xC7, 0x1F, 0x1F, 0x9C, // '&'
+  0xF8, // '''
+  0x2D, 0x6D, 0xA4, 0x93, 0x6C, 0x99, // '('
+  0x8C, 0x46, 0x62, 0x33, 0x33, 0x22, 0x66, 0x4C, // ')'
+  0x10, 0x10, 0xD3, 0x7C, 0x38, 0x7E, 0x93, 0x10, 0x10, // '*'
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, // '+'
+  0xFA, // ','
+  0xFF, 0xC0, // '-'
+  0xF0, // '.'
+  0x04, 0x30, 0xC2, 0x18, 0x61, 0x04, 0x30, 0x82, 0x18, 0x61, 0x0C, 0x30, // '/'
+  0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x34, 0x19, 0x86, 0x33,
+  0x0F, 0x80, // '0'
+  0x38, 0xF8, 0x98, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7F, 0xFF, // '1'
+  0x3E, 0x7F, 0x80, 0x60, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0x0F, 0xFF, 0xFC, // '2'
+  0x7E, 0x3F, 0x80, 0x60, 0x30, 0x18, 0x18, 0x78, 0x0E, 0x01, 0x80, 0x40, 0x20, 0x3C, 0x3B, 0xF8, // '3'
+  0x03, 0x01, 0xC0, 0xF0, 0x2C, 0x13, 0x0C, 0xC2, 0x31, 0x8C, 0xC3, 0x3F, 0xFF, 0xFC, 0x0C, 0x03,
+  0x00, 0xC0, // '4'
+  0x7F, 0x3F, 0x98, 0x0C, 0x06, 0x03, 0xF1, 0xFC, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x3C, 0x73, 0xF0, // '5'
+  0x0F, 0x0F, 0xE3, 0x01, 0x80, 0x40, 0x37, 0xCF, 0xBB, 0x86, 0xE0, 0xF8, 0x36, 0x0D, 0x86, 0x33,
+  0x87, 0xC0, // '6'
+  0xFF, 0xFF, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x08, 0x18, 0x18, 0x30, 0x30, 0x30, // '7'
+  0x1E, 0x1F, 0xE6, 0x19, 0x06, 0x61, 0x98, 0x63, 0xF1, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x06, 0x73,
+  0x8F, 0xC0, // '8'
+  0x1E, 0x1F, 0xC6, 0x1B, 0x06, 0xC1, 0xB0, 0x7C, 0x1D, 0x8F, 0x3E, 0xC0, 0x20, 0x18, 0x06, 0x47,
+  0x1F, 0x80, // '9'
+  0xF4, 0x00, 0xF0, // ':'
+  0xF4, 0x00, 0xFA, // ';'
+  0x00, 0x10, 0x0F, 0x07, 0xC3, 0xE0, 0xF0, 0x0E, 0x00, 0x3C, 0x00, 0xF8, 0x01, 0xF0, 0x03, // '<'
+  0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, // '='
+  0x80, 0x0F, 0x00, 0x3E, 0x00, 0x78, 0x00, 0xF0, 0x0F, 0x03, 0xC1, 0xE0, 0xF8, 0x0C, 0x00, // '>'
+  0x3C, 0xFE, 0x03, 0x03, 0x06, 0x0E, 0x0C, 0x18, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, // '?'
+  0x07, 0xF0, 0x1C, 0x1C, 0x30, 0x06, 0x20, 0x03, 0x43, 0xD1, 0x46, 0x71, 0xC4, 0x31, 0xC4, 0x11,
+  0xC4, 0x11, 0xC4, 0x13, 0x46, 0x36, 0x43, 0xDC, 0x20, 0x00, 0x30, 0x00, 0x1C, 0x18, 0x07, 0xF0, // '@'
+  0x06, 0x00, 0x38, 0x01, 0xC0, 0x1B, 0x00, 0xD8, 0x0C, 0x40, 0x63, 0x02, 0x18, 0x30, 0x61, 0xFF,
+  0x1F, 0xF8, 0xC0, 0x66, 0x03, 0x60, 0x0C, // 'A'
+  0xFC, 0x3F, 0xCC, 0x1B, 0x06, 0xC1, 0xB0, 0xEF, 0xE3, 0x1C, 0xC1, 0xB0, 0x3C, 0x0F, 0x06, 0xFF,
+  0xBF, 0x80, // 'B'
+  0x0F, 0x87, 0xFD, 0xC0, 0xB0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30,
+  0x03, 0x86, 0x3F, 0x80, // 'C'
+  0xFC, 0x1F, 0xF3, 0x07, 0x60, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0,
+  0x6F, 0xF9, 0xFC, 0x00, // 'D'
+  0xFF, 0x7F, 0xB0, 0x18, 0x0C, 0x06, 0x03, 0xFD, 0xFE, 0xC0, 0x60, 0x30, 0x18, 0x0F, 0xF7, 0xFC, // 'E'
+  0xFE, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, // 'F'
+  0x0F, 0xC3, 0xFF, 0x70, 0x36, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x1F, 0xC0, 0x3C, 0x03, 0x60,
+  0x36, 0x03, 0x38, 0x71, 0xFE, // 'G'
+  0x80, 0x70, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x30, // 'H'
+  0xBF, 0xFF, 0xFF, 0xF0, // 'I'
+  0x10, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x66, 0xF6, 0x00, // 'J'
+  0x80, 0xF0, 0x6C, 0x33, 0x38, 0xDC, 0x3E, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0x0C, 0x63, 0x0C, 0xC1,
+  0xB0, 0x30, // 'K'
+  0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, // 'L'
+  0xE0, 0x3E, 0x07, 0xE0, 0x7F, 0x0D, 0xD0, 0xDD, 0x89, 0xD9, 0x9C, 0x91, 0xCD, 0x1C, 0xF1, 0xC6,
+  0x1C, 0x01, 0xC0, 0x1C, 0x01, // 'M'
+  0xC0, 0x78, 0x3F, 0x0F, 0xC3, 0xD8, 0xF6, 0x3C, 0xCF, 0x33, 0xC6, 0xF1, 0xBC, 0x3F, 0x0F, 0xC1,
+  0xF0, 0x70, // 'N'
+  0x0F, 0x81, 0xFF, 0x1C, 0x18, 0xC0, 0x6C, 0x03, 0x60, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x01,
+  0x98, 0x0C, 0xC0, 0xE3, 0x8E, 0x0F, 0xE0, // 'O'
+  0xFC, 0x7F, 0xB0, 0xD8, 0x3C, 0x1E, 0x0F, 0x0D, 0xFC, 0xF0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x00, // 'P'
+  0x0F, 0x81, 0xFF, 0x1C, 0x18, 0xC0, 0x6C, 0x03, 0x60, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x01,
+  0x98, 0x0C, 0xC0, 0xE3, 0x8E, 0x0F, 0xE0, 0x07, 0x00, 0x1C, // 'Q'
+  0xFC, 0x3F, 0xCC, 0x33, 0x06, 0xC1, 0xB0, 0xEC, 0x73, 0xF8, 0xC7, 0x30, 0xCC, 0x1B, 0x06, 0xC0,
+  0xF0, 0x30, // 'R'
+  0x1F, 0x1F, 0xE6, 0x03, 0x00, 0xC0, 0x18, 0x07, 0xE0, 0x7E, 0x01, 0xC0, 0x30, 0x0C, 0x03, 0xE3,
+  0x9F, 0xC0, // 'S'
+  0xFF, 0xFF, 0xFC, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x00, // 'T'
+  0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xF0, 0x3C, 0x0F, 0x03, 0x63,
+  0x8F, 0xC0, // 'U'
+  0x80, 0x38, 0x0F, 0x01, 0xE0, 0x26, 0x0C, 0xC1, 0x88, 0x61, 0x8C, 0x31, 0x83, 0x60, 0x6C, 0x0F,
+  0x00, 0xE0, 0x1C, 0x00, // 'V'
+  0x81, 0x81, 0xE0, 0xE0, 0xF0, 0x70, 0x58, 0x68, 0x66, 0x34, 0x33, 0x13, 0x19, 0x89, 0x88, 0xCC,
+  0x4C, 0x36, 0x26, 0x1A, 0x1B, 0x0D, 0x0D, 0x07, 0x83, 0x81, 0xC1, 0xC0, 0xE0, 0xE0, // 'W'
+  0x40, 0x6C, 0x18, 0xC3, 0x18, 0xC1, 0xB0, 0x1E, 0x03, 0x80, 0x70, 0x1F, 0x03, 0x60, 0xC6, 0x30,
+  0x66, 0x0D, 0x80, 0xC0, // 'X'
+  0xC0, 0x2C, 0x0D, 0x83, 0x18, 0xC1, 0x98, 0x3E, 0x03, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03,
+  0x00, 0x60, 0x0C, 0x00, // 'Y'
+  0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x38, 0x06, 0x01, 0x80, 0x60, 0x18, 0x07, 0x00, 0xC0, 0x30,
+  0x0F, 0xFF, 0xFF, 0xC0, // 'Z'
+  0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8E, 0xE0, // '['
+  0x83, 0x04, 0x18, 0x60, 0x82, 0x0C, 0x10, 0x41, 0x86, 0x08, 0x30, 0xC1, // '\'
+  0xF3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0xE0, // ']'
+  0x0C, 0x07, 0x83, 0x31, 0x86, 0xC0, 0xC0, // '^'
+  0xFF, 0xC0, // '_'
+  0xCC, 0x80, // '`'
+  0x08, 0x3F, 0x80, 0xC0, 0x30, 0x7B, 0xFF, 0x07, 0x83, 0xC1, 0xF3, 0xDF, 0x60, // 'a'
+  0x80, 0x40, 0x20, 0x11, 0x0F, 0xE7, 0x1B, 0x07, 0x83, 0x81, 0xC0, 0xF0, 0x78, 0x2E, 0x35, 0xF0, // 'b'
+  0x04, 0x3F, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x71, 0x3F, // 'c'
+  0x00, 0x80, 0x40, 0x21, 0x13, 0xFB, 0x1F, 0x07, 0x83, 0xC0, 0xE0, 0x70, 0x78, 0x36, 0x39, 0xF4, // 'd'
+  0x3F, 0x18, 0x6C, 0x0B, 0x03, 0xFF, 0xF0, 0x0C, 0x01, 0x80, 0x70, 0x8F, 0xE0, // 'e'
+  0x1E, 0x60, 0xC1, 0x8F, 0xE6, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x00, // 'f'
+  0x08, 0x1F, 0xD8, 0xF8, 0x3C, 0x1E, 0x07, 0x07, 0x83, 0x61, 0xBB, 0xCF, 0x20, 0x30, 0x1B, 0xF8,
+  0xF8, // 'g'
+  0x80, 0x80, 0x80, 0x88, 0xBE, 0xE3, 0xC3, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, // 'h'
+  0xCF, 0xFC, // 'i'
+  0x24, 0x02, 0x49, 0x24, 0x92, 0x49, 0xF8, // 'j'
+  0x80, 0x80, 0x80, 0x80, 0x83, 0x8E, 0x98, 0xB0, 0xE0, 0xF0, 0x98, 0x8C, 0x86, 0x83, // 'k'
+  0xFF, 0xFC, // 'l'
+  0x08, 0x11, 0x7C, 0xFB, 0x8E, 0x36, 0x18, 0x38, 0x30, 0x70, 0x60, 0xE0, 0xC1, 0xC1, 0x83, 0x83,
+  0x07, 0x06, 0x0E, 0x0C, 0x18, // 'm'
+  0x08, 0xBE, 0xE3, 0xC3, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, // 'n'
+  0x08, 0x1F, 0x98, 0xF8, 0x3C, 0x0E, 0x07, 0x03, 0x83, 0x41, 0xB1, 0x8F, 0x80, // 'o'
+  0x08, 0x7F, 0x38, 0xD8, 0x3C, 0x1C, 0x0E, 0x07, 0x83, 0xC1, 0x71, 0xAF, 0x90, 0x08, 0x04, 0x02,
+  0x00, // 'p'
+  0x08, 0x1F, 0xD8, 0xF8, 0x3C, 0x1E, 0x07, 0x03, 0x83, 0xC1, 0xB1, 0xCF, 0xA0, 0x10, 0x08, 0x04,
+  0x02, // 'q'
+  0xFF, 0x8C, 0x30, 0x82, 0x08, 0x20, 0x82, 0x00, // 'r'
+  0x08, 0x7E, 0xC0, 0xC0, 0xC0, 0x7C, 0x0E, 0x03, 0x03, 0xC7, 0xFE, // 's'
+  0x41, 0x06, 0x3F, 0x41, 0x04, 0x10, 0x41, 0x06, 0x18, 0x3C, // 't'
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0xC3, 0xC7, 0x7D, // 'u'
+  0xC1, 0xE0, 0xD0, 0x6C, 0x66, 0x31, 0x90, 0xD8, 0x6C, 0x1C, 0x0E, 0x00, // 'v'
+  0xC7, 0x0E, 0x38, 0xD1, 0xC6, 0x8B, 0x36, 0xD9, 0x36, 0x58, 0xA2, 0xC7, 0x1E, 0x38, 0x61, 0xC3,
+  0x00, // 'w'
+  0xC1, 0xB1, 0x8D, 0x83, 0xC1, 0xC0, 0xE0, 0xD8, 0xC6, 0x63, 0x60, 0xC0, // 'x'
+  0xC1, 0xE0, 0xD0, 0x4C, 0x62, 0x31, 0xB0, 0xD8, 0x38, 0x1C, 0x06, 0x06, 0x03, 0x07, 0x03, 0x00, // 'y'
+  0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x70, 0x60, 0xC0, 0xFF, // 'z'
+  0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0xF0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C,
+  0x0F, // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '|'
+  0xF0, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30,
+  0xF0, // '}'
+  0x7C, 0x3C, 0x7E, // '~'
+};
+
+const GFXglyph FreeSans12pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    0 }, // ' '
+  {     0,   2,  14,   8,    3,  -14 }, // '!'
+  {     4,   5,   5,   9,    2,  -14 }, // '"'
+  {     8,  13,  14,  16,    1,  -14 }, // '#'
+  {    31,   8,  16,  12,    2,  -14 }, // '$'
+  {    47,  16,  14,  18,    1,  -14 }, // '%'
+  {    75,  13,  14,  15,    1,  -14 }, // '&'
+  {    98,   1,   5,   5,    2,  -14 }, // '''
+  {    99,   3,  16,   7,    2,  -14 }, // '('
+  {   105,   4,  16,   7,    2,  -14 }, // ')'
+  {   113,   8,   9,   9,    1,  -14 }, // '*'
+  {   122,  12,  12,  16,    2,  -12 }, // '+'
+  {   140,   2,   4,   6,    2,   -2 }, // ','
+  {   141,   5,   2,   7,    1,   -6 }, // '-'
+  {   143,   2,   2,   6,    2,   -2 }, // '.'
+  {   144,   6,  16,   6,    0,  -14 }, // '/'
+  {   156,  10,  14,  12,    1,  -14 }, // '0'
+  {   174,   8,  14,  12,    2,  -14 }, // '1'
+  {   188,   9,  14,  12,    1,  -14 }, // '2'
+  {   204,   9,  14,  12,    1,  -14 }, // '3'
+  {   220,  10,  14,  12,    1,  -14 }, // '4'
+  {   238,   9,  14,  12,    1,  -14 }, // '5'
+  {   254,  10,  14,  12,    1,  -14 }, // '6'
+  {   272,   8,  14,  12,    2,  -14 }, // '7'
+  {   286,  10,  14,  12,    1,  -14 }, // '8'
+  {   304,  10,  14,  12,    1,  -14 }, // '9'
+  {   322,   2,  10,   6,    2,  -10 }, // ':'
+  {   325,   2,  12,   6,    2,  -10 }, // ';'
+  {   328,  12,  10,  16,    2,  -11 }, // '<'
+  {   343,  12,   6,  16,    2,   -9 }, // '='
+  {   352,  12,  10,  16,    2,  -11 }, // '>'
+  {   367,   8,  14,  10,    1,  -14 }, // '?'
+  {   381,  16,  16,  19,    1,  -13 }, // '@'
+  {   413,  13,  14,  13,    0,  -14 }, // 'A'
+  {   436,  10,  14,  13,    2,  -14 }, // 'B'
+  {   454,  11,  14,  13,    1,  -14 }, // 'C'
+  {   474,  11,  14,  14,    2,  -14 }, // 'D'
+  {   494,   9,  14,  12,    2,  -14 }, // 'E'
+  {   510,   8,  14,  11,    2,  -14 }, // 'F'
+  {   524,  12,  14,  15,    1,  -14 }, // 'G'
+  {   545,  10,  14,  14,    2,  -14 }, // 'H'
+  {   563,   2,  14,   6,    2,  -14 }, // 'I'
+  {   567,   5,  18,   6,   -1,  -14 }, // 'J'
+  {   579,  10,  14,  12,    2,  -14 }, // 'K'
+  {   597,   8,  14,  10,    2,  -14 }, // 'L'
+  {   611,  12,  14,  16,    2,  -14 }, // 'M'
+  {   632,  10,  14,  14,    2,  -14 }, // 'N'
+  {   650,  13,  14,  15,    1,  -14 }, // 'O'
+  {   673,   9,  14,  11,    2,  -14 }, // 'P'
+  {   689,  13,  16,  15,    1,  -14 }, // 'Q'
+  {   715,  10,  14,  13,    2,  -14 }, // 'R'
+  {   733,  10,  14,  12,    1,  -14 }, // 'S'
+  {   751,  11,  14,  11,    0,  -14 }, // 'T'
+  {   771,  10,  14,  14,    2,  -14 }, // 'U'
+  {   789,  11,  14,  13,    1,  -14 }, // 'V'
+  {   809,  17,  14,  19,    1,  -14 }, // 'W'
+  {   839,  11,  14,  13,    1,  -14 }, // 'X'
+  {   859,  11,  14,  11,    0,  -14 }, // 'Y'
+  {   879,  11,  14,  13,    1,  -14 }, // 'Z'
+  {   899,   4,  17,   7,    2,  -14 }, // '['
+  {   908,   6,  16,   6,    0,  -14 }, // '\'
+  {   920,   4,  17,   7,    2,  -14 }, // ']'
+  {   929,  10,   5,  16,    3,  -14 }, // '^'
+  {   936,  10,   1,   9,    0,    3 }, // '_'
+  {   938,   3,   3,   9,    2,  -15 }, // '`'
+  {   940,   9,  11,  12,    1,  -11 }, // 'a'
+  {   953,   9,  14,  12,    2,  -14 }, // 'b'
+  {   969,   8,  11,  10,    1,  -11 }, // 'c'
+  {   980,   9,  14,  12,    1,  -14 }, // 'd'
+  {   996,  10,  10,  12,    1,  -10 }, // 'e'
+  {  1009,   7,  14,   7,    0,  -14 }, // 'f'
+  {  1022,   9,  15,  12,    1,  -11 }, // 'g'
+  {  1039,   8,  14,  12,    2,  -14 }, // 'h'
+  {  1053,   1,  14,   5,    2,  -14 }, // 'i'
+  {  1055,   3,  18,   5,    0,  -14 }, // 'j'
+  {  1062,   8,  14,  11,    2,  -14 }, // 'k'
+  {  1076,   1,  14,   5,    2,  -14 }, // 'l'
+  {  1078,  15,  11,  18,    2,  -11 }, // 'm'
+  {  1099,   8,  11,  12,    2,  -11 }, // 'n'
+  {  1110,   9,  11,  12,    1,  -11 }, // 'o'
+  {  1123,   9,  15,  12,    2,  -11 }, // 'p'
+  {  1140,   9,  15,  12,    1,  -11 }, // 'q'
+  {  1157,   6,  10,   8,    2,  -10 }, // 'r'
+  {  1165,   8,  11,  10,    1,  -11 }, // 's'
+  {  1176,   6,  13,   7,    1,  -13 }, // 't'
+  {  1186,   8,  10,  12,    2,  -10 }, // 'u'
+  {  1196,   9,  10,  11,    1,  -10 }, // 'v'
+  {  1208,  13,  10,  15,    1,  -10 }, // 'w'
+  {  1225,   9,  10,  11,    1,  -10 }, // 'x'
+  {  1237,   9,  14,  11,    1,  -10 }, // 'y'
+  {  1253,   8,  10,  10,    1,  -10 }, // 'z'
+  {  1263,   8,  17,  12,    2,  -14 }, // '{'
+  {  1280,   2,  18,   6,    2,  -14 }, // '|'
+  {  1285,   8,  17,  12,    2,  -14 }, // '}'
+  {  1302,  12,   2,  16,    2,   -7 }, // '~'
+};
+
+const GFXfont FreeSans12pt7b PROGMEM = {
+  (uint8_t  *)FreeSans12pt7bBitmaps,
+  (GFXglyph *)FreeSans12pt7bGlyphs,
+  0x20, 0x7E, 22
+};
@@ -0,0 +1,341 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSans18pt7bBitmaps[] PROGMEM = {
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFE, // '!'
+  0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, // '"'
+  0x00, 0xC3, 0x00, 0x18, 0x60, 0x07, 0x0C, 0x00, 0xC3, 0x80, 0x18, 0x60, 0x7F, 0xFF, 0xCF, 0xFF,
+  0xF9, 0xFF, 0xFF, 0x03, 0x0C, 0x00, 0x61, 0x80, 0x1C, 0x30, 0x03, 0x0E, 0x0F, 0xFF, 0xFD, 0xFF,
+  0xFF, 0x83, 0x8E, 0x00, 0x61, 0xC0, 0x0C, 0x30, 0x01, 0x86, 0x00, 0x70, 0xC0, 0x0C, 0x38, 0x00, // '#'
+  0x03, 0x00, 0x0C, 0x00, 0x30, 0x07, 0xFC, 0x3F, 0xF1, 0xCC, 0x46, 0x30, 0x38, 0xC0, 0xE3, 0x01,
+  0xCC, 0x07, 0xF0, 0x0F, 0xF8, 0x07, 0xF0, 0x0D, 0xE0, 0x31, 0x80, 0xC7, 0x03, 0x1C, 0x0C, 0x6E,
+  0x37, 0xBF, 0xFC, 0x1F, 0xC0, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, // '$'
+  0x3C, 0x00, 0xE0, 0xFE, 0x01, 0x83, 0x8C, 0x06, 0x06, 0x1C, 0x0C, 0x0C, 0x18, 0x30, 0x18, 0x30,
+  0xE0, 0x30, 0x61, 0x80, 0x60, 0xC6, 0x00, 0xC3, 0x8C, 0x00, 0xFE, 0x30, 0x00, 0xF8, 0xE1, 0xC0,
+  0x01, 0x8F, 0xE0, 0x06, 0x38, 0xC0, 0x0C, 0x60, 0xC0, 0x30, 0xC1, 0x80, 0xE1, 0x83, 0x01, 0x83,
+  0x06, 0x06, 0x06, 0x0C, 0x0C, 0x0E, 0x38, 0x30, 0x0E, 0xE0, 0xE0, 0x0F, 0x80, // '%'
+  0x07, 0xE0, 0x01, 0xFE, 0x00, 0x78, 0xC0, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x00, 0xE0, 0x00, 0x1E, 0x00, 0x07, 0xE0, 0x01, 0xDE, 0x03, 0x31, 0xE0, 0xEE, 0x1E, 0x1D, 0xC1,
+  0xE3, 0x30, 0x1E, 0xE7, 0x01, 0xF8, 0xE0, 0x1F, 0x1E, 0x01, 0xE1, 0xE0, 0x7E, 0x1F, 0xFD, 0xE1,
+  0xFE, 0x1E, // '&'
+  0xFF, 0xFF, // '''
+  0x0C, 0x71, 0x8E, 0x30, 0xC7, 0x1C, 0x61, 0x86, 0x38, 0xE3, 0x86, 0x18, 0x71, 0xC3, 0x0C, 0x38,
+  0x61, 0xC3, 0x04, // '('
+  0xC3, 0x86, 0x1C, 0x30, 0xC3, 0x8E, 0x18, 0x61, 0x87, 0x1C, 0x71, 0x86, 0x38, 0xE3, 0x0C, 0x71,
+  0x8E, 0x30, 0x80, // ')'
+  0x06, 0x00, 0x60, 0x06, 0x0C, 0x63, 0x76, 0xE1, 0xF8, 0x0F, 0x01, 0xF8, 0x76, 0xEC, 0x63, 0x06,
+  0x00, 0x60, 0x06, 0x00, // '*'
+  0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x0C, 0x00,
+  0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00,
+  0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, // '+'
+  0x37, 0x77, 0x66, 0xC0, // ','
+  0xFF, 0xFF, // '-'
+  0x5F, 0xF0, // '.'
+  0x01, 0x80, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x1C, 0x0C, 0x06, 0x07, 0x03, 0x01, 0x81, 0xC0, 0xC0,
+  0x60, 0x30, 0x38, 0x18, 0x0C, 0x0E, 0x06, 0x03, 0x03, 0x81, 0x80, // '/'
+  0x07, 0x80, 0x7F, 0x83, 0xCF, 0x1C, 0x0E, 0x70, 0x3B, 0x80, 0x6E, 0x01, 0xF8, 0x07, 0xE0, 0x1F,
+  0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0x60, 0x39, 0xC0, 0xE3,
+  0x87, 0x0F, 0xFC, 0x0F, 0xC0, // '0'
+  0x06, 0x0F, 0xF0, 0xFF, 0x0C, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07,
+  0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x0F, 0xFF, 0xFF, 0xF0, // '1'
+  0x1F, 0x87, 0xFF, 0x3E, 0x7D, 0x80, 0xF0, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x03,
+  0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x01, 0xFF,
+  0xFF, 0xFF, 0x80, // '2'
+  0x1F, 0x81, 0xFF, 0x87, 0x9F, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0xF0,
+  0x3F, 0x80, 0xFE, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x60, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0xEC,
+  0x07, 0xBF, 0xFC, 0x7F, 0xC0, // '3'
+  0x00, 0x70, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x3B, 0x00, 0x66, 0x01, 0x8C, 0x07, 0x18, 0x0C,
+  0x30, 0x30, 0x60, 0xE0, 0xC1, 0x81, 0x86, 0x03, 0x1C, 0x07, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x30,
+  0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, // '4'
+  0x7F, 0xF3, 0xFF, 0x9F, 0xFC, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0xC0, 0x7F, 0xC3, 0xFF,
+  0x90, 0x1C, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x38, 0x01, 0xF0, 0x3D, 0xFF,
+  0xCF, 0xFC, 0x00, // '5'
+  0x03, 0xF0, 0x3F, 0xE1, 0xF3, 0x8E, 0x00, 0x70, 0x01, 0xC0, 0x06, 0x00, 0x38, 0xE0, 0xEF, 0xE3,
+  0xFF, 0xEF, 0x83, 0xBC, 0x07, 0xF0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0x70, 0x1D, 0xC0, 0x73,
+  0x83, 0x87, 0xFC, 0x0F, 0xE0, // '6'
+  0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0x80, 0x0E, 0x00, 0x30, 0x01, 0xC0, 0x07, 0x00, 0x38, 0x00, 0xE0,
+  0x03, 0x00, 0x1C, 0x00, 0x70, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x01, 0xC0, 0x07, 0x00, 0x18, 0x00,
+  0xE0, 0x03, 0x80, 0x1C, 0x00, // '7'
+  0x0F, 0xC0, 0xFF, 0xC7, 0x87, 0x9C, 0x0E, 0xE0, 0x1B, 0x80, 0x76, 0x01, 0x9C, 0x0E, 0x38, 0x70,
+  0x7F, 0x81, 0xFE, 0x1E, 0x1E, 0x70, 0x3B, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x77,
+  0x03, 0x9F, 0xFC, 0x1F, 0xE0, // '8'
+  0x0F, 0x80, 0xFF, 0x87, 0x8F, 0x1C, 0x0C, 0xE0, 0x3B, 0x80, 0x6E, 0x01, 0xF8, 0x07, 0xE0, 0x1F,
+  0x80, 0xFF, 0x03, 0xDE, 0x3F, 0x3F, 0xDC, 0x3E, 0x70, 0x01, 0xC0, 0x0E, 0x00, 0x38, 0x01, 0xC4,
+  0x0F, 0x1F, 0xF8, 0x7F, 0x80, // '9'
+  0x7F, 0xF0, 0x00, 0x00, 0x3F, 0xF8, // ':'
+  0x37, 0x77, 0x00, 0x00, 0x00, 0x03, 0x77, 0x76, 0x6C, // ';'
+  0x00, 0x01, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x0F, 0x80, 0x03,
+  0xC0, 0x00, 0x7E, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xC0, 0x00, 0xF0, // '<'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+  0xFF, 0xFF, // '='
+  0xC0, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFC,
+  0x00, 0x1F, 0x00, 0x3F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0x38, 0x00, 0x08,
+  0x00, 0x00, // '>'
+  0x1F, 0x1F, 0xFB, 0xCF, 0x40, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x06,
+  0x00, 0xC0, 0x38, 0x07, 0x00, 0x60, 0x00, 0x01, 0x80, 0x70, 0x0E, 0x01, 0xC0, // '?'
+  0x00, 0x7F, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xC1, 0xF0, 0x0E, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x38,
+  0x00, 0x0E, 0x70, 0x18, 0x06, 0x60, 0xFE, 0xC3, 0x60, 0xE7, 0xC3, 0xC1, 0xC1, 0xC3, 0xC1, 0x81,
+  0xC3, 0xC3, 0x80, 0xC3, 0xC3, 0x80, 0xC3, 0xC3, 0x80, 0xC3, 0xC1, 0x81, 0xC7, 0xC1, 0x81, 0xC6,
+  0xE1, 0xE3, 0xDC, 0x60, 0xFE, 0xF8, 0x70, 0x3C, 0xE0, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0E,
+  0x00, 0x30, 0x07, 0x81, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x7E, 0x00, // '@'
+  0x00, 0xE0, 0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1B, 0x80, 0x07, 0x70, 0x00, 0xC7,
+  0x00, 0x38, 0xE0, 0x07, 0x0C, 0x00, 0xC1, 0xC0, 0x38, 0x38, 0x07, 0x03, 0x01, 0xC0, 0x70, 0x3F,
+  0xFE, 0x07, 0xFF, 0xE1, 0xFF, 0xFC, 0x38, 0x01, 0x86, 0x00, 0x39, 0xC0, 0x07, 0x38, 0x00, 0x6E,
+  0x00, 0x0E, // 'A'
+  0xFF, 0x03, 0xFF, 0x8F, 0xFF, 0xB8, 0x0E, 0xE0, 0x3B, 0x80, 0x6E, 0x01, 0xB8, 0x0E, 0xE0, 0x7B,
+  0xFF, 0x8F, 0xFF, 0x38, 0x1E, 0xE0, 0x1F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E,
+  0x07, 0xBF, 0xFC, 0xFF, 0xE0, // 'B'
+  0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0x1F, 0x3C, 0x03, 0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  0x70, 0x00, 0x78, 0x01, 0x3E, 0x07, 0x1F, 0xFF, 0x07, 0xFC, // 'C'
+  0xFE, 0x00, 0x7F, 0xF8, 0x3F, 0xFF, 0x1C, 0x07, 0xCE, 0x00, 0xF7, 0x00, 0x3B, 0x80, 0x1D, 0xC0,
+  0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x0E, 0xE0, 0x0F, 0x70, 0x0F, 0x38, 0x3F, 0x1F, 0xFF, 0x0F, 0xFC, 0x00, // 'D'
+  0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0xFF,
+  0xBF, 0xFD, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xFF,
+  0xFF, 0xFF, 0x80, // 'E'
+  0xFF, 0xEF, 0xFF, 0xFF, 0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0F, 0xFE, 0xFF,
+  0xEE, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, // 'F'
+  0x03, 0xF8, 0x03, 0xFF, 0xC1, 0xF0, 0xF8, 0xF0, 0x06, 0x70, 0x00, 0x9C, 0x00, 0x0E, 0x00, 0x03,
+  0x80, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0E, 0x03, 0xFB, 0x80, 0xFF, 0xE0, 0x1F, 0xF8, 0x00, 0x7E,
+  0x00, 0x1F, 0x80, 0x07, 0x70, 0x01, 0xDE, 0x00, 0x73, 0xE0, 0x3C, 0x7F, 0xFE, 0x07, 0xFE, 0x00, // 'G'
+  0xC0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x60, // 'H'
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // 'I'
+  0x0C, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0x87, 0x0E, 0xF9, 0xF3, 0x00, // 'J'
+  0xC0, 0x0E, 0xE0, 0x1C, 0xE0, 0x38, 0xE0, 0x70, 0xE1, 0xE0, 0xE3, 0xC0, 0xE7, 0x80, 0xEF, 0x00,
+  0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xEF, 0x00, 0xE7, 0x80, 0xE3, 0xC0, 0xE1, 0xE0,
+  0xE0, 0xF0, 0xE0, 0x78, 0xE0, 0x3C, 0xE0, 0x1E, 0xE0, 0x0F, // 'K'
+  0xC0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00,
+  0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xFF,
+  0xFF, 0xFF, 0x80, // 'L'
+  0xF0, 0x01, 0xDE, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x03, 0xFD, 0x80, 0x6F, 0xB8, 0x0D, 0xF3, 0x03,
+  0xBE, 0x70, 0x67, 0xC6, 0x1C, 0xF8, 0xC3, 0x1F, 0x1C, 0x63, 0xE1, 0x9C, 0x7C, 0x33, 0x0F, 0x87,
+  0x61, 0xF0, 0x7C, 0x3E, 0x0F, 0x07, 0xC0, 0xE0, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C,
+  0x00, 0x0E, // 'M'
+  0xE0, 0x07, 0xE0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0xC0, 0x7B, 0x80, 0xF3, 0x81, 0xE7, 0x03, 0xC7,
+  0x07, 0x8E, 0x0F, 0x0E, 0x1E, 0x0C, 0x3C, 0x1C, 0x78, 0x18, 0xF0, 0x39, 0xE0, 0x33, 0xC0, 0x77,
+  0x80, 0x7F, 0x00, 0xFE, 0x00, 0xFC, 0x01, 0xE0, // 'N'
+  0x03, 0xF0, 0x01, 0xFF, 0x80, 0x7C, 0x7C, 0x1C, 0x03, 0x87, 0x00, 0x38, 0xE0, 0x03, 0xB8, 0x00,
+  0x77, 0x00, 0x0E, 0xE0, 0x00, 0xDC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
+  0x03, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0x70, 0x03, 0x8F, 0x00, 0xF0, 0xF0, 0x3C, 0x0F, 0xFF, 0x00,
+  0x7F, 0x80, // 'O'
+  0xFE, 0x07, 0xFF, 0x3F, 0xFD, 0xC0, 0xEE, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x03,
+  0xBF, 0xFD, 0xFF, 0xCF, 0xF0, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0,
+  0x0E, 0x00, 0x00, // 'P'
+  0x03, 0xF0, 0x01, 0xFF, 0x80, 0x7C, 0x7C, 0x1C, 0x03, 0x87, 0x00, 0x38, 0xE0, 0x03, 0xB8, 0x00,
+  0x77, 0x00, 0x0E, 0xE0, 0x00, 0xDC, 0x00, 0x1F, 0x80, 0x03, 0xF0, 0x00, 0x7E, 0x00, 0x0F, 0xC0,
+  0x03, 0xB8, 0x00, 0x77, 0x00, 0x0E, 0x70, 0x03, 0x8F, 0x00, 0xF0, 0xF0, 0x3C, 0x0F, 0xFF, 0x00,
+  0x7F, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x00, // 'Q'
+  0xFE, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0xE0, 0x70, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38, 0xE0, 0x38,
+  0xE0, 0x38, 0xE0, 0xF0, 0xFF, 0xE0, 0xFF, 0xC0, 0xE1, 0xE0, 0xE0, 0x70, 0xE0, 0x70, 0xE0, 0x38,
+  0xE0, 0x1C, 0xE0, 0x1C, 0xE0, 0x0E, 0xE0, 0x0E, 0xE0, 0x07, // 'R'
+  0x0F, 0xE0, 0xFF, 0xE7, 0xC7, 0xBC, 0x02, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xF8, 0x01,
+  0xFE, 0x01, 0xFF, 0x00, 0xFE, 0x00, 0x7C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x7E,
+  0x03, 0xFF, 0xFE, 0x7F, 0xE0, // 'S'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00,
+  0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, // 'T'
+  0x60, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07, 0x60, 0x07, 0x60, 0x07,
+  0x70, 0x07, 0x70, 0x0E, 0x38, 0x1E, 0x1F, 0xFC, 0x0F, 0xF8, // 'U'
+  0xC0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x3B, 0x80, 0x0E, 0x70, 0x03, 0x9C, 0x01, 0xC3, 0x00, 0x70,
+  0xE0, 0x18, 0x38, 0x0E, 0x07, 0x03, 0x81, 0xC1, 0xC0, 0x70, 0x70, 0x0E, 0x18, 0x03, 0x8E, 0x00,
+  0x63, 0x80, 0x1D, 0xC0, 0x07, 0x70, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x01, 0xC0, 0x00, // 'V'
+  0xC0, 0x0C, 0x01, 0xF8, 0x07, 0x80, 0x7E, 0x01, 0xE0, 0x19, 0xC0, 0x78, 0x0E, 0x70, 0x3F, 0x03,
+  0x9C, 0x0C, 0xC0, 0xE7, 0x03, 0x30, 0x30, 0xE0, 0xCC, 0x1C, 0x38, 0x73, 0x87, 0x0E, 0x18, 0x61,
+  0xC3, 0x86, 0x18, 0x60, 0x61, 0x86, 0x38, 0x1C, 0xE1, 0xCE, 0x07, 0x30, 0x73, 0x81, 0xCC, 0x0C,
+  0xC0, 0x33, 0x03, 0x70, 0x0F, 0xC0, 0xDC, 0x03, 0xE0, 0x3F, 0x00, 0xF8, 0x07, 0x80, 0x1E, 0x01,
+  0xE0, 0x07, 0x80, 0x78, 0x00, // 'W'
+  0x70, 0x03, 0x38, 0x03, 0x8E, 0x01, 0xC3, 0x81, 0xC1, 0xC1, 0xC0, 0x70, 0xE0, 0x1C, 0xE0, 0x0E,
+  0xE0, 0x03, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x3B, 0x80, 0x38, 0xE0,
+  0x1C, 0x38, 0x1C, 0x1C, 0x1C, 0x07, 0x0E, 0x01, 0xCE, 0x00, 0xEE, 0x00, 0x38, // 'X'
+  0xC0, 0x03, 0xE0, 0x07, 0xE0, 0x0E, 0x70, 0x1C, 0x38, 0x1C, 0x38, 0x38, 0x1C, 0x70, 0x0E, 0x70,
+  0x0F, 0xE0, 0x07, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, // 'Y'
+  0x7F, 0xFF, 0x3F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1C, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, // 'Z'
+  0xFF, 0xFE, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3,
+  0x8E, 0x3F, 0x7C, // '['
+  0xC0, 0x70, 0x18, 0x0C, 0x07, 0x01, 0x80, 0xC0, 0x70, 0x38, 0x0C, 0x06, 0x03, 0x80, 0xC0, 0x60,
+  0x38, 0x0C, 0x06, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03, // '\'
+  0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C,
+  0x71, 0xFF, 0xF8, // ']'
+  0x01, 0x80, 0x07, 0xC0, 0x0F, 0xE0, 0x1E, 0x70, 0x1C, 0x38, 0x38, 0x1C, 0x70, 0x0E, 0xC0, 0x07, // '^'
+  0xFF, 0xFF, 0xFF, 0xF0, // '_'
+  0xC7, 0x1C, 0x61, 0x84, // '`'
+  0x1F, 0x03, 0xFF, 0x1C, 0x7C, 0x00, 0xE0, 0x03, 0x00, 0x1C, 0x3F, 0xE7, 0xFF, 0x78, 0x3F, 0x01,
+  0xF0, 0x0F, 0x80, 0x7C, 0x07, 0xF0, 0x7D, 0xFF, 0xE7, 0xE7, // 'a'
+  0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x63, 0xC3, 0x7F, 0x9F, 0x1E, 0xF0, 0x77, 0x01,
+  0xF0, 0x0F, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xE0, 0x3F, 0x01, 0xFC, 0x1D, 0xBF,
+  0xCC, 0xFC, 0x00, // 'b'
+  0x07, 0xC1, 0xFF, 0x3C, 0x77, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0E, 0x00, 0xE0, 0x07, 0x81, 0x3F, 0xF1, 0xFE, // 'c'
+  0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x87, 0x8C, 0xFF, 0x6F, 0x1F, 0x70, 0x7F, 0x01,
+  0xF8, 0x0F, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xE0, 0x3F, 0x01, 0xDC, 0x1E, 0x7F,
+  0xB1, 0xF9, 0x80, // 'd'
+  0x07, 0x80, 0x7F, 0x83, 0xCF, 0x1C, 0x0E, 0xE0, 0x1B, 0x80, 0x7C, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x00, 0x0C, 0x00, 0x38, 0x00, 0xE0, 0x01, 0xE0, 0x23, 0xFF, 0x87, 0xFE, // 'e'
+  0x0F, 0x8F, 0xCE, 0x07, 0x03, 0x81, 0xC3, 0xFF, 0xFE, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x80, // 'f'
+  0x0F, 0x01, 0xFE, 0xDE, 0x3E, 0xE0, 0xFE, 0x03, 0xF0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0xC0, 0x7E, 0x03, 0xBC, 0x7C, 0xFF, 0x63, 0xE3, 0x00, 0x18, 0x01, 0xC0, 0x0E, 0xE1,
+  0xE7, 0xFE, 0x0F, 0xC0, // 'g'
+  0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x78, 0xDF, 0xEF, 0xDF, 0xF0, 0x7E, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x30, // 'h'
+  0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, // 'i'
+  0x0C, 0x30, 0xC0, 0x00, 0x00, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x30, 0xC7, 0x3F, 0xE7, 0x00, // 'j'
+  0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x01, 0xD8, 0x3C, 0xC3, 0xC6, 0x38,
+  0x33, 0x81, 0xB8, 0x0F, 0x80, 0x7C, 0x03, 0x70, 0x19, 0xE0, 0xC7, 0x86, 0x1E, 0x30, 0x79, 0x81,
+  0xEC, 0x07, 0x80, // 'k'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'l'
+  0x07, 0x81, 0xE3, 0x7F, 0x1F, 0xCF, 0x9E, 0xE7, 0xB8, 0x1E, 0x07, 0xE0, 0x78, 0x1F, 0x01, 0xC0,
+  0x7C, 0x03, 0x00, 0xF0, 0x0C, 0x03, 0xC0, 0x30, 0x0F, 0x00, 0xC0, 0x3C, 0x03, 0x00, 0xF0, 0x0C,
+  0x03, 0xC0, 0x30, 0x0F, 0x00, 0xC0, 0x3C, 0x03, 0x00, 0xF0, 0x0C, 0x03, // 'm'
+  0x07, 0x8D, 0xFE, 0xFD, 0xFF, 0x07, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0,
+  0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, // 'n'
+  0x0F, 0x80, 0xFF, 0x87, 0xCF, 0x1C, 0x1E, 0xE0, 0x3B, 0x80, 0x6C, 0x01, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0x7C, 0x01, 0xF8, 0x0E, 0xE0, 0x39, 0xC1, 0xC3, 0xFF, 0x07, 0xF0, // 'o'
+  0x07, 0x86, 0xFF, 0x3E, 0x3D, 0xE0, 0xEE, 0x03, 0xE0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0xC0, 0x7E, 0x03, 0xF8, 0x3B, 0x7F, 0x99, 0xF8, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80,
+  0x0C, 0x00, 0x60, 0x00, // 'p'
+  0x0F, 0x01, 0xFE, 0xDE, 0x3E, 0xE0, 0xFE, 0x03, 0xF0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0xC0, 0x7E, 0x03, 0xB8, 0x3C, 0xFF, 0x63, 0xF3, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00,
+  0x30, 0x01, 0x80, 0x0C, // 'q'
+  0x07, 0x6F, 0xFF, 0x5E, 0x0E, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03,
+  0x01, 0x80, // 'r'
+  0x1F, 0x8F, 0xFB, 0xC3, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x03, 0xF8, 0x3F, 0xC0, 0x7C, 0x03, 0x80,
+  0x30, 0x07, 0x01, 0xFF, 0xF7, 0xFC, // 's'
+  0x30, 0x18, 0x0C, 0x06, 0x07, 0x87, 0xFF, 0xFE, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x1C, 0x0F, 0xE1, 0xF0, // 't'
+  0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00,
+  0xD8, 0x0E, 0xC0, 0x77, 0x07, 0x9F, 0xEC, 0x7E, 0x60, // 'u'
+  0xE0, 0x0E, 0xC0, 0x39, 0xC0, 0x73, 0x80, 0xC3, 0x03, 0x87, 0x07, 0x0E, 0x0C, 0x0C, 0x38, 0x1C,
+  0x70, 0x19, 0xC0, 0x3B, 0x80, 0x76, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xE0, 0x00, // 'v'
+  0xE0, 0x70, 0x3B, 0x03, 0xC1, 0x98, 0x3E, 0x0C, 0xE1, 0xB0, 0xE7, 0x0D, 0x87, 0x18, 0xEE, 0x30,
+  0xE6, 0x31, 0x87, 0x31, 0x9C, 0x19, 0x8C, 0xE0, 0xDC, 0x76, 0x07, 0xC1, 0xF0, 0x3E, 0x0F, 0x80,
+  0xF0, 0x78, 0x07, 0x83, 0xC0, 0x38, 0x0E, 0x00, // 'w'
+  0x70, 0x1C, 0xE0, 0xE3, 0x87, 0x07, 0x1C, 0x0E, 0xE0, 0x1F, 0x00, 0x78, 0x01, 0xE0, 0x07, 0xC0,
+  0x3B, 0x81, 0xCE, 0x0E, 0x1C, 0x38, 0x39, 0xC0, 0x7E, 0x01, 0xC0, // 'x'
+  0xE0, 0x0D, 0x80, 0x77, 0x01, 0xDC, 0x06, 0x30, 0x38, 0xE0, 0xC1, 0x87, 0x07, 0x1C, 0x0C, 0x60,
+  0x33, 0x80, 0xEC, 0x01, 0xF0, 0x07, 0xC0, 0x0E, 0x00, 0x38, 0x00, 0xC0, 0x07, 0x00, 0x1C, 0x00,
+  0xE0, 0x1F, 0x00, 0x78, 0x00, // 'y'
+  0x7F, 0xFB, 0xFF, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, // 'z'
+  0x07, 0xC3, 0xF0, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0xC1, 0xF0, 0xF0,
+  0x3E, 0x01, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x3C, 0x07, 0xC0,
+  0x30, // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // '|'
+  0xF8, 0x3F, 0x01, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x3C, 0x03,
+  0xC1, 0xF0, 0xE0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0xC0, 0xF0, 0xF8, 0x30,
+  0x00, // '}'
+  0x1F, 0x00, 0x5F, 0xF0, 0x7F, 0x3F, 0xFA, 0x01, 0xFC, // '~'
+};
+
+const GFXglyph FreeSans18pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    0 }, // ' '
+  {     0,   3,  21,  11,    4,  -21 }, // '!'
+  {     8,   7,   8,  13,    3,  -21 }, // '"'
+  {    15,  19,  20,  24,    2,  -20 }, // '#'
+  {    63,  14,  25,  18,    2,  -21 }, // '$'
+  {   107,  23,  21,  27,    2,  -21 }, // '%'
+  {   168,  19,  21,  22,    2,  -21 }, // '&'
+  {   218,   2,   8,   8,    3,  -21 }, // '''
+  {   220,   6,  25,  11,    2,  -21 }, // '('
+  {   239,   6,  25,  11,    3,  -21 }, // ')'
+  {   258,  12,  13,  14,    1,  -21 }, // '*'
+  {   278,  18,  18,  24,    3,  -18 }, // '+'
+  {   319,   4,   7,   9,    2,   -4 }, // ','
+  {   323,   8,   2,  10,    1,   -9 }, // '-'
+  {   325,   3,   4,   9,    3,   -4 }, // '.'
+  {   327,   9,  24,  10,    0,  -21 }, // '/'
+  {   354,  14,  21,  18,    2,  -21 }, // '0'
+  {   391,  12,  21,  18,    3,  -21 }, // '1'
+  {   423,  13,  21,  18,    2,  -21 }, // '2'
+  {   458,  14,  21,  18,    2,  -21 }, // '3'
+  {   495,  15,  21,  18,    1,  -21 }, // '4'
+  {   535,  13,  21,  18,    2,  -21 }, // '5'
+  {   570,  14,  21,  18,    2,  -21 }, // '6'
+  {   607,  14,  21,  18,    2,  -21 }, // '7'
+  {   644,  14,  21,  18,    2,  -21 }, // '8'
+  {   681,  14,  21,  18,    2,  -21 }, // '9'
+  {   718,   3,  15,  10,    3,  -15 }, // ':'
+  {   724,   4,  18,  10,    2,  -15 }, // ';'
+  {   733,  18,  14,  24,    3,  -16 }, // '<'
+  {   765,  18,   8,  24,    3,  -13 }, // '='
+  {   783,  18,  15,  24,    3,  -16 }, // '>'
+  {   817,  11,  21,  15,    2,  -21 }, // '?'
+  {   846,  24,  25,  28,    2,  -20 }, // '@'
+  {   921,  19,  21,  19,    0,  -21 }, // 'A'
+  {   971,  14,  21,  19,    3,  -21 }, // 'B'
+  {  1008,  16,  21,  20,    2,  -21 }, // 'C'
+  {  1050,  17,  21,  22,    3,  -21 }, // 'D'
+  {  1095,  13,  21,  18,    3,  -21 }, // 'E'
+  {  1130,  12,  21,  16,    3,  -21 }, // 'F'
+  {  1162,  18,  21,  22,    2,  -21 }, // 'G'
+  {  1210,  15,  21,  21,    3,  -21 }, // 'H'
+  {  1250,   3,  21,   8,    3,  -21 }, // 'I'
+  {  1258,   7,  27,   8,   -1,  -21 }, // 'J'
+  {  1282,  16,  21,  18,    3,  -21 }, // 'K'
+  {  1324,  13,  21,  16,    3,  -21 }, // 'L'
+  {  1359,  19,  21,  24,    3,  -21 }, // 'M'
+  {  1409,  15,  21,  21,    3,  -21 }, // 'N'
+  {  1449,  19,  21,  22,    2,  -21 }, // 'O'
+  {  1499,  13,  21,  17,    3,  -21 }, // 'P'
+  {  1534,  19,  25,  22,    2,  -21 }, // 'Q'
+  {  1594,  16,  21,  20,    3,  -21 }, // 'R'
+  {  1636,  14,  21,  18,    2,  -21 }, // 'S'
+  {  1673,  17,  21,  17,    0,  -21 }, // 'T'
+  {  1718,  16,  21,  21,    2,  -21 }, // 'U'
+  {  1760,  18,  21,  19,    1,  -21 }, // 'V'
+  {  1808,  26,  21,  28,    1,  -21 }, // 'W'
+  {  1877,  17,  21,  19,    1,  -21 }, // 'X'
+  {  1922,  16,  21,  17,    1,  -21 }, // 'Y'
+  {  1964,  17,  21,  19,    1,  -21 }, // 'Z'
+  {  2009,   6,  25,  11,    2,  -21 }, // '['
+  {  2028,   9,  24,  10,    0,  -21 }, // '\'
+  {  2055,   6,  25,  11,    3,  -21 }, // ']'
+  {  2074,  16,   8,  24,    4,  -21 }, // '^'
+  {  2090,  14,   2,  14,    0,    5 }, // '_'
+  {  2094,   5,   6,  14,    3,  -23 }, // '`'
+  {  2098,  13,  16,  17,    2,  -16 }, // 'a'
+  {  2124,  13,  21,  18,    3,  -21 }, // 'b'
+  {  2159,  12,  16,  16,    2,  -16 }, // 'c'
+  {  2183,  13,  21,  18,    2,  -21 }, // 'd'
+  {  2218,  14,  16,  17,    2,  -16 }, // 'e'
+  {  2246,   9,  21,  10,    1,  -21 }, // 'f'
+  {  2270,  13,  22,  18,    2,  -16 }, // 'g'
+  {  2306,  12,  21,  18,    3,  -21 }, // 'h'
+  {  2338,   2,  21,   8,    3,  -21 }, // 'i'
+  {  2344,   6,  27,   8,   -1,  -21 }, // 'j'
+  {  2365,  13,  21,  16,    3,  -21 }, // 'k'
+  {  2400,   2,  21,   8,    3,  -21 }, // 'l'
+  {  2406,  22,  16,  27,    3,  -16 }, // 'm'
+  {  2450,  12,  16,  18,    3,  -16 }, // 'n'
+  {  2474,  14,  16,  17,    2,  -16 }, // 'o'
+  {  2502,  13,  22,  18,    3,  -16 }, // 'p'
+  {  2538,  13,  22,  18,    2,  -16 }, // 'q'
+  {  2574,   9,  16,  12,    3,  -16 }, // 'r'
+  {  2592,  11,  16,  15,    2,  -16 }, // 's'
+  {  2614,   9,  20,  11,    1,  -20 }, // 't'
+  {  2637,  13,  15,  18,    2,  -15 }, // 'u'
+  {  2662,  15,  15,  17,    1,  -15 }, // 'v'
+  {  2691,  21,  15,  23,    1,  -15 }, // 'w'
+  {  2731,  14,  15,  17,    1,  -15 }, // 'x'
+  {  2758,  14,  21,  17,    1,  -15 }, // 'y'
+  {  2795,  13,  15,  15,    1,  -15 }, // 'z'
+  {  2820,  10,  26,  18,    4,  -21 }, // '{'
+  {  2853,   2,  29,  10,    4,  -22 }, // '|'
+  {  2861,  10,  26,  18,    4,  -21 }, // '}'
+  {  2894,  18,   4,  24,    3,  -11 }, // '~'
+};
+
+const GFXfont FreeSans18pt7b PROGMEM = {
+  (uint8_t  *)FreeSans18pt7bBitmaps,
+  (GFXglyph *)FreeSans18pt7bGlyphs,
+  0x20, 0x7E, 33
+};
@@ -0,0 +1,480 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSans24pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0x80, // '!'
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x70, // '"'
+  0x00, 0x38, 0x1C, 0x00, 0x0E, 0x0E, 0x00, 0x03, 0x83, 0x80, 0x00, 0xE0, 0xE0, 0x00, 0x70, 0x38,
+  0x00, 0x1C, 0x1C, 0x00, 0x07, 0x07, 0x00, 0x03, 0xC1, 0xC0, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xF0, 0x1E, 0x0F, 0x00, 0x03, 0x83, 0x80, 0x01, 0xC0, 0xE0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C,
+  0x00, 0x07, 0x07, 0x00, 0x03, 0xC3, 0xC0, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF0, 0x1E, 0x0E,
+  0x00, 0x07, 0x03, 0x80, 0x01, 0xC1, 0xC0, 0x00, 0x70, 0x70, 0x00, 0x1C, 0x1C, 0x00, 0x0E, 0x07,
+  0x00, 0x03, 0x83, 0x80, 0x00, 0xE0, 0xE0, 0x00, // '#'
+  0x00, 0x80, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x03, 0xFF, 0x83, 0xFF, 0xF1,
+  0xFB, 0x7C, 0x78, 0xC1, 0x3C, 0x30, 0x0F, 0x0C, 0x03, 0xC3, 0x00, 0xF0, 0xC0, 0x3C, 0x30, 0x07,
+  0xCC, 0x00, 0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xF8, 0x03, 0x1E, 0x00, 0xC3, 0xC0,
+  0x30, 0xF0, 0x0C, 0x3C, 0x03, 0x0F, 0x80, 0xC3, 0xB8, 0x33, 0xEF, 0xFF, 0xF1, 0xFF, 0xF8, 0x0F,
+  0xF8, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x30, 0x00, 0x08, 0x00, // '$'
+  0x0F, 0x80, 0x01, 0xC0, 0x3F, 0xC0, 0x03, 0x80, 0x7D, 0xE0, 0x03, 0x00, 0x70, 0x70, 0x07, 0x00,
+  0x70, 0x70, 0x0E, 0x00, 0xE0, 0x38, 0x0E, 0x00, 0xE0, 0x38, 0x1C, 0x00, 0xE0, 0x38, 0x18, 0x00,
+  0xE0, 0x38, 0x38, 0x00, 0xE0, 0x38, 0x70, 0x00, 0xE0, 0x70, 0x70, 0x00, 0x70, 0x70, 0xE0, 0x00,
+  0x79, 0xE1, 0xC0, 0x00, 0x3F, 0xE1, 0xC0, 0x00, 0x0F, 0x83, 0x83, 0xF8, 0x00, 0x03, 0x87, 0xFC,
+  0x00, 0x07, 0x0F, 0x1E, 0x00, 0x0E, 0x0E, 0x0E, 0x00, 0x0E, 0x1C, 0x0E, 0x00, 0x1C, 0x1C, 0x07,
+  0x00, 0x1C, 0x1C, 0x07, 0x00, 0x38, 0x1C, 0x07, 0x00, 0x70, 0x1C, 0x07, 0x00, 0x70, 0x1C, 0x0E,
+  0x00, 0xE0, 0x0E, 0x0E, 0x00, 0xE0, 0x0E, 0x1E, 0x01, 0xC0, 0x07, 0xFC, 0x03, 0x80, 0x03, 0xF8,
+  0x03, 0x80, 0x00, 0x40, // '%'
+  0x00, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x00, 0x3E, 0x0E, 0x00, 0x0F, 0x00, 0x00,
+  0x03, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x03, 0xC0, 0x00,
+  0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0xE3, 0xCF, 0x80,
+  0x79, 0xE1, 0xF0, 0x1E, 0x78, 0x3E, 0x07, 0x1C, 0x07, 0xC1, 0xCF, 0x00, 0xF8, 0xF3, 0xC0, 0x1F,
+  0x38, 0xF0, 0x03, 0xFE, 0x1C, 0x00, 0x7F, 0x07, 0x80, 0x0F, 0x81, 0xF0, 0x03, 0xF0, 0x3E, 0x01,
+  0xFE, 0x07, 0xF3, 0xFF, 0xC0, 0xFF, 0xF8, 0xF8, 0x1F, 0xF8, 0x1F, 0x00, 0x20, 0x00, 0x00, // '&'
+  0xFF, 0xFF, 0xFF, 0xFC, // '''
+  0x03, 0x07, 0x0F, 0x0E, 0x1E, 0x1C, 0x1C, 0x38, 0x38, 0x78, 0x78, 0x70, 0x70, 0x70, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x70, 0x70, 0x70, 0x78, 0x38, 0x38, 0x3C, 0x1C, 0x1C, 0x0E, 0x0E,
+  0x07, 0x07, // '('
+  0x40, 0x70, 0x70, 0x38, 0x38, 0x3C, 0x1C, 0x1E, 0x0E, 0x0E, 0x0F, 0x0F, 0x0F, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0x0F, 0x0E, 0x0E, 0x1E, 0x1C, 0x1C, 0x38, 0x38, 0x70,
+  0x70, 0xE0, // ')'
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xE1, 0x83, 0x79, 0x8F, 0x1F, 0xFC, 0x07, 0xF0,
+  0x03, 0xE0, 0x07, 0xF0, 0x1F, 0xF8, 0x79, 0x9E, 0xF1, 0x87, 0x41, 0x81, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, // '*'
+  0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C,
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, // '+'
+  0x3B, 0xDE, 0xF7, 0xB9, 0xDC, 0xE0, // ','
+  0xFF, 0xFF, 0xFF, 0xFC, // '-'
+  0xFF, 0xFF, 0xF0, // '.'
+  0x00, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1C, 0x01, 0xC0, 0x3C, 0x03,
+  0x80, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x0E, 0x01, 0xE0, 0x1C, 0x01,
+  0xC0, 0x3C, 0x03, 0x80, 0x38, 0x03, 0x80, 0x70, 0x07, 0x00, 0x70, 0x0E, 0x00, 0x60, 0x00, // '/'
+  0x01, 0xF8, 0x00, 0xFF, 0xC0, 0x3F, 0xFC, 0x0F, 0x87, 0xC3, 0xE0, 0x78, 0x78, 0x07, 0x8E, 0x00,
+  0x73, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x00, 0x3D, 0xC0, 0x03, 0xB8, 0x00, 0x77, 0x00, 0x0F, 0xE0,
+  0x01, 0xFC, 0x00, 0x3B, 0x80, 0x07, 0x70, 0x00, 0xEE, 0x00, 0x1D, 0xC0, 0x07, 0xBC, 0x00, 0xF7,
+  0x80, 0x1E, 0xF0, 0x03, 0xCF, 0x00, 0xF1, 0xE0, 0x1E, 0x1E, 0x07, 0x83, 0xF3, 0xF0, 0x3F, 0xFC,
+  0x01, 0xFE, 0x00, 0x06, 0x00, // '0'
+  0x3F, 0xC0, 0xFF, 0xC0, 0xFF, 0xC0, 0xF1, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0,
+  0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0xFF, // '1'
+  0x0F, 0xE0, 0x3F, 0xFC, 0x3F, 0xFF, 0x9F, 0x07, 0xEC, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0x00,
+  0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '2'
+  0x0F, 0xF0, 0x1F, 0xFF, 0x07, 0xFF, 0xE1, 0xE0, 0xFC, 0x00, 0x0F, 0x80, 0x01, 0xE0, 0x00, 0x78,
+  0x00, 0x0E, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x07, 0xFC, 0x01, 0xFE, 0x00,
+  0x7F, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x1E, 0xC0, 0x0F, 0xBF, 0xFF, 0xCF, 0xFF, 0xE1, 0xFF, 0xE0, 0x03,
+  0x00, 0x00, // '3'
+  0x00, 0x1F, 0x00, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xEF, 0x00, 0x1C, 0xF0, 0x01,
+  0xCF, 0x00, 0x38, 0xF0, 0x07, 0x8F, 0x00, 0x70, 0xF0, 0x0E, 0x0F, 0x01, 0xE0, 0xF0, 0x1C, 0x0F,
+  0x03, 0x80, 0xF0, 0x78, 0x0F, 0x07, 0x00, 0xF0, 0xE0, 0x0F, 0x0F, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00,
+  0xF0, 0x00, 0x0F, 0x00, // '4'
+  0x7F, 0xFF, 0x1F, 0xFF, 0xC7, 0xFF, 0xE1, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01,
+  0xC0, 0x00, 0x70, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xC1, 0xFF, 0xF8, 0x60, 0x3F, 0x00, 0x03, 0xE0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0x80,
+  0x01, 0xE0, 0x00, 0xFB, 0x00, 0x7C, 0xFF, 0xFE, 0x3F, 0xFF, 0x0F, 0xFF, 0x80, 0x0C, 0x00, // '5'
+  0x00, 0xFC, 0x00, 0x7F, 0xF0, 0x3F, 0xFE, 0x0F, 0xC1, 0xC3, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00,
+  0x03, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC7, 0xE0, 0x73, 0xFF, 0x0F, 0xFF, 0xF1, 0xFC,
+  0x1F, 0x3F, 0x01, 0xF7, 0xC0, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0x3B, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
+  0x00, 0x1C, 0xE0, 0x03, 0x9E, 0x00, 0xF3, 0xC0, 0x1E, 0x3C, 0x07, 0x83, 0xE7, 0xE0, 0x3F, 0xF8,
+  0x03, 0xFE, 0x00, 0x04, 0x00, // '6'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00,
+  0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, // '7'
+  0x03, 0xF0, 0x07, 0xFF, 0x83, 0xFF, 0xF1, 0xF0, 0x3E, 0x78, 0x07, 0xBC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xDC, 0x00, 0xE7, 0x80, 0x78, 0xF0, 0x3C, 0x1F, 0xFE, 0x03, 0xFF, 0x01,
+  0xFF, 0xE1, 0xF0, 0x3E, 0x78, 0x07, 0xBC, 0x00, 0xFF, 0x00, 0x3F, 0x80, 0x07, 0xE0, 0x01, 0xF8,
+  0x00, 0x7F, 0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x07, 0x9F, 0xCF, 0xE3, 0xFF, 0xF0, 0x3F, 0xF0, 0x00,
+  0xC0, 0x00, // '8'
+  0x01, 0xF0, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC3, 0xC0, 0x78, 0xF0, 0x07, 0x9E, 0x00,
+  0xF3, 0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xB8, 0x00, 0xF7, 0x80, 0x3E, 0xF0,
+  0x07, 0xCF, 0x01, 0xF9, 0xF8, 0xFF, 0x1F, 0xFF, 0xE1, 0xFF, 0x3C, 0x07, 0x87, 0x80, 0x00, 0xF0,
+  0x00, 0x1C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x3C, 0x20, 0x0F, 0x07, 0xFF, 0xC0, 0xFF, 0xF0,
+  0x1F, 0xFC, 0x00, 0x18, 0x00, // '9'
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0, // ':'
+  0x7B, 0xDE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0xDE, 0xE7, 0x73, 0x80, // ';'
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03,
+  0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x3F, 0xE0, 0x00, 0x07, 0xFC,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, // '<'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, // '='
+  0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03,
+  0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0x3F, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x00, 0x0F, 0xF8, 0x00,
+  0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, // '>'
+  0x0F, 0xC1, 0xFF, 0xCF, 0xFF, 0xBC, 0x3F, 0xC0, 0x3C, 0x00, 0xF0, 0x01, 0xC0, 0x07, 0x00, 0x3C,
+  0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x01, 0xC0, 0x0F, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03,
+  0xC0, // '?'
+  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0x03, 0xF8, 0x00, 0x7C, 0x00, 0x3E,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x78, 0x00, 0x01, 0xE0, 0x78, 0x00, 0x00, 0x78, 0x38, 0x00, 0x00,
+  0x1C, 0x38, 0x07, 0xE3, 0x07, 0x1C, 0x07, 0xFD, 0xC3, 0x9C, 0x07, 0xFF, 0xE0, 0xEE, 0x07, 0x81,
+  0xF0, 0x77, 0x03, 0x80, 0x78, 0x3B, 0x03, 0x80, 0x3C, 0x1D, 0x81, 0xC0, 0x0E, 0x0F, 0xC0, 0xE0,
+  0x07, 0x07, 0xE0, 0x70, 0x03, 0x83, 0xB0, 0x38, 0x01, 0xC1, 0x98, 0x1C, 0x01, 0xE1, 0xCC, 0x07,
+  0x00, 0xF0, 0xE7, 0x03, 0xC0, 0xF8, 0xE3, 0x80, 0xF0, 0xFD, 0xE0, 0xE0, 0x7F, 0xEF, 0xE0, 0x70,
+  0x0F, 0xE7, 0xC0, 0x1C, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,
+  0xF0, 0x00, 0x08, 0x00, 0x3E, 0x00, 0x1E, 0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, // '@'
+  0x00, 0x3E, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x78, 0x00,
+  0x03, 0x9C, 0x00, 0x03, 0xCF, 0x00, 0x01, 0xC7, 0x80, 0x01, 0xE1, 0xC0, 0x00, 0xF0, 0xF0, 0x00,
+  0x70, 0x38, 0x00, 0x78, 0x1E, 0x00, 0x38, 0x0F, 0x00, 0x3C, 0x03, 0x80, 0x1E, 0x01, 0xE0, 0x0E,
+  0x00, 0xF0, 0x0F, 0x00, 0x38, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xC1, 0xE0,
+  0x01, 0xE1, 0xE0, 0x00, 0x70, 0xF0, 0x00, 0x3C, 0x70, 0x00, 0x1E, 0x78, 0x00, 0x07, 0x3C, 0x00,
+  0x03, 0xFC, 0x00, 0x01, 0xE0, // 'A'
+  0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x70, 0x03, 0xCE, 0x00, 0x3D, 0xC0, 0x07, 0xB8, 0x00,
+  0xF7, 0x00, 0x1E, 0xE0, 0x03, 0xDC, 0x00, 0xF3, 0x80, 0x3E, 0x7F, 0xFF, 0x0F, 0xFF, 0xC1, 0xFF,
+  0xFE, 0x38, 0x01, 0xE7, 0x00, 0x1E, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE,
+  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x7E, 0xFF, 0xFF, 0x9F, 0xFF, 0xE3, 0xFF, 0xF0,
+  0x00, // 'B'
+  0x00, 0x3F, 0x80, 0x07, 0xFF, 0xC0, 0x7F, 0xFF, 0xC3, 0xF8, 0x1F, 0x1F, 0x00, 0x1C, 0xF8, 0x00,
+  0x13, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0,
+  0x00, 0x07, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07,
+  0x80, 0x03, 0x0F, 0x80, 0x3C, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0x80, 0x3F, 0xF8, 0x00, 0x0C, 0x00, // 'C'
+  0xFF, 0xFC, 0x01, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x07, 0x00, 0x3F, 0x8E, 0x00, 0x1F, 0x1C, 0x00,
+  0x1F, 0x38, 0x00, 0x1F, 0x70, 0x00, 0x1E, 0xE0, 0x00, 0x3D, 0xC0, 0x00, 0x7B, 0x80, 0x00, 0x7F,
+  0x00, 0x00, 0xFE, 0x00, 0x01, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00,
+  0x1D, 0xC0, 0x00, 0x7B, 0x80, 0x00, 0xF7, 0x00, 0x01, 0xEE, 0x00, 0x07, 0x9C, 0x00, 0x1F, 0x38,
+  0x00, 0x7C, 0x70, 0x07, 0xF0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xE0, 0x00, // 'D'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x3C, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF7, 0xFF, 0xFB, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // 'E'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0xC0, 0x07, 0xFF, 0xEF, 0xFF, 0xDF, 0xFF, 0xB8, 0x00, 0x70, 0x00, 0xE0, 0x01,
+  0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0,
+  0x03, 0x80, 0x00, // 'F'
+  0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x0F, 0xE0, 0x7E, 0x1F, 0x00, 0x0E, 0x3E,
+  0x00, 0x02, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00,
+  0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x03, 0xFF, 0xF0, 0x03, 0xFF,
+  0xF0, 0x03, 0xFF, 0xF0, 0x00, 0x0F, 0x70, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x78, 0x00, 0x0F, 0x3C,
+  0x00, 0x0F, 0x3C, 0x00, 0x0F, 0x1E, 0x00, 0x0F, 0x0F, 0x80, 0x0F, 0x07, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFC, 0x00, 0xFF, 0xF0, 0x00, 0x06, 0x00, // 'G'
+  0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F,
+  0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8,
+  0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0,
+  0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1E, // 'H'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, // 'I'
+  0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C,
+  0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70,
+  0x78, 0x3C, 0x3F, 0xFE, 0xFE, 0x7E, 0x10, 0x00, // 'J'
+  0xE0, 0x01, 0xF7, 0x00, 0x1E, 0x38, 0x01, 0xE1, 0xC0, 0x1E, 0x0E, 0x03, 0xE0, 0x70, 0x3E, 0x03,
+  0x83, 0xE0, 0x1C, 0x3E, 0x00, 0xE3, 0xE0, 0x07, 0x3E, 0x00, 0x3B, 0xE0, 0x01, 0xFE, 0x00, 0x0F,
+  0xE0, 0x00, 0x7F, 0x80, 0x03, 0xBE, 0x00, 0x1C, 0xF8, 0x00, 0xE3, 0xE0, 0x07, 0x0F, 0x80, 0x38,
+  0x3E, 0x01, 0xC0, 0xF8, 0x0E, 0x03, 0xE0, 0x70, 0x0F, 0x83, 0x80, 0x3E, 0x1C, 0x00, 0xF8, 0xE0,
+  0x03, 0xE7, 0x00, 0x0F, 0xB8, 0x00, 0x3E, // 'K'
+  0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0,
+  0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01,
+  0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // 'L'
+  0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x07, 0xFE, 0xE0, 0x07, 0xFF,
+  0x70, 0x03, 0xBF, 0x9C, 0x01, 0xDF, 0xCE, 0x01, 0xCF, 0xE7, 0x80, 0xE7, 0xF1, 0xC0, 0x73, 0xF8,
+  0xE0, 0x71, 0xFC, 0x38, 0x38, 0xFE, 0x1C, 0x3C, 0x7F, 0x0E, 0x1C, 0x3F, 0x83, 0x8E, 0x1F, 0xC1,
+  0xCE, 0x0F, 0xE0, 0xF7, 0x07, 0xF0, 0x3F, 0x83, 0xF8, 0x1F, 0x81, 0xFC, 0x07, 0xC0, 0xFE, 0x03,
+  0xE0, 0x7F, 0x01, 0xE0, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00,
+  0x03, 0xF8, 0x00, 0x01, 0xE0, // 'M'
+  0xF8, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7E, 0xF0, 0x07, 0xE7,
+  0x00, 0x7E, 0x78, 0x07, 0xE3, 0x80, 0x7E, 0x3C, 0x07, 0xE1, 0xC0, 0x7E, 0x1E, 0x07, 0xE0, 0xF0,
+  0x7E, 0x0F, 0x07, 0xE0, 0x78, 0x7E, 0x07, 0x87, 0xE0, 0x3C, 0x7E, 0x03, 0xC7, 0xE0, 0x1E, 0x7E,
+  0x01, 0xE7, 0xE0, 0x0F, 0x7E, 0x00, 0x77, 0xE0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00,
+  0x1F, 0xE0, 0x01, 0xF0, // 'N'
+  0x00, 0x7F, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF8, 0x3F, 0x81, 0xF0, 0x03, 0xC1,
+  0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00, 0x03, 0xFC,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xDE, 0x00, 0x01, 0xEF, 0x00, 0x00, 0xF7, 0x80,
+  0x00, 0xF1, 0xE0, 0x00, 0x78, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0x7C, 0x1F, 0x80, 0x7C, 0x07, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xC0, 0x00, // 'O'
+  0xFF, 0xF8, 0x7F, 0xFF, 0x3F, 0xFF, 0xDC, 0x03, 0xEE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0,
+  0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x01, 0xFE, 0x01, 0xF7, 0xFF, 0xF3, 0xFF, 0xF1,
+  0xFF, 0xE0, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80,
+  0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, // 'P'
+  0x00, 0x7F, 0x00, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x01, 0xF8, 0x3F, 0x81, 0xF0, 0x03, 0xC1,
+  0xF0, 0x00, 0xF0, 0xF0, 0x00, 0x7C, 0xF8, 0x00, 0x1E, 0x78, 0x00, 0x07, 0xBC, 0x00, 0x03, 0xFC,
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0,
+  0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xDE, 0x00, 0x01, 0xEF, 0x00, 0x00, 0xF7, 0x80,
+  0x00, 0xF1, 0xE0, 0x00, 0x78, 0xF0, 0x00, 0x7C, 0x3C, 0x00, 0x7C, 0x1F, 0x80, 0x7C, 0x07, 0xFF,
+  0xFC, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03,
+  0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3C, 0x00, // 'Q'
+  0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0xC1, 0xC0, 0x1F, 0x0E, 0x00, 0x78, 0x70, 0x03, 0xC3,
+  0x80, 0x1E, 0x1C, 0x00, 0xF0, 0xE0, 0x07, 0x87, 0x00, 0x3C, 0x38, 0x01, 0xE1, 0xC0, 0x1E, 0x0F,
+  0xFF, 0xF0, 0x7F, 0xFE, 0x03, 0xFF, 0xE0, 0x1E, 0x0F, 0xC0, 0xE0, 0x1E, 0x07, 0x00, 0x78, 0x38,
+  0x01, 0xE1, 0xC0, 0x0F, 0x0E, 0x00, 0x3C, 0x70, 0x01, 0xE3, 0x80, 0x07, 0x9C, 0x00, 0x3C, 0xE0,
+  0x00, 0xF7, 0x00, 0x07, 0xB8, 0x00, 0x1E, // 'R'
+  0x01, 0xFC, 0x00, 0xFF, 0xFC, 0x1F, 0xFF, 0xC3, 0xF0, 0x3C, 0x7C, 0x00, 0x47, 0x80, 0x00, 0x70,
+  0x00, 0x0F, 0x00, 0x00, 0x70, 0x00, 0x07, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xF0,
+  0x01, 0xFF, 0xE0, 0x07, 0xFF, 0x80, 0x07, 0xFC, 0x00, 0x07, 0xE0, 0x00, 0x1E, 0x00, 0x01, 0xF0,
+  0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF4, 0x00, 0x1E, 0x70, 0x03, 0xE7, 0xFF,
+  0xFC, 0x7F, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0xC0, 0x00, // 'S'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00,
+  0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+  0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x00,
+  0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, // 'T'
+  0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03, 0xF8, 0x00, 0x1F,
+  0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F,
+  0x00, 0x03, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0xFC,
+  0x00, 0x1F, 0xE0, 0x00, 0xF7, 0x80, 0x07, 0xBC, 0x00, 0x3D, 0xF0, 0x03, 0xC7, 0xC0, 0x3E, 0x1F,
+  0xFF, 0xE0, 0x7F, 0xFE, 0x01, 0xFF, 0xC0, 0x00, 0x60, 0x00, // 'U'
+  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x78, 0x00, 0x1E, 0x38,
+  0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x1E, 0x00, 0x78, 0x1E, 0x00, 0x78, 0x1E, 0x00,
+  0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x07, 0x01, 0xE0, 0x07, 0x81, 0xE0, 0x07, 0x81, 0xC0,
+  0x03, 0xC3, 0xC0, 0x03, 0xC3, 0xC0, 0x01, 0xC7, 0x80, 0x01, 0xE7, 0x80, 0x01, 0xE7, 0x00, 0x00,
+  0xEF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C,
+  0x00, // 'V'
+  0xF0, 0x01, 0xF0, 0x01, 0xEE, 0x00, 0x3E, 0x00, 0x39, 0xE0, 0x07, 0xC0, 0x0F, 0x3C, 0x00, 0xFC,
+  0x01, 0xE7, 0x80, 0x3B, 0x80, 0x3C, 0x70, 0x07, 0x70, 0x07, 0x0F, 0x00, 0xEE, 0x01, 0xE1, 0xE0,
+  0x1C, 0xE0, 0x3C, 0x3C, 0x07, 0x1C, 0x07, 0x83, 0x80, 0xE3, 0x80, 0xE0, 0x78, 0x1C, 0x70, 0x3C,
+  0x0F, 0x03, 0x87, 0x07, 0x81, 0xE0, 0xE0, 0xE0, 0xF0, 0x1C, 0x1C, 0x1C, 0x1C, 0x03, 0xC3, 0x83,
+  0x87, 0x80, 0x78, 0x70, 0x38, 0xF0, 0x0F, 0x1C, 0x07, 0x1E, 0x00, 0xE3, 0x80, 0xE3, 0x80, 0x1E,
+  0x70, 0x1C, 0xF0, 0x03, 0xCE, 0x01, 0xDE, 0x00, 0x7B, 0x80, 0x3B, 0xC0, 0x07, 0x70, 0x07, 0x70,
+  0x00, 0xFE, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x0F, 0xC0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0x3E, 0x00,
+  0x3E, 0x00, 0x07, 0xC0, 0x07, 0xC0, 0x00, // 'W'
+  0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x78, 0x78, 0x01, 0xE0, 0x78, 0x07, 0x80, 0x78, 0x0F, 0x00, 0xF0,
+  0x3C, 0x00, 0xF0, 0xF0, 0x00, 0xF1, 0xE0, 0x01, 0xE7, 0x80, 0x01, 0xFE, 0x00, 0x01, 0xFC, 0x00,
+  0x03, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x80, 0x01, 0xE7,
+  0x80, 0x07, 0x8F, 0x00, 0x0F, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0xF0, 0x1E, 0x01, 0xE0, 0x1E, 0x07,
+  0x80, 0x1E, 0x1E, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x78, // 'X'
+  0xF0, 0x00, 0x7F, 0x80, 0x03, 0xDE, 0x00, 0x3C, 0x78, 0x03, 0xC3, 0xC0, 0x1E, 0x0F, 0x01, 0xE0,
+  0x3C, 0x1E, 0x01, 0xE0, 0xF0, 0x07, 0x8F, 0x00, 0x1E, 0xF0, 0x00, 0xFF, 0x80, 0x03, 0xF8, 0x00,
+  0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00,
+  0x1C, 0x00, 0x00, 0xE0, 0x00, 0x07, 0x00, 0x00, 0x38, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00,
+  0x70, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, // 'Y'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F,
+  0x00, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E,
+  0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3E,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'Z'
+  0x7F, 0xFF, 0xFF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+  0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF,
+  0xFF, 0xFF, // '['
+  0xE0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x38, 0x03, 0x80, 0x38, 0x03, 0xC0,
+  0x1C, 0x01, 0xC0, 0x1E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x30, // '\'
+  0xFF, 0xFF, 0xF8, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0xFF, 0xFF, 0xFC, // ']'
+  0x00, 0x7C, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0x3C, 0x00, 0x7C, 0x3C, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0x3C, 0x1E, 0x00, 0x3C, 0x78, 0x00, 0x3D, 0xE0, 0x00, 0x3C, // '^'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, // '_'
+  0xE0, 0xF0, 0x78, 0x38, 0x1C, 0x0E, 0x07, // '`'
+  0x0F, 0xF8, 0x0F, 0xFF, 0x83, 0xFF, 0xF0, 0xC0, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x38,
+  0x00, 0x0F, 0x07, 0xFF, 0xC7, 0xFF, 0xF3, 0xFF, 0xFD, 0xE0, 0x0F, 0x70, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x1F, 0xF0, 0x07, 0xDE, 0x03, 0xF7, 0xC3, 0xFC, 0xFF, 0xEF, 0x1F, 0xF3, 0xC0,
+  0x40, 0x00, // 'a'
+  0x60, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00,
+  0x07, 0x80, 0x00, 0xF1, 0xF8, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F, 0x07, 0xCF, 0xC0, 0x79, 0xF0,
+  0x07, 0xBC, 0x00, 0x77, 0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x77, 0xC0, 0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xF3, 0xFC, 0x7C,
+  0x7B, 0xFF, 0x8F, 0x3F, 0xC0, 0x00, 0x40, 0x00, // 'b'
+  0x01, 0xFC, 0x0F, 0xFF, 0x1F, 0xFF, 0x3E, 0x03, 0x3C, 0x00, 0x78, 0x00, 0x70, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x78, 0x00,
+  0x78, 0x00, 0x3C, 0x00, 0x1F, 0x8F, 0x0F, 0xFF, 0x07, 0xFF, 0x00, 0x60, // 'c'
+  0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C,
+  0x00, 0x07, 0x03, 0xF1, 0xC3, 0xFE, 0x71, 0xFF, 0xDC, 0xF8, 0x3F, 0x78, 0x07, 0xDE, 0x00, 0xF7,
+  0x00, 0x3F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC,
+  0x00, 0x77, 0x00, 0x1D, 0xC0, 0x0F, 0x78, 0x03, 0xCF, 0x01, 0xF3, 0xF1, 0xFC, 0x7F, 0xF7, 0x07,
+  0xF9, 0xC0, 0x20, 0x00, // 'd'
+  0x01, 0xFC, 0x01, 0xFF, 0xC0, 0x7F, 0xFE, 0x1F, 0x03, 0xC3, 0xC0, 0x3C, 0xF0, 0x03, 0x9C, 0x00,
+  0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0xE0,
+  0x00, 0x1C, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x07, 0xC0, 0x08, 0x7E, 0x1F, 0x07, 0xFF, 0xE0,
+  0x3F, 0xF8, 0x00, 0x60, 0x00, // 'e'
+  0x00, 0xF8, 0x3F, 0xC3, 0xFE, 0x1E, 0x01, 0xE0, 0x0F, 0x00, 0x70, 0x03, 0x80, 0xFF, 0xF7, 0xFF,
+  0xBF, 0xFC, 0x3C, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x00, // 'f'
+  0x07, 0xF1, 0xC3, 0xFE, 0x71, 0xFF, 0xDC, 0xF8, 0x3F, 0x78, 0x07, 0xDE, 0x00, 0xF7, 0x00, 0x3F,
+  0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x77,
+  0x00, 0x3D, 0xE0, 0x0F, 0x78, 0x07, 0xCF, 0x83, 0xF1, 0xFF, 0xDC, 0x3F, 0xE7, 0x03, 0xE1, 0xC0,
+  0x00, 0x70, 0x00, 0x1C, 0x00, 0x0F, 0x00, 0x07, 0x86, 0x03, 0xE1, 0xFF, 0xF0, 0x7F, 0xF8, 0x07,
+  0xF0, 0x00, // 'g'
+  0x60, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF1, 0xFC, 0x3C, 0xFF, 0x8F, 0x7F, 0xF3, 0xF8, 0x3E, 0xFC, 0x07, 0xBE, 0x00, 0xEF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
+  0x03, 0xC0, // 'h'
+  0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // 'i'
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F,
+  0x0F, 0x1E, 0xFE, 0xFC, 0xF0, // 'j'
+  0x60, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x03, 0xBC, 0x01, 0xEF, 0x00, 0xF3, 0xC0, 0xF8, 0xF0, 0x7C, 0x3C, 0x3C, 0x0F,
+  0x1E, 0x03, 0xCF, 0x00, 0xF7, 0x80, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0xF7, 0xC0, 0x3C,
+  0xF8, 0x0F, 0x1F, 0x03, 0xC1, 0xE0, 0xF0, 0x3C, 0x3C, 0x07, 0x8F, 0x00, 0xF3, 0xC0, 0x1E, 0xF0,
+  0x03, 0xC0, // 'k'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // 'l'
+  0x61, 0xF8, 0x07, 0xE3, 0xCF, 0xF8, 0x7F, 0xCF, 0x7F, 0xF3, 0xFF, 0xBF, 0x83, 0xDC, 0x1E, 0xF8,
+  0x07, 0xE0, 0x3F, 0xE0, 0x1F, 0x00, 0x7F, 0x00, 0x3C, 0x01, 0xFC, 0x00, 0xE0, 0x07, 0xF0, 0x03,
+  0x80, 0x1F, 0xC0, 0x0E, 0x00, 0x7F, 0x00, 0x38, 0x01, 0xFC, 0x00, 0xE0, 0x07, 0xF0, 0x03, 0x80,
+  0x1F, 0xC0, 0x0E, 0x00, 0x7F, 0x00, 0x38, 0x01, 0xFC, 0x00, 0xE0, 0x07, 0xF0, 0x03, 0x80, 0x1F,
+  0xC0, 0x0E, 0x00, 0x7F, 0x00, 0x38, 0x01, 0xFC, 0x00, 0xE0, 0x07, 0xF0, 0x03, 0x80, 0x1C, // 'm'
+  0x61, 0xFC, 0x3C, 0xFF, 0x8F, 0x7F, 0xF3, 0xF8, 0x3E, 0xFC, 0x07, 0xBE, 0x00, 0xEF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xC0, // 'n'
+  0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0x07, 0xC7, 0xC0, 0x7C, 0xF0, 0x07, 0x9C, 0x00,
+  0x77, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xDC, 0x00, 0x7B, 0xC0, 0x1E, 0x78, 0x03, 0xC7, 0x80, 0xF0, 0xFC, 0x7E, 0x0F, 0xFF, 0x80,
+  0x7F, 0xC0, 0x00, 0x80, 0x00, // 'o'
+  0x61, 0xF8, 0x1E, 0x7F, 0xC3, 0xDF, 0xFC, 0x7F, 0x07, 0xCF, 0xC0, 0x79, 0xF0, 0x07, 0xBC, 0x00,
+  0x77, 0x80, 0x0E, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x77, 0xC0, 0x1E, 0xF8, 0x03, 0xDF, 0x80, 0xF3, 0xFC, 0x7C, 0x7B, 0xFF, 0x8F,
+  0x3F, 0xC1, 0xE0, 0x40, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00,
+  0x78, 0x00, 0x07, 0x00, 0x00, // 'p'
+  0x03, 0xF1, 0xC3, 0xFE, 0x71, 0xFF, 0xDC, 0xF8, 0x3F, 0x78, 0x07, 0xDE, 0x00, 0xF7, 0x00, 0x3F,
+  0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xFC, 0x00, 0x77,
+  0x00, 0x1D, 0xC0, 0x0F, 0x78, 0x03, 0xCF, 0x01, 0xF3, 0xF1, 0xFC, 0x7F, 0xF7, 0x07, 0xF9, 0xC0,
+  0x20, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00,
+  0x01, 0xC0, // 'q'
+  0x61, 0xFF, 0x3F, 0xF7, 0xFF, 0xE0, 0xFC, 0x0F, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, // 'r'
+  0x0F, 0xF8, 0x3F, 0xFE, 0x7F, 0xFE, 0x78, 0x06, 0xF0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0x7C, 0x00, 0x7F, 0xC0, 0x1F, 0xF8, 0x07, 0xFC, 0x00, 0x7E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x0F,
+  0x00, 0x0F, 0xC0, 0x1E, 0xF8, 0x7E, 0xFF, 0xFC, 0x7F, 0xF0, 0x03, 0x00, // 's'
+  0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x7F, 0xFB, 0xFF, 0xFF, 0xFF, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
+  0x01, 0xC0, 0x0E, 0x00, 0x78, 0x03, 0xFF, 0x0F, 0xF8, 0x1F, 0xC0, // 't'
+  0x60, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F, 0xE0,
+  0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x0F, 0x70, 0x07, 0xBC, 0x07, 0xDF, 0x9F, 0xE7, 0xFF, 0x71, 0xFE, 0x38, 0x08, 0x00, // 'u'
+  0xC0, 0x00, 0xFC, 0x00, 0x3F, 0x80, 0x07, 0x78, 0x01, 0xE7, 0x00, 0x3C, 0xF0, 0x07, 0x1E, 0x01,
+  0xE1, 0xC0, 0x38, 0x3C, 0x07, 0x03, 0x81, 0xE0, 0x70, 0x38, 0x0F, 0x0F, 0x00, 0xE1, 0xE0, 0x1E,
+  0x38, 0x03, 0xCF, 0x00, 0x39, 0xC0, 0x07, 0xB8, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00,
+  0x1F, 0x00, // 'v'
+  0xE0, 0x0E, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x80, 0x7C, 0x07, 0xF8, 0x0F, 0x80, 0xE7, 0x03, 0xF0,
+  0x1C, 0xE0, 0x77, 0x07, 0x9E, 0x0E, 0xE0, 0xF3, 0xC1, 0xDC, 0x1C, 0x38, 0x71, 0x83, 0x87, 0x0E,
+  0x38, 0xF0, 0xF1, 0xC7, 0x1E, 0x1E, 0x70, 0xE3, 0x81, 0xCE, 0x0E, 0x70, 0x39, 0xC1, 0xDE, 0x07,
+  0xB8, 0x3B, 0x80, 0x7E, 0x07, 0x70, 0x0F, 0xC0, 0x7E, 0x01, 0xF8, 0x0F, 0xC0, 0x3F, 0x01, 0xF0,
+  0x03, 0xC0, 0x3E, 0x00, 0x78, 0x03, 0xC0, // 'w'
+  0x78, 0x00, 0xE3, 0xC0, 0x1E, 0x3C, 0x03, 0xC1, 0xE0, 0x78, 0x0F, 0x07, 0x80, 0x78, 0xF0, 0x07,
+  0x9E, 0x00, 0x3F, 0xC0, 0x01, 0xFC, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1F, 0x80, 0x03, 0xFC,
+  0x00, 0x3F, 0xC0, 0x07, 0x9E, 0x00, 0xF0, 0xF0, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x3C, 0x03, 0xC7,
+  0x80, 0x1E, 0xF0, 0x00, 0xF0, // 'x'
+  0xC0, 0x00, 0xFC, 0x00, 0x3F, 0xC0, 0x07, 0x78, 0x01, 0xE7, 0x00, 0x38, 0xF0, 0x07, 0x0E, 0x01,
+  0xE1, 0xE0, 0x38, 0x3C, 0x0F, 0x03, 0x81, 0xC0, 0x78, 0x38, 0x07, 0x0F, 0x00, 0xF1, 0xC0, 0x1E,
+  0x78, 0x01, 0xCE, 0x00, 0x3D, 0xC0, 0x03, 0xF8, 0x00, 0x7E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00,
+  0x1E, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00, 0x1E, 0x00, 0x03, 0x80, 0x00, 0xF0, 0x01, 0xFC, 0x00,
+  0x3F, 0x00, 0x07, 0xC0, 0x00, // 'y'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x7C, 0x00, 0x78,
+  0x00, 0xF0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 'z'
+  0x00, 0x1C, 0x07, 0xF0, 0x3F, 0xC0, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0xFF, 0x03, 0xF0, 0x0F,
+  0xE0, 0x07, 0xC0, 0x07, 0x00, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x38, 0x00, 0xF0, 0x03, 0xFC, 0x07, 0xF0, 0x0F, 0xC0, // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // '|'
+  0xE0, 0x03, 0xF8, 0x0F, 0xF0, 0x03, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00,
+  0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xFC, 0x03, 0xF0,
+  0x1F, 0xC0, 0xF0, 0x03, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
+  0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x03, 0xC0, 0xFF, 0x03, 0xF8, 0x0F, 0xC0, 0x00, // '}'
+  0x03, 0x00, 0x00, 0x1F, 0xF0, 0x07, 0x7F, 0xFC, 0x1F, 0xFF, 0xFF, 0xFE, 0xE0, 0x1F, 0xFC, 0x80,
+  0x03, 0xE0, // '~'
+};
+
+const GFXglyph FreeSans24pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    0 }, // ' '
+  {     0,   3,  27,  15,    6,  -27 }, // '!'
+  {    11,  10,  10,  17,    4,  -27 }, // '"'
+  {    24,  26,  27,  32,    3,  -27 }, // '#'
+  {   112,  18,  35,  24,    3,  -29 }, // '$'
+  {   191,  32,  29,  36,    2,  -28 }, // '%'
+  {   307,  26,  29,  29,    2,  -28 }, // '&'
+  {   402,   3,  10,  10,    4,  -27 }, // '''
+  {   406,   8,  34,  15,    3,  -29 }, // '('
+  {   440,   8,  34,  15,    3,  -29 }, // ')'
+  {   474,  16,  17,  19,    1,  -28 }, // '*'
+  {   508,  24,  24,  32,    4,  -24 }, // '+'
+  {   580,   5,   9,  12,    3,   -5 }, // ','
+  {   586,  10,   3,  14,    2,  -12 }, // '-'
+  {   590,   4,   5,  12,    4,   -5 }, // '.'
+  {   593,  12,  31,  13,    0,  -27 }, // '/'
+  {   640,  19,  29,  24,    2,  -28 }, // '0'
+  {   709,  16,  27,  24,    4,  -27 }, // '1'
+  {   763,  17,  28,  24,    3,  -28 }, // '2'
+  {   823,  18,  29,  24,    3,  -28 }, // '3'
+  {   889,  20,  27,  24,    2,  -27 }, // '4'
+  {   957,  18,  28,  24,    3,  -27 }, // '5'
+  {  1020,  19,  29,  24,    3,  -28 }, // '6'
+  {  1089,  18,  27,  24,    3,  -27 }, // '7'
+  {  1150,  18,  29,  24,    3,  -28 }, // '8'
+  {  1216,  19,  29,  24,    2,  -28 }, // '9'
+  {  1285,   4,  19,  13,    4,  -19 }, // ':'
+  {  1295,   5,  23,  13,    3,  -19 }, // ';'
+  {  1310,  24,  19,  32,    4,  -21 }, // '<'
+  {  1367,  24,  11,  32,    4,  -17 }, // '='
+  {  1400,  24,  20,  32,    4,  -22 }, // '>'
+  {  1460,  14,  28,  20,    3,  -28 }, // '?'
+  {  1509,  33,  33,  38,    2,  -26 }, // '@'
+  {  1646,  25,  27,  26,    0,  -27 }, // 'A'
+  {  1731,  19,  27,  26,    4,  -27 }, // 'B'
+  {  1796,  22,  29,  26,    2,  -28 }, // 'C'
+  {  1876,  23,  27,  29,    4,  -27 }, // 'D'
+  {  1954,  17,  27,  24,    4,  -27 }, // 'E'
+  {  2012,  15,  27,  22,    4,  -27 }, // 'F'
+  {  2063,  24,  29,  29,    2,  -28 }, // 'G'
+  {  2150,  21,  27,  28,    4,  -27 }, // 'H'
+  {  2221,   3,  27,  11,    4,  -27 }, // 'I'
+  {  2232,   9,  35,  11,   -2,  -27 }, // 'J'
+  {  2272,  21,  27,  25,    4,  -27 }, // 'K'
+  {  2343,  17,  27,  21,    4,  -27 }, // 'L'
+  {  2401,  25,  27,  32,    4,  -27 }, // 'M'
+  {  2486,  20,  27,  28,    4,  -27 }, // 'N'
+  {  2554,  25,  29,  30,    2,  -28 }, // 'O'
+  {  2645,  17,  27,  23,    4,  -27 }, // 'P'
+  {  2703,  25,  33,  30,    2,  -28 }, // 'Q'
+  {  2807,  21,  27,  26,    4,  -27 }, // 'R'
+  {  2878,  20,  29,  24,    2,  -28 }, // 'S'
+  {  2951,  23,  27,  23,    0,  -27 }, // 'T'
+  {  3029,  21,  28,  28,    3,  -27 }, // 'U'
+  {  3103,  24,  27,  26,    1,  -27 }, // 'V'
+  {  3184,  35,  27,  37,    1,  -27 }, // 'W'
+  {  3303,  23,  27,  26,    1,  -27 }, // 'X'
+  {  3381,  21,  27,  23,    1,  -27 }, // 'Y'
+  {  3452,  22,  27,  26,    2,  -27 }, // 'Z'
+  {  3527,   8,  34,  15,    3,  -29 }, // '['
+  {  3561,  12,  31,  13,    0,  -27 }, // '\'
+  {  3608,   7,  34,  15,    4,  -29 }, // ']'
+  {  3638,  23,  10,  32,    4,  -27 }, // '^'
+  {  3667,  19,   3,  19,    0,    6 }, // '_'
+  {  3675,   8,   7,  19,    4,  -30 }, // '`'
+  {  3682,  18,  22,  23,    2,  -21 }, // 'a'
+  {  3732,  19,  30,  24,    3,  -29 }, // 'b'
+  {  3804,  16,  22,  21,    2,  -21 }, // 'c'
+  {  3848,  18,  30,  24,    2,  -29 }, // 'd'
+  {  3916,  19,  22,  23,    2,  -21 }, // 'e'
+  {  3969,  13,  29,  13,    1,  -29 }, // 'f'
+  {  4017,  18,  29,  24,    2,  -21 }, // 'g'
+  {  4083,  18,  29,  24,    3,  -29 }, // 'h'
+  {  4149,   3,  29,  10,    4,  -29 }, // 'i'
+  {  4160,   8,  37,  10,   -1,  -29 }, // 'j'
+  {  4197,  18,  29,  22,    3,  -29 }, // 'k'
+  {  4263,   3,  29,  10,    4,  -29 }, // 'l'
+  {  4274,  30,  21,  37,    3,  -21 }, // 'm'
+  {  4353,  18,  21,  24,    3,  -21 }, // 'n'
+  {  4401,  19,  22,  23,    2,  -21 }, // 'o'
+  {  4454,  19,  29,  24,    3,  -21 }, // 'p'
+  {  4523,  18,  29,  24,    2,  -21 }, // 'q'
+  {  4589,  12,  21,  15,    3,  -21 }, // 'r'
+  {  4621,  16,  22,  20,    2,  -21 }, // 's'
+  {  4665,  13,  26,  15,    1,  -26 }, // 't'
+  {  4708,  17,  22,  24,    3,  -21 }, // 'u'
+  {  4755,  19,  21,  22,    2,  -21 }, // 'v'
+  {  4805,  27,  21,  31,    2,  -21 }, // 'w'
+  {  4876,  20,  21,  22,    1,  -21 }, // 'x'
+  {  4929,  19,  29,  22,    2,  -21 }, // 'y'
+  {  4998,  16,  21,  20,    2,  -21 }, // 'z'
+  {  5040,  14,  35,  24,    5,  -29 }, // '{'
+  {  5102,   3,  38,  13,    5,  -29 }, // '|'
+  {  5117,  14,  35,  24,    5,  -29 }, // '}'
+  {  5179,  24,   6,  32,    4,  -15 }, // '~'
+};
+
+const GFXfont FreeSans24pt7b PROGMEM = {
+  (uint8_t  *)FreeSans24pt7bBitmaps,
+  (GFXglyph *)FreeSans24pt7bGlyphs,
+  0x20, 0x7E, 44
+};
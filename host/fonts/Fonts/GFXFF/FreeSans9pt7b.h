@@ -0,0 +1,204 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSans9pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xE8, 0xB0, // '!'
+  0xDD, 0xD1, // '"'
+  0x09, 0x02, 0x41, 0xB1, 0xFF, 0x12, 0x04, 0x8F, 0xF8, 0x90, 0x24, 0x09, 0x00, // '#'
+  0x10, 0xFB, 0x44, 0x8D, 0x07, 0x85, 0x8B, 0x96, 0xF8, 0x40, 0x80, // '$'
+  0xF0, 0x89, 0x10, 0x99, 0x09, 0x20, 0x74, 0x00, 0x5E, 0x09, 0x30, 0x91, 0x11, 0x22, 0x0E, // '%'
+  0x3C, 0x30, 0x18, 0x04, 0x07, 0x0E, 0xC6, 0x37, 0x0E, 0xC3, 0x3E, 0xC0, // '&'
+  0xFC, // '''
+  0x25, 0x2D, 0xB6, 0xC9, 0x32, // '('
+  0x48, 0x92, 0x49, 0x29, 0x40, // ')'
+  0x25, 0x5C, 0xF2, 0x10, // '*'
+  0x08, 0x04, 0x02, 0x01, 0x0F, 0xF8, 0x60, 0x20, 0x10, 0x08, 0x00, // '+'
+  0x5E, // ','
+  0xE0, // '-'
+  0xC0, // '.'
+  0x18, 0x84, 0x62, 0x11, 0x88, 0x42, 0x20, // '/'
+  0x7C, 0x8B, 0x1C, 0x18, 0x30, 0x60, 0xE3, 0x44, 0xF0, // '0'
+  0xE0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x33, 0xF0, // '1'
+  0xFC, 0x08, 0x10, 0x20, 0xC3, 0x0C, 0x30, 0xC1, 0xFC, // '2'
+  0xFC, 0x08, 0x18, 0x23, 0x80, 0x81, 0x83, 0x05, 0xF8, // '3'
+  0x1C, 0x38, 0xB3, 0x64, 0xD1, 0xBF, 0xFF, 0x0C, 0x18, // '4'
+  0x7C, 0x81, 0x03, 0xC4, 0xC0, 0xC1, 0x83, 0x0D, 0xF0, // '5'
+  0x3C, 0x83, 0x07, 0xCE, 0xD8, 0xF0, 0xE1, 0x46, 0x78, // '6'
+  0xFE, 0x08, 0x30, 0x60, 0x83, 0x04, 0x08, 0x30, 0x40, // '7'
+  0x7D, 0x8F, 0x1A, 0x27, 0xC8, 0xA0, 0xC1, 0xC6, 0xF8, // '8'
+  0x7D, 0x8A, 0x1C, 0x3C, 0x6F, 0xC1, 0x83, 0x0C, 0xF0, // '9'
+  0x86, // ':'
+  0x40, 0x17, 0x80, // ';'
+  0x01, 0x83, 0x8E, 0x1C, 0x07, 0x80, 0x78, 0x06, // '<'
+  0xFF, 0x00, 0xFF, 0xFF, // '='
+  0xC0, 0x1C, 0x01, 0xC0, 0x30, 0x71, 0xE1, 0x80, // '>'
+  0xF8, 0x42, 0x33, 0x10, 0x80, 0x21, 0x00, // '?'
+  0x0F, 0x83, 0x0C, 0x60, 0x24, 0x69, 0x89, 0x99, 0x09, 0x90, 0x99, 0x89, 0x8F, 0xE4, 0x00, 0x20,
+  0x01, 0xF8, // '@'
+  0x0C, 0x0E, 0x05, 0x82, 0x43, 0x21, 0x19, 0xFC, 0xC3, 0x40, 0xE0, 0x40, // 'A'
+  0xFC, 0xC2, 0xC2, 0xC6, 0xFC, 0xC2, 0xC3, 0xC3, 0xC6, 0xFC, // 'B'
+  0x3F, 0x41, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xC0, 0x61, 0x3F, // 'C'
+  0xFE, 0x61, 0xB0, 0x78, 0x3C, 0x0E, 0x07, 0x07, 0x83, 0xC3, 0x7E, 0x00, // 'D'
+  0xFF, 0x83, 0x06, 0x0F, 0xF8, 0x30, 0x60, 0xC1, 0xFC, // 'E'
+  0xFF, 0x0C, 0x30, 0xFF, 0x0C, 0x30, 0xC3, 0x00, // 'F'
+  0x3F, 0x20, 0x30, 0x10, 0x08, 0x04, 0x3E, 0x07, 0x83, 0x61, 0x9F, 0x80, // 'G'
+  0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, // 'H'
+  0xFF, 0xFF, 0xF0, // 'I'
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x36, 0xC0, // 'J'
+  0xC2, 0xCC, 0xD8, 0xF0, 0xE0, 0xF0, 0xD8, 0xCC, 0xC6, 0xC3, // 'K'
+  0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xFC, // 'L'
+  0xE1, 0xF8, 0x7E, 0x1F, 0x4B, 0xD2, 0xF6, 0xBC, 0xCF, 0x33, 0xC0, 0xF0, 0x30, // 'M'
+  0xE1, 0xE1, 0xF1, 0xD1, 0xD9, 0xC9, 0xCD, 0xC7, 0xC7, 0xC3, // 'N'
+  0x3E, 0x20, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83, 0x63, 0x1F, 0x00, // 'O'
+  0xFD, 0x8F, 0x0E, 0x3C, 0x7F, 0x30, 0x60, 0xC1, 0x80, // 'P'
+  0x3E, 0x20, 0xB0, 0x70, 0x18, 0x0C, 0x06, 0x03, 0x83, 0x63, 0x1F, 0x01, 0x80, 0x60, // 'Q'
+  0xFC, 0xC6, 0xC2, 0xC6, 0xFC, 0xFC, 0xC6, 0xC2, 0xC3, 0xC1, // 'R'
+  0x7F, 0x82, 0x06, 0x07, 0x81, 0xC0, 0x81, 0x87, 0xF8, // 'S'
+  0xFF, 0x84, 0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, // 'T'
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x43, 0x3E, // 'U'
+  0xC0, 0xA0, 0xD8, 0x44, 0x22, 0x31, 0x90, 0x48, 0x2C, 0x1C, 0x06, 0x00, // 'V'
+  0x86, 0x18, 0x61, 0xC6, 0x3C, 0x93, 0x49, 0x24, 0x92, 0x69, 0x67, 0x0E, 0x30, 0xC3, 0x0C, // 'W'
+  0xC2, 0x66, 0x24, 0x38, 0x18, 0x38, 0x2C, 0x66, 0xC2, 0x83, // 'X'
+  0xC1, 0x62, 0x26, 0x14, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, // 'Y'
+  0xFF, 0x02, 0x04, 0x0C, 0x18, 0x30, 0x20, 0x40, 0xC0, 0xFF, // 'Z'
+  0xFA, 0x49, 0x24, 0x92, 0x6E, // '['
+  0x82, 0x10, 0x86, 0x10, 0x86, 0x10, 0x86, // '\'
+  0x64, 0x92, 0x49, 0x24, 0x9E, // ']'
+  0x38, 0x64, 0x42, 0x81, // '^'
+  0xFE, // '_'
+  0x90, // '`'
+  0x78, 0x30, 0x5F, 0xC6, 0x18, 0xDD, // 'a'
+  0xC1, 0x83, 0x67, 0x2C, 0x38, 0x70, 0xE1, 0xC7, 0xF8, // 'b'
+  0x3D, 0x08, 0x20, 0x82, 0x0C, 0x1F, // 'c'
+  0x06, 0x0D, 0xDE, 0x78, 0x70, 0xE1, 0xC3, 0xC6, 0xFC, // 'd'
+  0x38, 0x8A, 0x1F, 0xFC, 0x10, 0x30, 0x3E, // 'e'
+  0x34, 0x4F, 0xC4, 0x44, 0x44, 0x40, // 'f'
+  0x71, 0x9E, 0x1C, 0x38, 0x70, 0xF3, 0xBF, 0x06, 0x19, 0xE0, // 'g'
+  0xC1, 0x83, 0x77, 0x2C, 0x78, 0xF1, 0xE3, 0xC7, 0x8C, // 'h'
+  0xC3, 0xFF, 0xF0, // 'i'
+  0x60, 0x36, 0xDB, 0x6D, 0xAC, // 'j'
+  0xC1, 0x83, 0x16, 0x6D, 0x1C, 0x38, 0x6C, 0xCD, 0x8C, // 'k'
+  0xFF, 0xFF, 0xF0, // 'l'
+  0x18, 0xCE, 0x72, 0xC6, 0x2C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, // 'm'
+  0x1D, 0xCB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, // 'n'
+  0x39, 0x9A, 0x1C, 0x38, 0x70, 0xF1, 0x3C, // 'o'
+  0x19, 0xCB, 0x0E, 0x1C, 0x38, 0x71, 0xFE, 0xC1, 0x83, 0x00, // 'p'
+  0x71, 0x9E, 0x1C, 0x38, 0x70, 0xF1, 0xBF, 0x06, 0x0C, 0x18, // 'q'
+  0x1F, 0x31, 0x8C, 0x63, 0x18, // 'r'
+  0x7B, 0x08, 0x38, 0x38, 0x30, 0xFE, // 's'
+  0xCC, 0xFC, 0xCC, 0xCC, 0xC7, // 't'
+  0x81, 0x0E, 0x1C, 0x38, 0x78, 0xF1, 0xBF, // 'u'
+  0x83, 0x0B, 0x12, 0x64, 0x8D, 0x0E, 0x18, // 'v'
+  0x88, 0x63, 0x39, 0xCB, 0x52, 0x52, 0x9C, 0xE6, 0x31, 0x8C, // 'w'
+  0x84, 0x99, 0xA1, 0x83, 0x0D, 0x13, 0x43, // 'x'
+  0x83, 0x0B, 0x12, 0x64, 0x87, 0x0C, 0x18, 0x30, 0x43, 0x00, // 'y'
+  0xFC, 0x31, 0x8C, 0x21, 0x08, 0x3F, // 'z'
+  0x19, 0x88, 0x42, 0x13, 0x0C, 0x21, 0x08, 0x43, 0x80, // '{'
+  0xFF, 0xFC, // '|'
+  0xC3, 0x08, 0x42, 0x10, 0x66, 0x21, 0x08, 0x4E, 0x00, // '}'
+  0xFF, 0x06, // '~'
+};
+
+const GFXglyph FreeSans9pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    0 }, // ' '
+  {     0,   2,  10,   6,    2,  -10 }, // '!'
+  {     3,   4,   4,   6,    1,  -10 }, // '"'
+  {     5,  10,  10,  12,    1,  -10 }, // '#'
+  {    18,   7,  12,   9,    1,  -10 }, // '$'
+  {    29,  12,  10,  13,    1,  -10 }, // '%'
+  {    44,   9,  10,  11,    1,  -10 }, // '&'
+  {    56,   2,   3,   4,    1,  -10 }, // '''
+  {    57,   3,  13,   6,    1,  -11 }, // '('
+  {    62,   3,  12,   6,    1,  -10 }, // ')'
+  {    67,   5,   6,   7,    1,  -10 }, // '*'
+  {    71,   9,   9,  12,    1,   -9 }, // '+'
+  {    82,   2,   4,   4,    1,   -2 }, // ','
+  {    83,   3,   1,   5,    1,   -4 }, // '-'
+  {    84,   1,   2,   4,    2,   -2 }, // '.'
+  {    85,   5,  11,   5,    0,  -10 }, // '/'
+  {    92,   7,  10,   9,    1,  -10 }, // '0'
+  {   101,   6,  10,   9,    2,  -10 }, // '1'
+  {   109,   7,  10,   9,    1,  -10 }, // '2'
+  {   118,   7,  10,   9,    1,  -10 }, // '3'
+  {   127,   7,  10,   9,    1,  -10 }, // '4'
+  {   136,   7,  10,   9,    1,  -10 }, // '5'
+  {   145,   7,  10,   9,    1,  -10 }, // '6'
+  {   154,   7,  10,   9,    1,  -10 }, // '7'
+  {   163,   7,  10,   9,    1,  -10 }, // '8'
+  {   172,   7,  10,   9,    1,  -10 }, // '9'
+  {   181,   1,   7,   5,    2,   -7 }, // ':'
+  {   182,   2,   9,   5,    1,   -7 }, // ';'
+  {   185,   9,   7,  12,    1,   -8 }, // '<'
+  {   193,   8,   4,  12,    2,   -6 }, // '='
+  {   197,   9,   7,  12,    1,   -8 }, // '>'
+  {   205,   5,  10,   7,    1,  -10 }, // '?'
+  {   212,  12,  12,  14,    1,  -10 }, // '@'
+  {   230,   9,  10,  10,    0,  -10 }, // 'A'
+  {   242,   8,  10,  10,    1,  -10 }, // 'B'
+  {   252,   8,  10,  10,    1,  -10 }, // 'C'
+  {   262,   9,  10,  11,    1,  -10 }, // 'D'
+  {   274,   7,  10,   9,    1,  -10 }, // 'E'
+  {   283,   6,  10,   8,    1,  -10 }, // 'F'
+  {   291,   9,  10,  11,    1,  -10 }, // 'G'
+  {   303,   8,  10,  11,    1,  -10 }, // 'H'
+  {   313,   2,  10,   4,    1,  -10 }, // 'I'
+  {   316,   4,  13,   4,   -1,  -10 }, // 'J'
+  {   323,   8,  10,   9,    1,  -10 }, // 'K'
+  {   333,   7,  10,   8,    1,  -10 }, // 'L'
+  {   342,  10,  10,  12,    1,  -10 }, // 'M'
+  {   355,   8,  10,  11,    1,  -10 }, // 'N'
+  {   365,   9,  10,  11,    1,  -10 }, // 'O'
+  {   377,   7,  10,   9,    1,  -10 }, // 'P'
+  {   386,   9,  12,  11,    1,  -10 }, // 'Q'
+  {   400,   8,  10,  10,    1,  -10 }, // 'R'
+  {   410,   7,  10,   9,    1,  -10 }, // 'S'
+  {   419,   9,  10,   9,    0,  -10 }, // 'T'
+  {   431,   8,  10,  10,    1,  -10 }, // 'U'
+  {   441,   9,  10,  10,    0,  -10 }, // 'V'
+  {   453,  12,  10,  14,    1,  -10 }, // 'W'
+  {   468,   8,  10,  10,    1,  -10 }, // 'X'
+  {   478,   8,  10,   9,    0,  -10 }, // 'Y'
+  {   488,   8,  10,  10,    1,  -10 }, // 'Z'
+  {   498,   3,  13,   6,    1,  -11 }, // '['
+  {   503,   5,  11,   5,    0,  -10 }, // '\'
+  {   510,   3,  13,   6,    1,  -11 }, // ']'
+  {   515,   8,   4,  12,    2,  -10 }, // '^'
+  {   519,   7,   1,   7,    0,    2 }, // '_'
+  {   520,   2,   2,   7,    2,  -11 }, // '`'
+  {   521,   6,   8,   9,    1,   -8 }, // 'a'
+  {   527,   7,  10,   9,    1,  -10 }, // 'b'
+  {   536,   6,   8,   8,    1,   -8 }, // 'c'
+  {   542,   7,  10,   9,    1,  -10 }, // 'd'
+  {   551,   7,   8,   9,    1,   -8 }, // 'e'
+  {   558,   4,  11,   5,    1,  -11 }, // 'f'
+  {   564,   7,  11,   9,    1,   -8 }, // 'g'
+  {   574,   7,  10,   9,    1,  -10 }, // 'h'
+  {   583,   2,  10,   4,    1,  -10 }, // 'i'
+  {   586,   3,  13,   4,    0,  -10 }, // 'j'
+  {   591,   7,  10,   8,    1,  -10 }, // 'k'
+  {   600,   2,  10,   4,    1,  -10 }, // 'l'
+  {   603,  12,   8,  14,    1,   -8 }, // 'm'
+  {   615,   7,   8,   9,    1,   -8 }, // 'n'
+  {   622,   7,   8,   9,    1,   -8 }, // 'o'
+  {   629,   7,  11,   9,    1,   -8 }, // 'p'
+  {   639,   7,  11,   9,    1,   -8 }, // 'q'
+  {   649,   5,   8,   6,    1,   -8 }, // 'r'
+  {   654,   6,   8,   7,    1,   -8 }, // 's'
+  {   660,   4,  10,   6,    1,  -10 }, // 't'
+  {   665,   7,   8,   9,    1,   -8 }, // 'u'
+  {   672,   7,   8,   8,    1,   -8 }, // 'v'
+  {   679,  10,   8,  12,    1,   -8 }, // 'w'
+  {   689,   7,   8,   8,    1,   -8 }, // 'x'
+  {   696,   7,  11,   8,    1,   -8 }, // 'y'
+  {   706,   6,   8,   7,    1,   -8 }, // 'z'
+  {   712,   5,  13,   9,    2,  -11 }, // '{'
+  {   721,   1,  14,   5,    2,  -11 }, // '|'
+  {   723,   5,  13,   9,    2,  -11 }, // '}'
+  {   732,   8,   2,  12,    2,   -5 }, // '~'
+};
+
+const GFXfont FreeSans9pt7b PROGMEM = {
+  (uint8_t  *)FreeSans9pt7bBitmaps,
+  (GFXglyph *)FreeSans9pt7bGlyphs,
+  0x20, 0x7E, 17
+};
@@ -0,0 +1,253 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans-Bold.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSansBold12pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xC0, // '!'
+  0xCF, 0x3C, 0xF3, 0xCC, // '"'
+  0x02, 0x20, 0x31, 0x81, 0x98, 0x0C, 0xC7, 0xFF, 0xBF, 0xFC, 0x33, 0x01, 0x98, 0x7F, 0xF7, 0xFF,
+  0x9F, 0xFC, 0x33, 0x03, 0x18, 0x18, 0xC0, // '#'
+  0x04, 0x00, 0x80, 0xFF, 0x3F, 0xE7, 0x45, 0xC8, 0x1F, 0x83, 0xFC, 0x1F, 0xC0, 0xFC, 0x13, 0xE2,
+  0xFF, 0xFC, 0x7F, 0x01, 0x00, 0x20, 0x04, 0x00, // '$'
+  0x78, 0x18, 0x7E, 0x0C, 0x33, 0x8C, 0x18, 0xC6, 0x0C, 0x66, 0x06, 0x76, 0x01, 0xF3, 0x00, 0x03,
+  0x3E, 0x01, 0xBB, 0x81, 0x98, 0xC1, 0x8C, 0x60, 0xC6, 0x30, 0xC3, 0xB8, 0x60, 0xF8, // '%'
+  0x0F, 0xC0, 0x7F, 0x03, 0xCC, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x07, 0xF1, 0xDD, 0xE7, 0xE3, 0xFB,
+  0x87, 0xEF, 0x0F, 0x1E, 0x3C, 0x7F, 0xF8, 0xFE, 0xF0, // '&'
+  0xFF, 0xC0, // '''
+  0x3B, 0x9D, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x39, 0xC7, 0x10, // '('
+  0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x39, 0xCE, 0xF7, 0x3B, 0x9C, 0xC0, // ')'
+  0x18, 0x18, 0xDB, 0x7E, 0x3C, 0xFE, 0xDB, 0x18, 0x18, // '*'
+  0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06,
+  0x00, 0x60, // '+'
+  0x77, 0x77, 0x6E, 0xC0, // ','
+  0xFF, 0xFF, 0xC0, // '-'
+  0xFF, 0xF0, // '.'
+  0x06, 0x18, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x30, 0x60, // '/'
+  0x1F, 0x07, 0xF1, 0xEF, 0x78, 0xFF, 0x1F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFE, 0x3F, 0xC7, 0xBC,
+  0xE7, 0xFC, 0x3E, 0x00, // '0'
+  0x3C, 0x3F, 0x8F, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0xFF,
+  0xFF, 0xF0, // '1'
+  0x3F, 0x1F, 0xE7, 0x7C, 0x0F, 0x01, 0xC0, 0x70, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x81, 0xFF, 0xFF,
+  0xFF, 0xF0, // '2'
+  0x7F, 0x0F, 0xF9, 0xDF, 0x00, 0xE0, 0x1C, 0x07, 0x87, 0xC0, 0xFC, 0x03, 0xC0, 0x3C, 0x07, 0xE1,
+  0xEF, 0xFD, 0xFE, 0x00, // '3'
+  0x07, 0x80, 0xF0, 0x3E, 0x0F, 0xC1, 0xB8, 0x67, 0x1C, 0xE7, 0x1C, 0xC3, 0x9F, 0xFF, 0xFF, 0xFF,
+  0xF0, 0x38, 0x07, 0x00, // '4'
+  0x7F, 0xCF, 0xF9, 0xFF, 0x38, 0x07, 0x00, 0xFF, 0x1F, 0xF2, 0x1E, 0x01, 0xE0, 0x3C, 0x07, 0xE1,
+  0xEF, 0xFC, 0xFE, 0x00, // '5'
+  0x0F, 0xC7, 0xF8, 0xF3, 0x38, 0x07, 0x01, 0xFF, 0x3F, 0xF7, 0xCF, 0xF0, 0xFE, 0x1D, 0xC3, 0xBC,
+  0xF3, 0xFC, 0x3F, 0x00, // '6'
+  0xFF, 0xDF, 0xFF, 0xFF, 0x00, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x38, 0x0F, 0x01, 0xC0, 0x78, 0x0E,
+  0x03, 0xC0, 0x70, 0x00, // '7'
+  0x1F, 0x0F, 0xF9, 0xEF, 0x78, 0xF7, 0x1C, 0xF7, 0x8F, 0xE3, 0xFE, 0x71, 0xFE, 0x1F, 0xC3, 0xF8,
+  0xF7, 0xFC, 0x7F, 0x00, // '8'
+  0x1F, 0x0F, 0xF1, 0xCF, 0x78, 0xEE, 0x1F, 0xC3, 0xFC, 0x7B, 0xFF, 0x3F, 0xE0, 0x3C, 0x07, 0x21,
+  0xE7, 0xF8, 0xFE, 0x00, // '9'
+  0xFF, 0x80, 0x3F, 0xFC, // ':'
+  0x77, 0x70, 0x00, 0x77, 0x77, 0x7E, 0xC0, // ';'
+  0x00, 0x30, 0x1F, 0x0F, 0xE7, 0xF0, 0xF8, 0x0F, 0x00, 0x7E, 0x00, 0xFC, 0x03, 0xF0, 0x07, // '<'
+  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, // '='
+  0xC0, 0x0F, 0x80, 0x7F, 0x00, 0xFC, 0x01, 0xF0, 0x0F, 0x07, 0xE3, 0xF0, 0xF8, 0x0E, 0x00, // '>'
+  0x7E, 0x7F, 0xBB, 0xE0, 0xF0, 0x78, 0x78, 0x78, 0x38, 0x3C, 0x00, 0x00, 0x07, 0x83, 0xC1, 0xE0, // '?'
+  0x07, 0xF0, 0x1F, 0xFC, 0x38, 0x0E, 0x30, 0x07, 0x63, 0xF3, 0x47, 0xF1, 0xC6, 0x31, 0xC6, 0x31,
+  0xC6, 0x31, 0xC6, 0x33, 0x47, 0xFE, 0x63, 0xFC, 0x30, 0x00, 0x38, 0x08, 0x1F, 0x78, 0x07, 0xF0, // '@'
+  0x07, 0x80, 0x1F, 0x00, 0xFC, 0x03, 0xF8, 0x0E, 0xE0, 0x7B, 0x81, 0xCF, 0x0F, 0x1C, 0x3C, 0x70,
+  0xFF, 0xE7, 0xFF, 0x9F, 0xFF, 0x70, 0x3F, 0xC0, 0x70, // 'A'
+  0xFE, 0x1F, 0xFB, 0xFF, 0x70, 0xEE, 0x1D, 0xE7, 0xBF, 0xE7, 0xFE, 0xE1, 0xFC, 0x3F, 0x87, 0xF9,
+  0xFF, 0xFD, 0xFF, 0x00, // 'B'
+  0x0F, 0xC1, 0xFF, 0x7F, 0xF7, 0x80, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x78,
+  0x07, 0xC7, 0x3F, 0xF0, 0xFE, // 'C'
+  0xFE, 0x07, 0xFE, 0x3F, 0xF9, 0xC3, 0xEE, 0x0F, 0x70, 0x3B, 0x81, 0xFC, 0x0F, 0xE0, 0x7F, 0x07,
+  0xB8, 0x3D, 0xFF, 0xCF, 0xFC, 0x7F, 0x80, // 'D'
+  0xFF, 0xFF, 0xFF, 0xFC, 0x0E, 0x07, 0xFB, 0xFF, 0xFF, 0xE0, 0x70, 0x38, 0x1F, 0xFF, 0xFF, 0xFC, // 'E'
+  0xFF, 0xFF, 0xFF, 0xFC, 0x0E, 0x07, 0xFB, 0xFF, 0xFF, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x00, // 'F'
+  0x0F, 0xE0, 0xFF, 0xDF, 0xFE, 0xF0, 0x0F, 0x00, 0x78, 0x03, 0xC3, 0xFE, 0x1F, 0xF0, 0xFF, 0x81,
+  0xDE, 0x0E, 0xF8, 0xF3, 0xFF, 0x87, 0xF8, // 'G'
+  0xE0, 0x7E, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFE, 0x0F, 0xE0,
+  0xFE, 0x0F, 0xE0, 0xFE, 0x0F, // 'H'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'I'
+  0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x73, 0xFF, 0xFB, 0x80, // 'J'
+  0xE0, 0xF7, 0x0F, 0x38, 0xF1, 0xCF, 0x0E, 0xF0, 0x7F, 0x03, 0xF0, 0x1F, 0xC0, 0xFF, 0x07, 0x7C,
+  0x39, 0xF1, 0xC7, 0xCE, 0x1F, 0x70, 0x7C, // 'K'
+  0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1F, 0xFF, 0xFF, 0xFC, // 'L'
+  0xF0, 0x1F, 0xF0, 0x7F, 0xE0, 0xFF, 0xE3, 0xFF, 0xC7, 0xFD, 0x9D, 0xFB, 0xBB, 0xF3, 0xE7, 0xE7,
+  0xCF, 0xCF, 0x1F, 0x8E, 0x3F, 0x00, 0x7E, 0x00, 0xFC, 0x01, 0xC0, // 'M'
+  0xF0, 0x7F, 0x07, 0xF8, 0x7F, 0x87, 0xFC, 0x7F, 0xC7, 0xEE, 0x7E, 0x67, 0xE7, 0x7E, 0x3F, 0xE3,
+  0xFE, 0x1F, 0xE1, 0xFE, 0x0F, // 'N'
+  0x0F, 0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xF7, 0x87, 0x9F, 0x3E, 0x3F, 0xF0, 0x7F, 0x80, // 'O'
+  0xFF, 0x1F, 0xFB, 0xFF, 0x70, 0xFE, 0x1F, 0xC3, 0xF8, 0xFF, 0xFE, 0xFF, 0x9C, 0x03, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x00, // 'P'
+  0x0F, 0xC0, 0xFF, 0xC7, 0xFF, 0x9E, 0x1E, 0xF0, 0x3F, 0xC0, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F,
+  0xC0, 0xF7, 0x07, 0x9F, 0x3E, 0x3F, 0xF0, 0x7F, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0x70, // 'Q'
+  0xFE, 0x0F, 0xF8, 0xFF, 0xCE, 0x3C, 0xE1, 0xCE, 0x1C, 0xFF, 0xCF, 0xF0, 0xFF, 0x8E, 0x3C, 0xE1,
+  0xCE, 0x1E, 0xE0, 0xEE, 0x0F, // 'R'
+  0x1F, 0x8F, 0xF9, 0xFF, 0x78, 0x0F, 0x00, 0xF8, 0x1F, 0xE1, 0xFE, 0x07, 0xE0, 0x1C, 0x03, 0xF8,
+  0xFF, 0xFC, 0xFF, 0x00, // 'S'
+  0xFF, 0xF7, 0xFF, 0xFF, 0xFE, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x38,
+  0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, // 'T'
+  0xE0, 0xEE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x0E, 0xF0,
+  0xEF, 0x9E, 0x7F, 0xC3, 0xF8, // 'U'
+  0xF0, 0x1D, 0xC0, 0xF7, 0x03, 0xDE, 0x0E, 0x38, 0x78, 0xF1, 0xE3, 0xC7, 0x07, 0x3C, 0x1E, 0xE0,
+  0x3B, 0x80, 0xFE, 0x03, 0xF0, 0x07, 0xC0, 0x1F, 0x00, // 'V'
+  0xE0, 0xE0, 0xFC, 0x3C, 0x1F, 0x87, 0xC7, 0xF8, 0xF8, 0xE7, 0x1F, 0x1C, 0xE7, 0x63, 0x9C, 0xEE,
+  0xF3, 0xD9, 0xDC, 0x3B, 0x1B, 0x87, 0xE3, 0xF0, 0xFC, 0x7E, 0x1F, 0x0F, 0xC3, 0xE1, 0xF0, 0x3C,
+  0x1E, 0x00, // 'W'
+  0xE0, 0x77, 0x87, 0x9E, 0x38, 0x73, 0xC3, 0xFC, 0x0F, 0xC0, 0x3E, 0x01, 0xF0, 0x1F, 0x81, 0xFE,
+  0x0E, 0x78, 0xF1, 0xCF, 0x0F, 0x70, 0x3C, // 'X'
+  0xF0, 0x3B, 0x83, 0xDE, 0x1C, 0x79, 0xE1, 0xDE, 0x0F, 0xE0, 0x3F, 0x00, 0xF0, 0x07, 0x80, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, // 'Y'
+  0xFF, 0xEF, 0xFF, 0xFF, 0xE0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x1E, 0x03, 0xC0, 0x78,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, // 'Z'
+  0xFF, 0xF9, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0xFF, 0xF8, // '['
+  0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C, 0x18, 0x18, 0x30, 0x60, 0x60, 0xC1, 0x83, 0x03, // '\'
+  0xFF, 0xF1, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x77, 0xFF, 0x78, // ']'
+  0x0C, 0x07, 0x83, 0xF1, 0xCE, 0xC1, 0xC0, // '^'
+  0xFF, 0x80, // '_'
+  0xE7, 0x30, // '`'
+  0x0C, 0x1F, 0xE7, 0xFC, 0x07, 0x1F, 0xDF, 0xFF, 0x1F, 0x87, 0xE3, 0xFF, 0xF7, 0xDC, // 'a'
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0xF9, 0xFF, 0xBC, 0x77, 0x0E, 0xE1, 0xFC, 0x3F, 0x87, 0x79,
+  0xEF, 0xFD, 0xDF, 0x00, // 'b'
+  0x04, 0x1F, 0xDF, 0xFE, 0x0E, 0x07, 0x03, 0x81, 0xE0, 0xF8, 0xBF, 0xCF, 0xE0, // 'c'
+  0x00, 0xE0, 0x1C, 0x03, 0x80, 0x73, 0xFE, 0xFF, 0xFC, 0x7F, 0x0F, 0xE0, 0xFC, 0x1F, 0xC7, 0xF8,
+  0xF7, 0xFE, 0x7D, 0xC0, // 'd'
+  0x04, 0x07, 0xF1, 0xFF, 0x78, 0xEE, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x4F, 0xF8, 0xFF, 0x00, // 'e'
+  0x1F, 0x3F, 0x38, 0x3C, 0xFF, 0xFF, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, // 'f'
+  0x3F, 0xEF, 0xFF, 0xC7, 0xF0, 0xFE, 0x0F, 0xC1, 0xFC, 0x7F, 0xDF, 0x7F, 0xE7, 0x9C, 0x07, 0xA1,
+  0xE7, 0xFC, 0xFE, 0x00, // 'g'
+  0xE0, 0x38, 0x0E, 0x03, 0x88, 0xEF, 0xBF, 0xFF, 0x3F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
+  0xF8, 0x70, // 'h'
+  0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, // 'i'
+  0x1C, 0x70, 0x00, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xCF, 0xFB, 0xC0, // 'j'
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE3, 0xF9, 0xEE, 0xF3, 0xF0, 0xFC, 0x3F, 0x0E, 0xE3, 0x9C, 0xE7,
+  0xB8, 0xF0, // 'k'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'l'
+  0x00, 0x08, 0xEF, 0x3E, 0xFF, 0xFF, 0xF3, 0xCF, 0xE3, 0xC7, 0xE3, 0xC7, 0xE3, 0x87, 0xE3, 0x87,
+  0xE3, 0x87, 0xE3, 0x87, 0xE3, 0x87, // 'm'
+  0x02, 0x3B, 0xEF, 0xFF, 0xCF, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1C, // 'n'
+  0x04, 0x07, 0xF1, 0xFF, 0x78, 0xFE, 0x0F, 0xC1, 0xF8, 0x3F, 0x0F, 0xF1, 0xEF, 0xF8, 0xFE, 0x00, // 'o'
+  0xEF, 0x9F, 0xFB, 0xC7, 0x70, 0xEE, 0x1F, 0xC3, 0xF8, 0x77, 0x9E, 0xFF, 0xDD, 0xF3, 0x80, 0x70,
+  0x0E, 0x01, 0xC0, 0x00, // 'p'
+  0x3F, 0xEF, 0xFF, 0xC7, 0xF0, 0xFE, 0x0F, 0xC1, 0xFC, 0x7F, 0x8F, 0x7F, 0xE7, 0xDC, 0x03, 0x80,
+  0x70, 0x0E, 0x01, 0xC0, // 'q'
+  0x03, 0xDF, 0xFF, 0x8E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x80, // 'r'
+  0x08, 0x3F, 0xFF, 0xFC, 0x0F, 0x07, 0xF8, 0xFE, 0x07, 0x83, 0xFF, 0xFF, 0xC0, // 's'
+  0x38, 0x1C, 0x0E, 0x1F, 0xFF, 0xF9, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0F, 0x07, 0xE1, 0xF0, // 't'
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE3, 0xFC, 0x7B, 0x9F, 0x7F, 0xE7, 0x9C, // 'u'
+  0xE1, 0xFC, 0x3B, 0xC7, 0x39, 0xC7, 0x38, 0x77, 0x0F, 0xC1, 0xF8, 0x1F, 0x03, 0xC0, // 'v'
+  0xE3, 0x8F, 0xE3, 0x8E, 0xF3, 0xCE, 0x77, 0xCE, 0x76, 0xDC, 0x76, 0xDC, 0x7E, 0x7C, 0x3E, 0x7C,
+  0x3C, 0x78, 0x3C, 0x78, // 'w'
+  0xE1, 0xDC, 0xE3, 0xF8, 0xFC, 0x1E, 0x07, 0xC3, 0xF1, 0xEE, 0xF3, 0xF8, 0x70, // 'x'
+  0xE1, 0xFC, 0x3B, 0xC7, 0x39, 0xC7, 0x38, 0x77, 0x0F, 0xC0, 0xF8, 0x1F, 0x03, 0xC0, 0x38, 0x0E,
+  0x07, 0xC0, 0xF0, 0x00, // 'y'
+  0xFF, 0xFF, 0xC1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE1, 0xE0, 0xFF, 0xFF, 0xC0, // 'z'
+  0x0F, 0x8F, 0xC7, 0x83, 0x81, 0xC0, 0xE0, 0x70, 0xF8, 0xF8, 0x3E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x78, 0x1F, 0x0F, 0x80, // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '|'
+  0xF8, 0x7E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x1F, 0x0F, 0x8F, 0x87, 0x03, 0x81, 0xC0, 0xE0,
+  0x71, 0xF8, 0xF8, 0x00, // '}'
+  0x10, 0x0F, 0xE3, 0xFF, 0xF8, 0x1C, // '~'
+};
+
+const GFXglyph FreeSansBold12pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    0 }, // ' '
+  {     0,   3,  14,   9,    3,  -14 }, // '!'
+  {     6,   6,   5,  10,    2,  -14 }, // '"'
+  {    10,  13,  14,  16,    1,  -14 }, // '#'
+  {    33,  11,  17,  13,    1,  -14 }, // '$'
+  {    57,  17,  14,  19,    1,  -14 }, // '%'
+  {    87,  14,  14,  16,    1,  -14 }, // '&'
+  {   112,   2,   5,   6,    2,  -14 }, // '''
+  {   114,   5,  17,   9,    2,  -14 }, // '('
+  {   125,   5,  17,   9,    2,  -14 }, // ')'
+  {   136,   8,   9,  10,    1,  -14 }, // '*'
+  {   145,  12,  12,  16,    2,  -12 }, // '+'
+  {   163,   4,   7,   7,    1,   -4 }, // ','
+  {   167,   6,   3,   8,    1,   -7 }, // '-'
+  {   170,   3,   4,   7,    2,   -4 }, // '.'
+  {   172,   7,  16,   7,    0,  -14 }, // '/'
+  {   186,  11,  14,  13,    1,  -14 }, // '0'
+  {   206,  10,  14,  13,    2,  -14 }, // '1'
+  {   224,  10,  14,  13,    1,  -14 }, // '2'
+  {   242,  11,  14,  13,    1,  -14 }, // '3'
+  {   262,  11,  14,  13,    1,  -14 }, // '4'
+  {   282,  11,  14,  13,    1,  -14 }, // '5'
+  {   302,  11,  14,  13,    1,  -14 }, // '6'
+  {   322,  11,  14,  13,    1,  -14 }, // '7'
+  {   342,  11,  14,  13,    1,  -14 }, // '8'
+  {   362,  11,  14,  13,    1,  -14 }, // '9'
+  {   382,   3,  10,   8,    2,  -10 }, // ':'
+  {   386,   4,  13,   8,    1,  -10 }, // ';'
+  {   393,  12,  10,  16,    2,  -11 }, // '<'
+  {   408,  12,   6,  16,    2,   -9 }, // '='
+  {   417,  12,  10,  16,    2,  -11 }, // '>'
+  {   432,   9,  14,  11,    1,  -14 }, // '?'
+  {   448,  16,  16,  19,    1,  -13 }, // '@'
+  {   480,  14,  14,  15,    0,  -14 }, // 'A'
+  {   505,  11,  14,  14,    2,  -14 }, // 'B'
+  {   525,  12,  14,  14,    1,  -14 }, // 'C'
+  {   546,  13,  14,  16,    2,  -14 }, // 'D'
+  {   569,   9,  14,  13,    2,  -14 }, // 'E'
+  {   585,   9,  14,  13,    2,  -14 }, // 'F'
+  {   601,  13,  14,  15,    1,  -14 }, // 'G'
+  {   624,  12,  14,  16,    2,  -14 }, // 'H'
+  {   645,   3,  14,   7,    2,  -14 }, // 'I'
+  {   651,   6,  18,   7,   -1,  -14 }, // 'J'
+  {   665,  13,  14,  15,    2,  -14 }, // 'K'
+  {   688,   9,  14,  12,    2,  -14 }, // 'L'
+  {   704,  15,  14,  19,    2,  -14 }, // 'M'
+  {   731,  12,  14,  16,    2,  -14 }, // 'N'
+  {   752,  14,  14,  16,    1,  -14 }, // 'O'
+  {   777,  11,  14,  14,    2,  -14 }, // 'P'
+  {   797,  14,  17,  16,    1,  -14 }, // 'Q'
+  {   827,  12,  14,  14,    2,  -14 }, // 'R'
+  {   848,  11,  14,  14,    1,  -14 }, // 'S'
+  {   868,  13,  14,  13,    0,  -14 }, // 'T'
+  {   891,  12,  14,  15,    2,  -14 }, // 'U'
+  {   912,  14,  14,  15,    0,  -14 }, // 'V'
+  {   937,  19,  14,  21,    1,  -14 }, // 'W'
+  {   971,  13,  14,  14,    1,  -14 }, // 'X'
+  {   994,  13,  14,  14,    0,  -14 }, // 'Y'
+  {  1017,  12,  14,  14,    1,  -14 }, // 'Z'
+  {  1038,   5,  17,   9,    2,  -14 }, // '['
+  {  1049,   7,  16,   7,    0,  -14 }, // '\'
+  {  1063,   6,  17,   9,    1,  -14 }, // ']'
+  {  1076,  10,   5,  16,    3,  -14 }, // '^'
+  {  1083,   9,   1,   9,    0,    3 }, // '_'
+  {  1085,   4,   3,   9,    1,  -15 }, // '`'
+  {  1087,  10,  11,  13,    1,  -11 }, // 'a'
+  {  1101,  11,  14,  13,    2,  -14 }, // 'b'
+  {  1121,   9,  11,  11,    1,  -11 }, // 'c'
+  {  1134,  11,  14,  13,    1,  -14 }, // 'd'
+  {  1154,  11,  11,  13,    1,  -11 }, // 'e'
+  {  1170,   8,  14,   8,    0,  -14 }, // 'f'
+  {  1184,  11,  14,  13,    1,  -10 }, // 'g'
+  {  1204,  10,  14,  13,    2,  -14 }, // 'h'
+  {  1222,   3,  14,   6,    2,  -14 }, // 'i'
+  {  1228,   6,  18,   6,   -1,  -14 }, // 'j'
+  {  1242,  10,  14,  13,    2,  -14 }, // 'k'
+  {  1260,   3,  14,   6,    2,  -14 }, // 'l'
+  {  1266,  16,  11,  20,    2,  -11 }, // 'm'
+  {  1288,  10,  11,  13,    2,  -11 }, // 'n'
+  {  1302,  11,  11,  13,    1,  -11 }, // 'o'
+  {  1318,  11,  14,  13,    2,  -10 }, // 'p'
+  {  1338,  11,  14,  13,    1,  -10 }, // 'q'
+  {  1358,   7,  11,   9,    2,  -11 }, // 'r'
+  {  1368,   9,  11,  11,    1,  -11 }, // 's'
+  {  1381,   9,  13,   9,    0,  -13 }, // 't'
+  {  1396,  11,  10,  13,    1,  -10 }, // 'u'
+  {  1410,  11,  10,  12,    1,  -10 }, // 'v'
+  {  1424,  16,  10,  17,    1,  -10 }, // 'w'
+  {  1444,  10,  10,  12,    1,  -10 }, // 'x'
+  {  1457,  11,  14,  12,    1,  -10 }, // 'y'
+  {  1477,   9,  10,  11,    1,  -10 }, // 'z'
+  {  1489,   9,  17,  13,    2,  -14 }, // '{'
+  {  1509,   2,  18,   7,    2,  -14 }, // '|'
+  {  1514,   9,  17,  13,    2,  -14 }, // '}'
+  {  1534,  12,   4,  16,    2,   -8 }, // '~'
+};
+
+const GFXfont FreeSansBold12pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold12pt7bBitmaps,
+  (GFXglyph *)FreeSansBold12pt7bGlyphs,
+  0x20, 0x7E, 22
+};
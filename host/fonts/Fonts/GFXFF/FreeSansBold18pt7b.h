@@ -0,0 +1,363 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans-Bold.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSansBold18pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0x80, // '!'
+  0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, // '"'
+  0x01, 0xC3, 0x80, 0x1C, 0x38, 0x01, 0xC3, 0x80, 0x1C, 0x70, 0x03, 0x87, 0x03, 0xFF, 0xFF, 0x7F,
+  0xFF, 0xF7, 0xFF, 0xFF, 0x07, 0x0E, 0x00, 0x70, 0xE0, 0x07, 0x1E, 0x00, 0xF1, 0xC0, 0xFF, 0xFF,
+  0xCF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0xE3, 0x80, 0x1C, 0x38, 0x01, 0xC3, 0x80, 0x1C, 0x38, 0x01,
+  0xC7, 0x00, // '#'
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x1F, 0xFC, 0x3F, 0xFC, 0x7F, 0xFC, 0xF9, 0x84, 0xF9, 0x80,
+  0xF9, 0x80, 0xFF, 0x80, 0x7F, 0xF0, 0x7F, 0xFC, 0x1F, 0xFE, 0x03, 0xFE, 0x01, 0x9F, 0x01, 0x9F,
+  0x81, 0x9F, 0xF1, 0xBE, 0xFF, 0xFE, 0xFF, 0xFC, 0x1F, 0xF0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0x01, 0x80, // '$'
+  0x1F, 0x00, 0x38, 0x1F, 0xE0, 0x1C, 0x07, 0xBC, 0x07, 0x03, 0xC7, 0x83, 0x80, 0xE1, 0xE1, 0xC0,
+  0x38, 0x78, 0x70, 0x0E, 0x1E, 0x38, 0x03, 0xC7, 0x8E, 0x00, 0x71, 0xC7, 0x00, 0x1F, 0xF3, 0x80,
+  0x03, 0xF0, 0xE1, 0xE0, 0x00, 0x71, 0xFE, 0x00, 0x1C, 0xFF, 0xC0, 0x0E, 0x38, 0xF0, 0x07, 0x1E,
+  0x1C, 0x01, 0xC7, 0x87, 0x00, 0xE1, 0xE1, 0xC0, 0x38, 0x38, 0x70, 0x1C, 0x0F, 0x3C, 0x0E, 0x03,
+  0xFE, 0x03, 0x80, 0x3F, 0x00, // '%'
+  0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x80, 0x3F, 0x3C, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0x7C, 0x00, 0x01, 0xF0, 0x00, 0x1F, 0xC0, 0x01, 0xFF, 0x07, 0x9F, 0xFC, 0x3D, 0xF3, 0xF1, 0xEF,
+  0x8F, 0xDF, 0x7C, 0x3F, 0xF3, 0xC0, 0xFF, 0x9F, 0x03, 0xF8, 0xF8, 0x1F, 0xC7, 0xF1, 0xFE, 0x1F,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0x1F, 0x80, // '&'
+  0xFF, 0xFF, 0xFF, // '''
+  0x0F, 0x1F, 0x1E, 0x3E, 0x3C, 0x3C, 0x7C, 0x7C, 0x78, 0x78, 0x78, 0xF8, 0xF8, 0xF8, 0x78, 0x78,
+  0x7C, 0x7C, 0x3C, 0x3C, 0x3E, 0x1E, 0x1F, 0x0F, 0x07, // '('
+  0xF1, 0xE1, 0xE3, 0xC7, 0xC7, 0x8F, 0x9F, 0x3E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x3E, 0x7C,
+  0xF1, 0xE7, 0xCF, 0x3E, 0x78, 0xE0, // ')'
+  0x07, 0x00, 0x38, 0x01, 0xC1, 0xCE, 0x7F, 0xFF, 0x9F, 0xF0, 0x3E, 0x07, 0xF8, 0x7F, 0xF7, 0x3B,
+  0xE1, 0xC4, 0x0E, 0x00, 0x70, 0x00, // '*'
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00,
+  0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00,
+  0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, // '+'
+  0x7D, 0xF7, 0xDF, 0x7B, 0xEF, 0x38, 0xE0, // ','
+  0xFF, 0xFF, 0xFF, 0xFF, // '-'
+  0xFF, 0xFF, 0xFF, 0x80, // '.'
+  0x00, 0xC0, 0x70, 0x1C, 0x0E, 0x03, 0x80, 0xE0, 0x70, 0x1C, 0x07, 0x03, 0x80, 0xE0, 0x38, 0x1E,
+  0x07, 0x01, 0xC0, 0x70, 0x38, 0x0E, 0x03, 0x81, 0xC0, 0x70, 0x1C, 0x0E, 0x03, 0x80, // '/'
+  0x03, 0xF0, 0x07, 0xFE, 0x07, 0xFF, 0x87, 0xFF, 0xE3, 0xE1, 0xF3, 0xE0, 0xF9, 0xF0, 0x3E, 0xF8,
+  0x1F, 0xFC, 0x0F, 0xFE, 0x07, 0xFF, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0xFB, 0xE0, 0x7D, 0xF0, 0x3E,
+  0xF8, 0x3F, 0x7E, 0x1F, 0x1F, 0x9F, 0x8F, 0xFF, 0x83, 0xFF, 0x80, 0x7F, 0x80, // '0'
+  0x07, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0E, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07,
+  0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0,
+  0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // '1'
+  0x1F, 0xE1, 0xFF, 0xF3, 0xFF, 0xF7, 0xFF, 0xEE, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x1F, 0x00,
+  0x7E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x7E, 0x01, 0xF8, 0x07, 0xE0, 0x1F, 0x80, 0x7E, 0x01,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // '2'
+  0x1F, 0xE0, 0xFF, 0xF1, 0xFF, 0xF3, 0xFF, 0xF4, 0x07, 0xE0, 0x0F, 0xC0, 0x0F, 0x80, 0x3E, 0x00,
+  0xFC, 0x3F, 0xE0, 0x7F, 0xE0, 0xFF, 0xE0, 0x0F, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3F,
+  0xC1, 0xFF, 0xFF, 0xF7, 0xFF, 0xCF, 0xFF, 0x00, // '3'
+  0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x3F, 0xE0, 0x3D, 0xF0, 0x1E,
+  0xF8, 0x1E, 0x7C, 0x1E, 0x3E, 0x0F, 0x1F, 0x0F, 0x0F, 0x8F, 0x07, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, // '4'
+  0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0xFC, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x7F, 0xC0,
+  0x7F, 0xF8, 0x7F, 0xFC, 0x7F, 0xFE, 0x40, 0x7E, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x3F,
+  0x80, 0x3E, 0xF0, 0xFE, 0xFF, 0xFC, 0xFF, 0xF8, 0x7F, 0xF0, // '5'
+  0x03, 0xF8, 0x0F, 0xFE, 0x1F, 0xFE, 0x3F, 0xFE, 0x7E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0xC0,
+  0xFF, 0xF8, 0xFF, 0xFC, 0xFF, 0xFE, 0xFC, 0x3F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0x7C, 0x1F, 0x7C, 0x3E, 0x3F, 0xFE, 0x1F, 0xFC, 0x0F, 0xF0, // '6'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xE0, 0x0F, 0x80, 0x1F, 0x00, 0x7E, 0x00,
+  0xF8, 0x03, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3E, 0x00, 0x7C, 0x01, 0xF0, 0x03, 0xE0, 0x0F, 0x80,
+  0x1F, 0x00, 0x7E, 0x00, 0xF8, 0x03, 0xF0, 0x00, // '7'
+  0x0F, 0xE0, 0x3F, 0xFC, 0x7F, 0xFE, 0x7E, 0x7E, 0xFC, 0x3E, 0xF8, 0x3E, 0xF8, 0x3E, 0x7C, 0x3E,
+  0x7F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x7F, 0xFC, 0xFC, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x3F, 0x7F, 0xFE, 0x7F, 0xFC, 0x1F, 0xF8, // '8'
+  0x07, 0xE0, 0x0F, 0xFC, 0x0F, 0xFF, 0x0F, 0xEF, 0xC7, 0xC1, 0xF3, 0xE0, 0xF9, 0xF0, 0x7D, 0xF8,
+  0x3F, 0x7C, 0x1F, 0xBE, 0x0F, 0xDF, 0x9F, 0xE7, 0xFF, 0xF1, 0xFF, 0xF8, 0x7E, 0x7C, 0x00, 0x7C,
+  0x00, 0x3E, 0x00, 0x3F, 0x18, 0x3F, 0x0F, 0xFF, 0x07, 0xFF, 0x03, 0xFF, 0x00, // '9'
+  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE0, // ':'
+  0x7D, 0xF7, 0xDF, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xDF, 0x7D, 0xF7, 0xDE, 0xF3, 0xCE, 0x00, // ';'
+  0x00, 0x03, 0xC0, 0x07, 0xF0, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x0F, 0xC0, 0x03,
+  0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xF8, 0x00, 0x7F, 0xC0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x01, 0xF0,
+  0x00, 0x0C, // '<'
+  0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '='
+  0x80, 0x00, 0x3C, 0x00, 0x0F, 0xC0, 0x03, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x80, 0x0F, 0xF8,
+  0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x1F, 0xF0, 0x3F, 0xF0, 0x3F, 0xE0, 0x7F, 0xC0, 0x3F, 0x80, 0x0F,
+  0x80, 0x03, 0x00, 0x00, // '>'
+  0x3F, 0x87, 0xFF, 0x3F, 0xFD, 0xFF, 0xEC, 0x1F, 0x00, 0x7C, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x3F,
+  0x03, 0xF0, 0x3F, 0x01, 0xF0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E,
+  0x01, 0xF0, 0x00, // '?'
+  0x00, 0x7E, 0x00, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x0F, 0x00, 0xF8, 0x1E, 0x00, 0x3C, 0x38,
+  0x00, 0x1E, 0x70, 0x10, 0x0E, 0x70, 0xFD, 0xC7, 0x60, 0xFF, 0xC7, 0xE1, 0xE3, 0xC7, 0xE1, 0xC3,
+  0xC3, 0xC3, 0xC1, 0xC3, 0xC3, 0x81, 0xC7, 0xC3, 0xC1, 0xC7, 0xE1, 0xC3, 0xC7, 0xE1, 0xC3, 0xCE,
+  0xE1, 0xFF, 0xFC, 0x70, 0xFF, 0xF8, 0x70, 0x39, 0xE0, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x20, 0x0F,
+  0x00, 0xF0, 0x07, 0xFF, 0xF0, 0x03, 0xFF, 0xC0, 0x00, 0x7E, 0x00, // '@'
+  0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0x80, 0x03, 0xFF, 0x00, 0x0F, 0xFC,
+  0x00, 0x3D, 0xF0, 0x01, 0xF3, 0xE0, 0x07, 0xCF, 0x80, 0x3E, 0x3E, 0x00, 0xF8, 0x7C, 0x03, 0xE1,
+  0xF0, 0x1F, 0x07, 0xE0, 0x7F, 0xFF, 0x81, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF1, 0xF8,
+  0x07, 0xC7, 0xC0, 0x1F, 0x9F, 0x00, 0x3E, 0xFC, 0x00, 0xFC, // 'A'
+  0xFF, 0x80, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3F, 0xF8, 0x3E,
+  0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFE, 0xF8, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF0, // 'B'
+  0x00, 0xFE, 0x01, 0xFF, 0xF0, 0xFF, 0xFC, 0x7F, 0xFF, 0x3F, 0x81, 0xCF, 0xC0, 0x17, 0xE0, 0x01,
+  0xF0, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07,
+  0xE0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0xCF, 0xF9, 0xF1, 0xFF, 0xFC, 0x1F, 0xFF, 0x03, 0xFF, 0x00, // 'C'
+  0xFF, 0x00, 0x1F, 0xFF, 0x03, 0xFF, 0xF8, 0x7F, 0xFF, 0x8F, 0x8F, 0xF9, 0xF0, 0x3F, 0xBE, 0x03,
+  0xF7, 0xC0, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFC, 0x03, 0xFF, 0x80, 0x7F, 0xF0,
+  0x0F, 0xFE, 0x03, 0xF7, 0xC0, 0x7E, 0xF8, 0x3F, 0x9F, 0xFF, 0xF3, 0xFF, 0xFC, 0x7F, 0xFE, 0x0F,
+  0xFE, 0x00, // 'D'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFB,
+  0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // 'E'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xFF, 0xFB,
+  0xFF, 0xEF, 0xFF, 0xBF, 0xFE, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F,
+  0x80, 0x3E, 0x00, 0xF8, 0x00, // 'F'
+  0x00, 0xFF, 0x00, 0x7F, 0xFE, 0x0F, 0xFF, 0xE1, 0xFF, 0xFE, 0x3F, 0x80, 0xE3, 0xF0, 0x00, 0x7E,
+  0x00, 0x07, 0xC0, 0x00, 0x7C, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x0F, 0xFF, 0xC0, 0xFF, 0x7C, 0x0F,
+  0xF7, 0xC0, 0x1F, 0x7E, 0x01, 0xF7, 0xE0, 0x1F, 0x3F, 0x01, 0xF3, 0xFE, 0x7F, 0x1F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0x03, 0xFF, 0x80, // 'G'
+  0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F,
+  0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 0xFE, 0x01, 0xFF,
+  0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xFE, 0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x1F, 0xF8, 0x07, 0xC0, // 'H'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, // 'I'
+  0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x07,
+  0xC1, 0xF0, 0x7C, 0x1F, 0x07, 0xC1, 0xF0, 0x7C, 0x1F, 0x0F, 0xC3, 0xF3, 0xFB, 0xFE, 0xFF, 0x3F,
+  0x87, 0x00, // 'J'
+  0xF8, 0x07, 0xDF, 0x03, 0xFB, 0xE0, 0xFE, 0x7C, 0x3F, 0x8F, 0x8F, 0xE1, 0xF3, 0xF8, 0x3E, 0xFE,
+  0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xE0, 0x0F, 0xFE, 0x01, 0xFF,
+  0xE0, 0x3E, 0x7E, 0x07, 0xC7, 0xE0, 0xF8, 0x7E, 0x1F, 0x07, 0xE3, 0xE0, 0x7E, 0x7C, 0x07, 0xEF,
+  0x80, 0x7E, // 'K'
+  0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x00, 0xF8, 0x03, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // 'L'
+  0xFC, 0x00, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x0F,
+  0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFF, 0xFB, 0xCF, 0x7F, 0xEF, 0x3D, 0xFF, 0x9F, 0xF7, 0xFE, 0x7F,
+  0x9F, 0xF9, 0xFE, 0x7F, 0xE3, 0xF1, 0xFF, 0x8F, 0xC7, 0xFE, 0x1E, 0x1F, 0xF8, 0x78, 0x7F, 0xE0,
+  0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xF8, 0x00, 0x7C, // 'M'
+  0xF8, 0x07, 0xFF, 0x01, 0xFF, 0xE0, 0x7F, 0xF8, 0x1F, 0xFF, 0x07, 0xFF, 0xC1, 0xFF, 0xF8, 0x7F,
+  0xFE, 0x1F, 0xFF, 0xC7, 0xFE, 0xF1, 0xFF, 0x9E, 0x7F, 0xE7, 0x9F, 0xF8, 0xF7, 0xFE, 0x3D, 0xFF,
+  0x87, 0xFF, 0xE1, 0xFF, 0xF8, 0x3F, 0xFE, 0x0F, 0xFF, 0x81, 0xFF, 0xE0, 0x7F, 0xF8, 0x0F, 0xC0, // 'N'
+  0x01, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0x87, 0xF1, 0xF8, 0x07,
+  0xE7, 0xE0, 0x1F, 0x9F, 0x00, 0x3E, 0x7C, 0x00, 0xFB, 0xF0, 0x03, 0xEF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xE7, 0xE0, 0x1F, 0x9F, 0x80, 0x7E, 0x3F, 0x03, 0xF0, 0xFF,
+  0x3F, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, // 'O'
+  0xFF, 0xC0, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFF, 0xF8, 0x7F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF0, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, // 'P'
+  0x01, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0x87, 0xF1, 0xF8, 0x07,
+  0xE7, 0xE0, 0x1F, 0x9F, 0x00, 0x3E, 0x7C, 0x00, 0xFB, 0xF0, 0x03, 0xFF, 0xC0, 0x0F, 0xFF, 0x00,
+  0x3F, 0x7C, 0x00, 0xF9, 0xF0, 0x03, 0xE7, 0xC0, 0x1F, 0x9F, 0x80, 0x7E, 0x3F, 0x03, 0xF0, 0xFF,
+  0x3F, 0xC1, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00,
+  0x01, 0xF8, 0x00, 0x03, 0xE0, // 'Q'
+  0xFF, 0x80, 0x3F, 0xFE, 0x0F, 0xFF, 0xC3, 0xFF, 0xF8, 0xF8, 0x7E, 0x3E, 0x0F, 0xCF, 0x83, 0xF3,
+  0xE0, 0xF8, 0xF8, 0x3E, 0x3E, 0x3F, 0x0F, 0xFF, 0x83, 0xFF, 0xC0, 0xFF, 0xF8, 0x3E, 0x3F, 0x0F,
+  0x87, 0xE3, 0xE0, 0xF8, 0xF8, 0x3F, 0x3E, 0x07, 0xCF, 0x81, 0xFB, 0xE0, 0x3E, 0xF8, 0x0F, 0xC0, // 'R'
+  0x0F, 0xF0, 0x3F, 0xFE, 0x7F, 0xFE, 0x7F, 0xFE, 0xFC, 0x0E, 0xF8, 0x00, 0xF8, 0x00, 0xFC, 0x00,
+  0xFF, 0x80, 0x7F, 0xF8, 0x3F, 0xFE, 0x1F, 0xFE, 0x03, 0xFF, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F,
+  0xC0, 0x1F, 0xFC, 0x7F, 0xFF, 0xFE, 0xFF, 0xFC, 0x3F, 0xF8, // 'S'
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x80, 0x03, 0xE0, 0x00, 0x7C,
+  0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03,
+  0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+  0x1F, 0x00, // 'T'
+  0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xFC, 0x1F, 0xBF, 0xFF, 0x9F, 0xFF, 0xC7, 0xFF, 0xC0, 0xFF, 0x80, // 'U'
+  0xF0, 0x00, 0xFF, 0x80, 0x1F, 0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0x7C, 0x03, 0xE7, 0xC0, 0x3E, 0x7E,
+  0x07, 0xC3, 0xE0, 0x7C, 0x3E, 0x0F, 0xC3, 0xF0, 0xF8, 0x1F, 0x0F, 0x81, 0xF1, 0xF8, 0x0F, 0x9F,
+  0x00, 0xF9, 0xF0, 0x0F, 0xFE, 0x00, 0x7F, 0xE0, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00,
+  0x3F, 0xC0, 0x01, 0xF8, 0x00, // 'V'
+  0xF8, 0x0F, 0x80, 0x7F, 0xC0, 0x7C, 0x07, 0xFE, 0x03, 0xF0, 0x3E, 0xF8, 0x3F, 0x83, 0xF7, 0xC1,
+  0xFC, 0x1F, 0x3E, 0x0F, 0xE0, 0xF9, 0xF0, 0x77, 0x87, 0xC7, 0xC7, 0xBC, 0x3E, 0x3E, 0x3D, 0xE3,
+  0xE1, 0xF1, 0xE7, 0x1F, 0x0F, 0x8E, 0x38, 0xF8, 0x7E, 0xF1, 0xE7, 0xC1, 0xF7, 0x8F, 0x7C, 0x0F,
+  0xBC, 0x7B, 0xE0, 0x7F, 0xC1, 0xFF, 0x03, 0xFE, 0x0F, 0xF8, 0x0F, 0xF0, 0x7F, 0x80, 0x7F, 0x83,
+  0xFC, 0x03, 0xF8, 0x0F, 0xE0, 0x1F, 0xC0, 0x7F, 0x00, 0x7E, 0x03, 0xF0, 0x00, // 'W'
+  0xF8, 0x01, 0xE7, 0xC0, 0x3E, 0x7E, 0x07, 0xE3, 0xE0, 0xFC, 0x1F, 0x0F, 0x81, 0xF9, 0xF0, 0x0F,
+  0xBF, 0x00, 0x7F, 0xE0, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x07, 0xFC,
+  0x00, 0x7F, 0xE0, 0x0F, 0xFF, 0x01, 0xF9, 0xF0, 0x1F, 0x0F, 0x83, 0xE0, 0xFC, 0x7E, 0x07, 0xC7,
+  0xC0, 0x3E, 0xF8, 0x03, 0xF0, // 'X'
+  0xF8, 0x01, 0xFF, 0xC0, 0x3F, 0x7E, 0x03, 0xE3, 0xE0, 0x7E, 0x3F, 0x0F, 0xC1, 0xF8, 0xF8, 0x0F,
+  0x9F, 0x80, 0xFF, 0xF0, 0x07, 0xFE, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x1F, 0x80, 0x00, 0xF8,
+  0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF8, 0x00,
+  0x0F, 0x80, 0x00, 0xF8, 0x00, // 'Y'
+  0x7F, 0xFF, 0x9F, 0xFF, 0xF7, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x03, 0xF0,
+  0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'Z'
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3,
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xC3, 0xFF, 0xFF, 0x7F, 0x80, // '['
+  0xE0, 0x38, 0x07, 0x01, 0xC0, 0x70, 0x0E, 0x03, 0x80, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x78, 0x0E,
+  0x03, 0x80, 0xE0, 0x1C, 0x07, 0x01, 0xC0, 0x38, 0x0E, 0x03, 0x80, 0x70, 0x1C, 0x07, // '\'
+  0xFF, 0xFF, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0xFF, 0xFF, 0xFF, // ']'
+  0x01, 0xC0, 0x01, 0xF8, 0x01, 0xFC, 0x01, 0xFF, 0x01, 0xF3, 0xC1, 0xF0, 0xF1, 0xE0, 0x3D, 0xE0,
+  0x07, // '^'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // '_'
+  0xE1, 0xE1, 0xE1, 0xC1, 0xC1, 0xC0, // '`'
+  0x0F, 0xE0, 0x3F, 0xF8, 0x3F, 0xFE, 0x3F, 0xFE, 0x00, 0x3E, 0x00, 0x1F, 0x0F, 0xFF, 0x3F, 0xFF,
+  0x7F, 0xFF, 0x7C, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0x7F, 0xFF, 0x7F, 0xDF, 0x3F, 0x9F, // 'a'
+  0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC7, 0x83, 0xE7, 0xF1, 0xFF,
+  0xFC, 0xFF, 0xFF, 0x7F, 0x0F, 0xBF, 0x07, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF8, 0x1F, 0xFC, 0x1F, 0x7F, 0x1F, 0xBF, 0xFF, 0xDF, 0x7F, 0xCF, 0x9F, 0xC0, // 'b'
+  0x03, 0xF0, 0x3F, 0xF3, 0xFF, 0xCF, 0xFF, 0x7E, 0x05, 0xF0, 0x0F, 0xC0, 0x3E, 0x00, 0xF8, 0x03,
+  0xE0, 0x0F, 0xC0, 0x1F, 0x00, 0x7F, 0x0C, 0xFF, 0xF1, 0xFF, 0xC3, 0xFF, // 'c'
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x3C, 0x7C, 0x7F, 0xBE, 0x7F,
+  0xFF, 0x7F, 0xFF, 0xBF, 0x0F, 0xDF, 0x07, 0xFF, 0x81, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF8, 0x1F, 0x7C, 0x1F, 0xBF, 0x1F, 0xCF, 0xFF, 0xE7, 0xFD, 0xF0, 0xFC, 0xF8, // 'd'
+  0x03, 0xE0, 0x07, 0xFC, 0x0F, 0xFF, 0x87, 0xFF, 0xC7, 0xC1, 0xF3, 0xE0, 0x7B, 0xF0, 0x7F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x71, 0xFF, 0xF8, 0x7F, 0xFC,
+  0x1F, 0xFC, // 'e'
+  0x0F, 0xF1, 0xFF, 0x3F, 0xE3, 0xE0, 0x3E, 0x03, 0xE0, 0xFF, 0xEF, 0xFE, 0xFF, 0xE3, 0xE0, 0x3E,
+  0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x03, 0xE0, 0x3E, 0x00, // 'f'
+  0x07, 0x80, 0x0F, 0xF7, 0xCF, 0xFF, 0xEF, 0xFF, 0xF7, 0xE1, 0xFB, 0xE0, 0xFF, 0xF0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xDF, 0x07, 0xEF, 0x83, 0xF7, 0xFF, 0xF9, 0xFF, 0xFC, 0x7F, 0xBE,
+  0x1F, 0x1F, 0x00, 0x0F, 0x80, 0x0F, 0x8E, 0x1F, 0xC7, 0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0x80, // 'g'
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x70, 0xF9, 0xFC, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFE, 0x3F, 0xFC, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, // 'h'
+  0xFF, 0xFE, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, // 'i'
+  0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F,
+  0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFE, 0xFE, 0xF8, // 'j'
+  0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0xFD, 0xF0,
+  0xFC, 0xF8, 0xFC, 0x7C, 0xFC, 0x3E, 0xF8, 0x1F, 0xF8, 0x0F, 0xF8, 0x07, 0xFE, 0x03, 0xFF, 0x81,
+  0xF7, 0xE0, 0xF9, 0xF8, 0x7C, 0x7E, 0x3E, 0x1F, 0x9F, 0x07, 0xEF, 0x81, 0xF8, // 'k'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, // 'l'
+  0x00, 0xF0, 0x3C, 0x7C, 0xFC, 0x7F, 0x3F, 0xFF, 0x7F, 0xDF, 0xFF, 0xFF, 0xFF, 0xE3, 0xF8, 0xFF,
+  0xE1, 0xF8, 0x7F, 0xF0, 0xF8, 0x3F, 0xF0, 0x7C, 0x1F, 0xF8, 0x3E, 0x0F, 0xFC, 0x1F, 0x07, 0xFE,
+  0x0F, 0x83, 0xFF, 0x07, 0xC1, 0xFF, 0x83, 0xE0, 0xFF, 0xC1, 0xF0, 0x7F, 0xE0, 0xF8, 0x3F, 0xF0,
+  0x7C, 0x1F, // 'm'
+  0x00, 0x70, 0xF9, 0xFC, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0x3F, 0xFC, 0x1F, 0xFC, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, // 'n'
+  0x03, 0xE0, 0x07, 0xFE, 0x0F, 0xFF, 0x87, 0xFF, 0xE7, 0xE1, 0xF3, 0xE0, 0xFF, 0xF0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0x03, 0xEF, 0x83, 0xF7, 0xE3, 0xF1, 0xFF, 0xF8, 0x7F, 0xF8,
+  0x1F, 0xF0, // 'o'
+  0x00, 0xF0, 0x7C, 0xFE, 0x3F, 0xFF, 0x9F, 0xFF, 0xEF, 0xE1, 0xF7, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0x03, 0xFF, 0x83, 0xEF, 0xE3, 0xF7, 0xFF, 0xFB, 0xEF, 0xF9,
+  0xF3, 0xF8, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x00, // 'p'
+  0x07, 0x80, 0x0F, 0xF7, 0xCF, 0xFF, 0xEF, 0xFF, 0xF7, 0xE1, 0xFB, 0xE0, 0xFF, 0xF0, 0x3F, 0xF0,
+  0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFF, 0x03, 0xEF, 0x83, 0xF7, 0xE3, 0xF9, 0xFF, 0xFC, 0xFF, 0xBE,
+  0x1F, 0x9F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, // 'q'
+  0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xC0, 0xFC, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8,
+  0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, // 'r'
+  0x0F, 0xE0, 0xFF, 0xE7, 0xFF, 0x9F, 0xFE, 0xF8, 0x03, 0xE0, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC,
+  0x3F, 0xF0, 0x07, 0xC0, 0x0F, 0x60, 0x7D, 0xFF, 0xF7, 0xFF, 0x9F, 0xFC, // 's'
+  0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x03, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF8,
+  0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F, 0x80, 0x7C, 0x03, 0xE0, 0x1F, 0xF0, 0xFF, 0x83, 0xFC, 0x0F,
+  0xE0, // 't'
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x3F, 0xFE, 0xFF, 0x7F, 0xFF, 0x7F, 0xDF, 0x3F, 0x9F, // 'u'
+  0xF8, 0x0F, 0xFC, 0x0F, 0x9E, 0x07, 0xCF, 0x83, 0xC7, 0xC3, 0xE1, 0xE1, 0xF0, 0xF8, 0xF0, 0x3C,
+  0xF8, 0x1F, 0x78, 0x0F, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x00, 0x1F, 0x80, // 'v'
+  0xF8, 0x3C, 0x1F, 0xF8, 0x3E, 0x1F, 0x78, 0x7E, 0x1E, 0x7C, 0x7E, 0x3E, 0x7C, 0x7E, 0x3E, 0x3C,
+  0x7F, 0x3E, 0x3C, 0xF7, 0x3C, 0x3E, 0xE7, 0x7C, 0x3E, 0xE7, 0x7C, 0x1F, 0xE7, 0xF8, 0x1F, 0xE3,
+  0xF8, 0x1F, 0xC3, 0xF8, 0x1F, 0xC3, 0xF8, 0x0F, 0xC3, 0xF0, 0x0F, 0xC1, 0xF0, // 'w'
+  0xFC, 0x1F, 0x7C, 0x3E, 0x3E, 0x7C, 0x1F, 0x7C, 0x1F, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0,
+  0x0F, 0xF0, 0x1F, 0xF8, 0x1F, 0xF8, 0x3E, 0x7C, 0x7C, 0x3E, 0x7C, 0x3F, 0xF8, 0x1F, // 'x'
+  0xF8, 0x0F, 0xFC, 0x0F, 0x9E, 0x07, 0xCF, 0x83, 0xC7, 0xC3, 0xE1, 0xF1, 0xF0, 0xF8, 0xF0, 0x3C,
+  0xF8, 0x1F, 0x78, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xC0, 0x03, 0xE0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xE0, 0x00, // 'y'
+  0x7F, 0xFD, 0xFF, 0xF7, 0xFF, 0xC0, 0x3F, 0x01, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80,
+  0xFC, 0x07, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'z'
+  0x03, 0xF8, 0x3F, 0xC3, 0xFC, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
+  0x07, 0xC1, 0xFE, 0x0F, 0xC0, 0x7F, 0x00, 0xFC, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E,
+  0x00, 0xF8, 0x07, 0xC0, 0x3F, 0xC1, 0xFF, 0x07, 0xF8, 0x07, 0x80, // '{'
+  0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // '|'
+  0xFC, 0x07, 0xF0, 0x3F, 0xC0, 0x3E, 0x01, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x7C,
+  0x03, 0xE0, 0x1F, 0xE0, 0x3F, 0x83, 0xFC, 0x3F, 0x01, 0xF0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E,
+  0x00, 0xF0, 0x0F, 0x83, 0xFC, 0x1F, 0xE0, 0xFE, 0x07, 0x80, 0x00, // '}'
+  0x3F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0x80, 0x1C, 0x00, // '~'
+};
+
+const GFXglyph FreeSansBold18pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    0 }, // ' '
+  {     0,   5,  21,  13,    4,  -21 }, // '!'
+  {    14,   9,   8,  15,    3,  -21 }, // '"'
+  {    23,  20,  20,  24,    2,  -20 }, // '#'
+  {    73,  16,  25,  20,    2,  -21 }, // '$'
+  {   123,  26,  21,  28,    1,  -21 }, // '%'
+  {   192,  21,  21,  25,    2,  -21 }, // '&'
+  {   248,   3,   8,   9,    3,  -21 }, // '''
+  {   251,   8,  25,  13,    2,  -21 }, // '('
+  {   276,   7,  25,  13,    3,  -21 }, // ')'
+  {   298,  13,  13,  15,    1,  -21 }, // '*'
+  {   320,  18,  18,  24,    3,  -18 }, // '+'
+  {   361,   6,   9,  11,    2,   -5 }, // ','
+  {   368,   8,   4,  12,    2,  -10 }, // '-'
+  {   372,   5,   5,  11,    3,   -5 }, // '.'
+  {   376,  10,  24,  10,    0,  -21 }, // '/'
+  {   406,  17,  21,  20,    1,  -21 }, // '0'
+  {   451,  15,  21,  20,    3,  -21 }, // '1'
+  {   491,  15,  21,  20,    2,  -21 }, // '2'
+  {   531,  15,  21,  20,    2,  -21 }, // '3'
+  {   571,  17,  21,  20,    1,  -21 }, // '4'
+  {   616,  16,  21,  20,    2,  -21 }, // '5'
+  {   658,  16,  21,  20,    2,  -21 }, // '6'
+  {   700,  15,  21,  20,    2,  -21 }, // '7'
+  {   740,  16,  21,  20,    2,  -21 }, // '8'
+  {   782,  17,  21,  20,    1,  -21 }, // '9'
+  {   827,   5,  15,  11,    3,  -15 }, // ':'
+  {   837,   6,  19,  11,    2,  -15 }, // ';'
+  {   852,  18,  15,  24,    3,  -16 }, // '<'
+  {   886,  18,  10,  24,    3,  -14 }, // '='
+  {   909,  18,  16,  24,    3,  -17 }, // '>'
+  {   945,  13,  21,  16,    2,  -21 }, // '?'
+  {   980,  24,  25,  28,    2,  -20 }, // '@'
+  {  1055,  22,  21,  22,    0,  -21 }, // 'A'
+  {  1113,  16,  21,  21,    3,  -21 }, // 'B'
+  {  1155,  18,  21,  21,    1,  -21 }, // 'C'
+  {  1203,  19,  21,  23,    3,  -21 }, // 'D'
+  {  1253,  14,  21,  19,    3,  -21 }, // 'E'
+  {  1290,  14,  21,  19,    3,  -21 }, // 'F'
+  {  1327,  20,  21,  23,    1,  -21 }, // 'G'
+  {  1380,  18,  21,  24,    3,  -21 }, // 'H'
+  {  1428,   5,  21,  10,    3,  -21 }, // 'I'
+  {  1442,  10,  27,  10,   -2,  -21 }, // 'J'
+  {  1476,  19,  21,  22,    3,  -21 }, // 'K'
+  {  1526,  14,  21,  18,    3,  -21 }, // 'L'
+  {  1563,  22,  21,  28,    3,  -21 }, // 'M'
+  {  1621,  18,  21,  24,    3,  -21 }, // 'N'
+  {  1669,  22,  21,  24,    1,  -21 }, // 'O'
+  {  1727,  16,  21,  21,    3,  -21 }, // 'P'
+  {  1769,  22,  25,  24,    1,  -21 }, // 'Q'
+  {  1838,  18,  21,  22,    3,  -21 }, // 'R'
+  {  1886,  16,  21,  20,    2,  -21 }, // 'S'
+  {  1928,  19,  21,  19,    0,  -21 }, // 'T'
+  {  1978,  17,  21,  23,    3,  -21 }, // 'U'
+  {  2023,  20,  21,  22,    1,  -21 }, // 'V'
+  {  2076,  29,  21,  31,    1,  -21 }, // 'W'
+  {  2153,  20,  21,  22,    1,  -21 }, // 'X'
+  {  2206,  20,  21,  20,    0,  -21 }, // 'Y'
+  {  2259,  18,  21,  20,    1,  -21 }, // 'Z'
+  {  2307,   9,  25,  13,    2,  -21 }, // '['
+  {  2336,  10,  24,  10,    0,  -21 }, // '\'
+  {  2366,   8,  25,  13,    2,  -21 }, // ']'
+  {  2391,  17,   8,  24,    3,  -21 }, // '^'
+  {  2408,  14,   3,  14,    0,    4 }, // '_'
+  {  2414,   7,   6,  14,    2,  -23 }, // '`'
+  {  2420,  16,  16,  19,    1,  -16 }, // 'a'
+  {  2452,  17,  21,  20,    2,  -21 }, // 'b'
+  {  2497,  14,  16,  17,    1,  -16 }, // 'c'
+  {  2525,  17,  21,  20,    1,  -21 }, // 'd'
+  {  2570,  17,  16,  19,    1,  -16 }, // 'e'
+  {  2604,  12,  21,  12,    1,  -21 }, // 'f'
+  {  2636,  17,  22,  20,    1,  -16 }, // 'g'
+  {  2683,  16,  21,  20,    2,  -21 }, // 'h'
+  {  2725,   5,  21,  10,    2,  -21 }, // 'i'
+  {  2739,   8,  27,  10,   -1,  -21 }, // 'j'
+  {  2766,  17,  21,  19,    2,  -21 }, // 'k'
+  {  2811,   5,  21,  10,    2,  -21 }, // 'l'
+  {  2825,  25,  16,  29,    2,  -16 }, // 'm'
+  {  2875,  16,  16,  20,    2,  -16 }, // 'n'
+  {  2907,  17,  16,  19,    1,  -16 }, // 'o'
+  {  2941,  17,  22,  20,    2,  -16 }, // 'p'
+  {  2988,  17,  22,  20,    1,  -16 }, // 'q'
+  {  3035,  12,  16,  14,    2,  -16 }, // 'r'
+  {  3059,  14,  16,  17,    1,  -16 }, // 's'
+  {  3087,  13,  20,  13,    0,  -20 }, // 't'
+  {  3120,  16,  15,  20,    2,  -15 }, // 'u'
+  {  3150,  17,  15,  18,    1,  -15 }, // 'v'
+  {  3182,  24,  15,  26,    1,  -15 }, // 'w'
+  {  3227,  16,  15,  18,    1,  -15 }, // 'x'
+  {  3257,  17,  21,  18,    1,  -15 }, // 'y'
+  {  3302,  14,  15,  16,    1,  -15 }, // 'z'
+  {  3329,  13,  26,  20,    4,  -21 }, // '{'
+  {  3372,   3,  29,  10,    4,  -22 }, // '|'
+  {  3383,  13,  26,  20,    4,  -21 }, // '}'
+  {  3426,  18,   5,  24,    3,  -11 }, // '~'
+};
+
+const GFXfont FreeSansBold18pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold18pt7bBitmaps,
+  (GFXglyph *)FreeSansBold18pt7bGlyphs,
+  0x20, 0x7E, 33
+};
@@ -0,0 +1,532 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans-Bold.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSansBold24pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xEF, 0x9F, 0x3E, 0x7C, 0xF8,
+  0x00, 0x07, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, // '!'
+  0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, // '"'
+  0x00, 0x3C, 0x3E, 0x00, 0x1E, 0x0F, 0x00, 0x07, 0x83, 0xC0, 0x01, 0xE0, 0xF0, 0x00, 0x78, 0x7C,
+  0x00, 0x3C, 0x1E, 0x00, 0x0F, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF,
+  0xF3, 0xFF, 0xFF, 0xFC, 0x07, 0x83, 0xC0, 0x03, 0xE1, 0xF0, 0x00, 0xF0, 0x78, 0x00, 0x3C, 0x1E,
+  0x00, 0x0F, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+  0xFC, 0x07, 0x87, 0xC0, 0x03, 0xC1, 0xE0, 0x00, 0xF0, 0x78, 0x00, 0x3C, 0x1E, 0x00, 0x0F, 0x0F,
+  0x80, 0x07, 0x83, 0xC0, 0x01, 0xE0, 0xF0, 0x00, // '#'
+  0x00, 0x60, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0x00, 0x0F, 0x00, 0x07, 0xFF, 0xC0,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0x7F, 0xFF, 0xE7, 0xF3, 0x87, 0x3F, 0x1C, 0x01, 0xF8, 0xE0, 0x0F,
+  0xC7, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x07, 0x3F, 0x80, 0x38, 0xFC, 0x01, 0xC7, 0xF8, 0x0E, 0x7E, 0xFC,
+  0x77, 0xF7, 0xFF, 0xFF, 0xBF, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x01,
+  0xC0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x18, 0x00, // '$'
+  0x07, 0xC0, 0x00, 0xF0, 0x03, 0xFE, 0x00, 0x1E, 0x00, 0xFF, 0xE0, 0x07, 0x80, 0x3E, 0x3E, 0x01,
+  0xE0, 0x07, 0x83, 0xC0, 0x3C, 0x01, 0xF0, 0x7C, 0x0F, 0x00, 0x3E, 0x0F, 0x81, 0xE0, 0x07, 0xC1,
+  0xF0, 0x78, 0x00, 0xF8, 0x3E, 0x1E, 0x00, 0x1F, 0x07, 0xC3, 0xC0, 0x01, 0xE0, 0xF0, 0xF0, 0x00,
+  0x3E, 0x3E, 0x1E, 0x00, 0x03, 0xFF, 0x87, 0x80, 0x00, 0x3F, 0xE1, 0xE0, 0x00, 0x03, 0xF8, 0x3C,
+  0x3F, 0xC0, 0x00, 0x0F, 0x0F, 0xFC, 0x00, 0x03, 0xE3, 0xFF, 0xC0, 0x00, 0x78, 0xF8, 0x7C, 0x00,
+  0x1E, 0x1F, 0x0F, 0x80, 0x03, 0xC3, 0xE0, 0xF0, 0x00, 0xF0, 0x78, 0x1E, 0x00, 0x3E, 0x0F, 0x03,
+  0xC0, 0x07, 0x81, 0xF0, 0x78, 0x01, 0xE0, 0x3E, 0x0F, 0x00, 0x3C, 0x07, 0xC3, 0xE0, 0x0F, 0x00,
+  0x7F, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0x00, 0x78, 0x00, 0x7F, 0x80, 0x0E, 0x00, 0x00, 0x80, // '%'
+  0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x00, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F,
+  0xFF, 0x00, 0x07, 0xF0, 0x18, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x07, 0xF0, 0x00,
+  0x00, 0x3F, 0x80, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x3F, 0x1F,
+  0xFF, 0x81, 0xF8, 0xFF, 0xFE, 0x0F, 0xCF, 0xE7, 0xF8, 0x7C, 0x7E, 0x1F, 0xE7, 0xE7, 0xF0, 0x7F,
+  0xBF, 0x3F, 0x81, 0xFF, 0xF1, 0xFC, 0x07, 0xFF, 0x8F, 0xE0, 0x1F, 0xF8, 0x7F, 0x00, 0xFF, 0x81,
+  0xFC, 0x03, 0xFC, 0x0F, 0xF8, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+  0xFB, 0xFC, 0x07, 0xFF, 0x0F, 0xF0, 0x03, 0x00, 0x00, 0x00, // '&'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // '''
+  0x03, 0xC0, 0xFC, 0x1F, 0x07, 0xE1, 0xF8, 0x3F, 0x07, 0xC1, 0xF8, 0x3F, 0x0F, 0xE1, 0xF8, 0x3F,
+  0x07, 0xE0, 0xFC, 0x3F, 0x87, 0xF0, 0xFC, 0x1F, 0x83, 0xF8, 0x7F, 0x0F, 0xE0, 0xFC, 0x1F, 0x83,
+  0xF0, 0x7E, 0x07, 0xE0, 0xFC, 0x1F, 0x81, 0xF8, 0x3F, 0x03, 0xE0, 0x7E, 0x07, 0xC0, 0xFC, // '('
+  0x78, 0x0F, 0x81, 0xF8, 0x1F, 0x03, 0xF0, 0x7E, 0x07, 0xE0, 0xFC, 0x1F, 0x81, 0xF8, 0x3F, 0x07,
+  0xE0, 0xFC, 0x1F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x1F, 0xC3, 0xF0,
+  0x7E, 0x0F, 0xC1, 0xF8, 0x7E, 0x0F, 0xC1, 0xF0, 0x7E, 0x0F, 0x83, 0xF0, 0x7C, 0x1F, 0x80, // ')'
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x01, 0x07, 0x02, 0xF1, 0xC3, 0xBF, 0x73, 0xF7, 0xFF, 0xF0,
+  0x7F, 0xF0, 0x07, 0xF8, 0x01, 0xFE, 0x01, 0xFF, 0xE1, 0xFF, 0xFE, 0xF9, 0xC7, 0xD8, 0x70, 0xE0,
+  0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x30, 0x00, // '*'
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xFF, 0xFF,
+  0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, // '+'
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x7E, 0x7C, 0x7C, 0xF8, 0xF0, // ','
+  0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // '-'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // '.'
+  0x00, 0x78, 0x03, 0xC0, 0x1E, 0x01, 0xF0, 0x0F, 0x00, 0x78, 0x07, 0xC0, 0x3C, 0x01, 0xE0, 0x0F,
+  0x00, 0xF0, 0x07, 0x80, 0x3C, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0xF8, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x78,
+  0x01, 0xC0, 0x00, // '/'
+  0x00, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xF0, 0xFE, 0x1F,
+  0xE7, 0xF0, 0x3F, 0x9F, 0xC0, 0x7E, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0x7E, 0x01, 0xFD, 0xFC, 0x0F, 0xE7, 0xF0, 0x3F, 0x8F,
+  0xF3, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0x80, 0xFF, 0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x30, 0x00, // '0'
+  0x3F, 0xF8, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x0F, 0xFF, 0x80, 0xFF, 0xF8, 0x00, 0x1F, 0x80, 0x01,
+  0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8,
+  0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00,
+  0x1F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, // '1'
+  0x07, 0xF8, 0x07, 0xFF, 0xF0, 0xFF, 0xFF, 0x8F, 0xFF, 0xFC, 0xFF, 0xFF, 0xEF, 0x83, 0xFE, 0xC0,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F,
+  0xE0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00,
+  0xFF, 0x00, 0x1F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // '2'
+  0x0F, 0xF8, 0x07, 0xFF, 0xF0, 0x7F, 0xFF, 0xC7, 0xFF, 0xFE, 0x7F, 0xFF, 0xE6, 0x01, 0xFE, 0x00,
+  0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x1F, 0xE0, 0x07, 0xFC, 0x0F, 0xFF,
+  0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x80, 0xFF, 0xFE, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x07, 0xF0,
+  0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0x7F, 0x80, 0x0F, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF,
+  0xFC, 0xFF, 0xFF, 0x87, 0xFF, 0xE0, 0x01, 0x80, 0x00, // '3'
+  0x00, 0x3F, 0xE0, 0x01, 0xFF, 0x80, 0x07, 0xFE, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xE0, 0x07, 0xFF,
+  0x80, 0x3E, 0xFE, 0x01, 0xF3, 0xF8, 0x07, 0xCF, 0xE0, 0x3E, 0x3F, 0x81, 0xF0, 0xFE, 0x07, 0xC3,
+  0xF8, 0x3E, 0x0F, 0xE1, 0xF0, 0x3F, 0x87, 0xC0, 0xFE, 0x3E, 0x03, 0xF8, 0xF0, 0x0F, 0xE3, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x00,
+  0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, // '4'
+  0x7F, 0xFF, 0xE3, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC7, 0xFF, 0xFC, 0x3F, 0x00, 0x01,
+  0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x87,
+  0xFF, 0xFE, 0x3E, 0x3F, 0xF9, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0,
+  0x01, 0xFE, 0x00, 0x0F, 0xE8, 0x00, 0x7F, 0x70, 0x07, 0xFB, 0xF0, 0xFF, 0xDF, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xC7, 0xFF, 0xFC, 0x0F, 0xFF, 0x80, 0x01, 0x80, 0x00, // '5'
+  0x00, 0x3F, 0x80, 0x07, 0xFF, 0xC0, 0x7F, 0xFF, 0x03, 0xFF, 0xFC, 0x1F, 0xFF, 0xF0, 0x7F, 0x80,
+  0xC3, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE7, 0xF0, 0x1F, 0xFF,
+  0xF0, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xBF, 0xE0, 0xFF, 0xFF, 0x01, 0xFF, 0xFC,
+  0x07, 0xF7, 0xF0, 0x1F, 0xDF, 0xC0, 0x7F, 0x7F, 0x01, 0xFD, 0xFC, 0x07, 0xF3, 0xF8, 0x1F, 0xCF,
+  0xF0, 0xFE, 0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0x10, 0x00, // '6'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFE, 0x00,
+  0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F,
+  0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
+  0x3F, 0x80, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
+  0x00, 0x1F, 0xC0, 0x00, // '7'
+  0x01, 0xFE, 0x00, 0x3F, 0xFF, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF9, 0xFC, 0x0F,
+  0xE7, 0xF0, 0x3F, 0x9F, 0xC0, 0x7E, 0x7F, 0x03, 0xF9, 0xFC, 0x0F, 0xE3, 0xF8, 0x3F, 0x07, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xC0, 0x1F, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x7F, 0x03, 0xF9, 0xFC,
+  0x07, 0xEF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xF7, 0xF0, 0x3F, 0xDF,
+  0xE1, 0xFE, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x01, 0xFF, 0xE0, 0x00, 0x30, 0x00, // '8'
+  0x01, 0xFC, 0x00, 0x1F, 0xFC, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xE1, 0xFC, 0x1F,
+  0xCF, 0xE0, 0x3F, 0x3F, 0x80, 0xFE, 0xFE, 0x03, 0xFB, 0xF8, 0x0F, 0xEF, 0xE0, 0x3F, 0xFF, 0x80,
+  0xFF, 0xFE, 0x03, 0xFD, 0xFC, 0x1F, 0xF7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFC, 0x3F,
+  0xF7, 0xE0, 0x1F, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7F, 0x0E,
+  0x07, 0xF8, 0x3F, 0xFF, 0xC0, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0xC0, 0x00, // '9'
+  0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE0, // ':'
+  0x3E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+  0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7C, 0xFC, 0xF8, 0xF8, 0xF0, // ';'
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x3F, 0x00, 0x01, 0xFF, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFC, 0x01,
+  0xFF, 0xF0, 0x0F, 0xFF, 0x80, 0x7F, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F, 0xF8,
+  0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x02, // '<'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, // '='
+  0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFC, 0x00, 0x0F,
+  0xFF, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x7F, 0x00, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0xC0, 0x3F, 0xFE, 0x00,
+  0xFF, 0xF0, 0x00, 0xFF, 0x80, 0x00, 0xFE, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x80, 0x00, 0x00, // '>'
+  0x1F, 0xE0, 0xFF, 0xF8, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xE0, 0x7F, 0x80, 0x7F, 0x00, 0x3F,
+  0x00, 0x3F, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0xFE, 0x03, 0xFC, 0x07, 0xF8, 0x0F, 0xF0, 0x0F, 0xE0,
+  0x0F, 0xC0, 0x1F, 0xC0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
+  0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, // '?'
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0x00, 0xFE,
+  0x00, 0x7E, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x03, 0xE0, 0x7C, 0x00, 0x00, 0xF8, 0x3C, 0x00, 0x00,
+  0x3C, 0x3C, 0x07, 0xE7, 0x0F, 0x1E, 0x07, 0xFB, 0xC3, 0x9E, 0x07, 0xFF, 0xE1, 0xEF, 0x07, 0xE7,
+  0xF0, 0xF7, 0x03, 0xC1, 0xF8, 0x7B, 0x83, 0xE0, 0x7C, 0x3D, 0xC1, 0xE0, 0x3E, 0x1F, 0xE0, 0xF0,
+  0x1F, 0x0F, 0xF0, 0x78, 0x0F, 0x87, 0xB8, 0x3C, 0x07, 0xC3, 0x9C, 0x1F, 0x03, 0xE3, 0xCE, 0x07,
+  0x81, 0xF1, 0xE7, 0x83, 0xE1, 0xFB, 0xE3, 0xC0, 0xFF, 0xFF, 0xE0, 0xF0, 0x7F, 0xDF, 0xE0, 0x78,
+  0x0F, 0xCF, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x10, 0x00,
+  0xFC, 0x00, 0x3C, 0x00, 0x3F, 0x80, 0x7E, 0x00, 0x0F, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x00,
+  0x00, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, // '@'
+  0x00, 0x3F, 0xE0, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07,
+  0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x3F, 0xBF, 0x80, 0x01, 0xFD, 0xFC,
+  0x00, 0x0F, 0xC7, 0xE0, 0x00, 0xFE, 0x3F, 0x80, 0x07, 0xF1, 0xFC, 0x00, 0x3F, 0x07, 0xF0, 0x03,
+  0xF8, 0x3F, 0x80, 0x1F, 0xC1, 0xFC, 0x01, 0xFC, 0x07, 0xF0, 0x0F, 0xE0, 0x3F, 0x80, 0x7F, 0xFF,
+  0xFC, 0x07, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xF0,
+  0xFE, 0x00, 0x3F, 0x8F, 0xF0, 0x00, 0xFE, 0x7F, 0x00, 0x07, 0xF3, 0xF8, 0x00, 0x3F, 0xBF, 0x80,
+  0x00, 0xFE, // 'A'
+  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xCF, 0xF0, 0xFF, 0xDF, 0xE0,
+  0x7F, 0xBF, 0xC0, 0x7F, 0x7F, 0x80, 0xFE, 0xFF, 0x01, 0xFD, 0xFE, 0x07, 0xF3, 0xFF, 0xFF, 0xE7,
+  0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0x81, 0xFE, 0xFF, 0x01,
+  0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x03, 0xFF, 0xF8, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, // 'B'
+  0x00, 0x1F, 0xE0, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xE3, 0xFF,
+  0x07, 0xCF, 0xF8, 0x01, 0xBF, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x07,
+  0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F, 0x00, 0x00, 0xFE, 0x00,
+  0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xF8, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x4F,
+  0xF8, 0x03, 0x8F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x07, 0xFF,
+  0xC0, 0x00, 0x30, 0x00, // 'C'
+  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFE,
+  0x3F, 0xC0, 0xFF, 0xCF, 0xF0, 0x0F, 0xFB, 0xFC, 0x01, 0xFE, 0xFF, 0x00, 0x3F, 0xFF, 0xC0, 0x0F,
+  0xFF, 0xF0, 0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x07, 0xFF, 0xF0, 0x01,
+  0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xF0, 0x03, 0xFB, 0xFC, 0x01,
+  0xFE, 0xFF, 0x01, 0xFF, 0x3F, 0xC3, 0xFF, 0xCF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xF8, 0x0F, 0xFF, 0xE0, 0x00, // 'D'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, // 'E'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xEF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFE, 0xFF, 0xFF, 0xEF, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x00, // 'F'
+  0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xFF, 0xC0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF,
+  0x87, 0xFE, 0x07, 0xE3, 0xFE, 0x00, 0x39, 0xFF, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x1F, 0xC0, 0x00,
+  0x0F, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x3F, 0x80, 0x7F, 0xFF, 0xE0, 0x1F,
+  0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x01, 0xFD, 0xFC, 0x00,
+  0x7F, 0x7F, 0x80, 0x1F, 0xDF, 0xF0, 0x07, 0xF3, 0xFE, 0x01, 0xFC, 0x7F, 0xFF, 0xFF, 0x0F, 0xFF,
+  0xFF, 0xC1, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x00, 0x03, 0x00, 0x00, // 'G'
+  0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0, 0x03, 0xFF,
+  0xF8, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80, 0x1F, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x07, 0xFF, 0xF0,
+  0x03, 0xFF, 0xF8, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x80,
+  0x1F, 0xFF, 0xC0, 0x0F, 0xE0, // 'H'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, // 'I'
+  0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F,
+  0xC1, 0xFE, 0x0F, 0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0xC1, 0xFE, 0x0F,
+  0xF0, 0x7F, 0x83, 0xFC, 0x1F, 0xE0, 0xFF, 0x07, 0xF8, 0x3F, 0x81, 0xFC, 0x0F, 0xE0, 0xFF, 0x7F,
+  0xFB, 0xFF, 0x9F, 0xF8, 0xFF, 0x87, 0xF0, 0x30, 0x00, // 'J'
+  0xFF, 0x00, 0x7F, 0x9F, 0xE0, 0x1F, 0xE3, 0xFC, 0x07, 0xF8, 0x7F, 0x81, 0xFE, 0x0F, 0xF0, 0x7F,
+  0x81, 0xFE, 0x1F, 0xE0, 0x3F, 0xC7, 0xF8, 0x07, 0xF9, 0xFE, 0x00, 0xFF, 0x7F, 0x80, 0x1F, 0xFF,
+  0xE0, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFF, 0x80, 0x07, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x80, 0x1F, 0xEF, 0xF8, 0x03, 0xFC, 0xFF, 0x80,
+  0x7F, 0x8F, 0xF8, 0x0F, 0xF0, 0xFF, 0x81, 0xFE, 0x0F, 0xF8, 0x3F, 0xC0, 0xFF, 0x87, 0xF8, 0x0F,
+  0xF8, 0xFF, 0x00, 0xFF, 0x9F, 0xE0, 0x0F, 0xFB, 0xFC, 0x00, 0xFF, 0x80, // 'K'
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF0, // 'L'
+  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF,
+  0xFF, 0x00, 0xFF, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFC, 0x0F, 0xFF, 0xFE,
+  0xF8, 0x3F, 0xFF, 0xFD, 0xF8, 0x7D, 0xFF, 0xF9, 0xF1, 0xFB, 0xFF, 0xF3, 0xF3, 0xE7, 0xFF, 0xE3,
+  0xEF, 0xCF, 0xFF, 0xC7, 0xDF, 0x1F, 0xFF, 0x8F, 0xFE, 0x3F, 0xFF, 0x0F, 0xFC, 0x7F, 0xFE, 0x1F,
+  0xF0, 0xFF, 0xFC, 0x1F, 0xE1, 0xFF, 0xF8, 0x3F, 0x83, 0xFF, 0xF0, 0x3F, 0x07, 0xFF, 0xE0, 0x7C,
+  0x0F, 0xFF, 0xC0, 0xF8, 0x1F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00,
+  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x03, 0xF8, // 'M'
+  0xFF, 0x80, 0x3F, 0xFF, 0xC0, 0x1F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x07, 0xFF, 0xFE, 0x03, 0xFF,
+  0xFF, 0x01, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xFF, 0x7E, 0x1F, 0xFF,
+  0xBF, 0x0F, 0xFF, 0xCF, 0xC7, 0xFF, 0xE7, 0xE3, 0xFF, 0xF1, 0xF9, 0xFF, 0xF8, 0xFC, 0xFF, 0xFC,
+  0x3F, 0x7F, 0xFE, 0x0F, 0xBF, 0xFF, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0,
+  0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00,
+  0x7F, 0xFF, 0x80, 0x1F, 0xE0, // 'N'
+  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0x7F, 0x00, 0x0F, 0xEF,
+  0xF0, 0x00, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+  0x00, 0x0F, 0xF7, 0xF0, 0x00, 0xFE, 0x7F, 0x80, 0x1F, 0xE7, 0xF8, 0x01, 0xFE, 0x3F, 0xE0, 0x7F,
+  0xC1, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
+  0xFF, 0x00, 0x00, 0x06, 0x00, 0x00, // 'O'
+  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xDF, 0xE0,
+  0x7F, 0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0xFF, 0xFE, 0x01, 0xFF, 0xFC, 0x07, 0xFF,
+  0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFE, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF,
+  0xC1, 0xFF, 0xE0, 0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x00, // 'P'
+  0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xFF, 0x80, 0x07, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF,
+  0xFF, 0x83, 0xFF, 0x0F, 0xFC, 0x3F, 0xC0, 0x3F, 0xC7, 0xF8, 0x01, 0xFE, 0x7F, 0x00, 0x0F, 0xEF,
+  0xF0, 0x00, 0xFE, 0xFF, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00,
+  0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFE, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+  0x00, 0x0F, 0xF7, 0xF0, 0x00, 0xFE, 0x7F, 0x80, 0x1F, 0xE7, 0xF8, 0x01, 0xFE, 0x3F, 0xC0, 0x7F,
+  0xC1, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x0F,
+  0xFF, 0x80, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x07, 0xF0,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0xF8, // 'Q'
+  0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xF0, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x87,
+  0xF8, 0x1F, 0xE3, 0xFC, 0x0F, 0xF1, 0xFE, 0x03, 0xF8, 0xFF, 0x01, 0xFC, 0x7F, 0x81, 0xFC, 0x3F,
+  0xC0, 0xFE, 0x1F, 0xE1, 0xFE, 0x0F, 0xFF, 0xFF, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x01, 0xFF,
+  0xFF, 0xC0, 0xFF, 0xFF, 0xF0, 0x7F, 0x87, 0xF8, 0x3F, 0xC1, 0xFE, 0x1F, 0xE0, 0x7F, 0x8F, 0xF0,
+  0x3F, 0xC7, 0xF8, 0x0F, 0xE3, 0xFC, 0x07, 0xF9, 0xFE, 0x01, 0xFC, 0xFF, 0x00, 0xFF, 0x7F, 0x80,
+  0x3F, 0xBF, 0xC0, 0x1F, 0xE0, // 'R'
+  0x03, 0xFE, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xFC, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0x7F, 0x81, 0xFB,
+  0xF8, 0x00, 0xDF, 0x80, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0xF0, 0x07,
+  0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1, 0xFF, 0xFE, 0x01, 0xFF, 0xF8, 0x00, 0x7F, 0xC0,
+  0x00, 0xFE, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xE0, 0x01, 0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF7, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0x00, 0x07, 0x00, 0x00, // 'S'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00,
+  0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xE0, 0x00, 0x07,
+  0xF0, 0x00, 0x03, 0xF8, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3F,
+  0x80, 0x00, 0x1F, 0xC0, 0x00, // 'T'
+  0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF,
+  0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00,
+  0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7F,
+  0xFF, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0x7F, 0x7F, 0x00, 0xFF, 0x7F,
+  0x81, 0xFE, 0x3F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x03, 0xFF,
+  0xC0, 0x00, 0x18, 0x00, // 'U'
+  0xFE, 0x00, 0x0F, 0xFF, 0xE0, 0x00, 0xFE, 0xFE, 0x00, 0x0F, 0xE7, 0xF0, 0x01, 0xFC, 0x7F, 0x00,
+  0x1F, 0xC7, 0xF0, 0x01, 0xFC, 0x3F, 0x80, 0x3F, 0x83, 0xF8, 0x03, 0xF8, 0x3F, 0x80, 0x3F, 0x81,
+  0xFC, 0x07, 0xF0, 0x1F, 0xC0, 0x7F, 0x00, 0xFE, 0x07, 0xF0, 0x0F, 0xE0, 0xFE, 0x00, 0xFE, 0x0F,
+  0xE0, 0x07, 0xF1, 0xFC, 0x00, 0x7F, 0x1F, 0xC0, 0x07, 0xF1, 0xFC, 0x00, 0x3F, 0xBF, 0x80, 0x03,
+  0xFB, 0xF8, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x7F, 0xC0, 0x00, // 'V'
+  0xFE, 0x00, 0xFE, 0x00, 0xFE, 0xFC, 0x01, 0xFE, 0x01, 0xFD, 0xFC, 0x03, 0xFC, 0x03, 0xFB, 0xF8,
+  0x0F, 0xF8, 0x07, 0xE7, 0xF0, 0x1F, 0xF0, 0x1F, 0xC7, 0xE0, 0x3F, 0xF0, 0x3F, 0x8F, 0xE0, 0x7F,
+  0xE0, 0x7F, 0x1F, 0xC1, 0xF7, 0xC0, 0xFC, 0x3F, 0x83, 0xEF, 0x83, 0xF8, 0x7F, 0x07, 0xCF, 0x07,
+  0xF0, 0x7E, 0x0F, 0x9F, 0x0F, 0xE0, 0xFE, 0x1E, 0x3E, 0x1F, 0x81, 0xFC, 0x7C, 0x7C, 0x3F, 0x03,
+  0xF8, 0xF8, 0xF8, 0xFE, 0x03, 0xF1, 0xF0, 0xF9, 0xFC, 0x07, 0xF3, 0xE1, 0xF3, 0xF8, 0x0F, 0xEF,
+  0x83, 0xE7, 0xE0, 0x1F, 0xDF, 0x07, 0xDF, 0xC0, 0x1F, 0xFE, 0x07, 0xFF, 0x80, 0x3F, 0xFC, 0x0F,
+  0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0xFC, 0x00, 0xFF, 0xE0, 0x3F, 0xF8, 0x00, 0xFF, 0xC0, 0x3F, 0xF0,
+  0x01, 0xFF, 0x80, 0x7F, 0xE0, 0x03, 0xFE, 0x00, 0xFF, 0x80, 0x07, 0xFC, 0x01, 0xFF, 0x00, 0x07,
+  0xF8, 0x01, 0xFE, 0x00, // 'W'
+  0x7F, 0x00, 0x1F, 0xCF, 0xF0, 0x07, 0xF8, 0xFE, 0x01, 0xFE, 0x0F, 0xE0, 0x3F, 0x81, 0xFE, 0x0F,
+  0xF0, 0x1F, 0xC3, 0xFC, 0x01, 0xFC, 0x7F, 0x00, 0x3F, 0xDF, 0xC0, 0x03, 0xFF, 0xF8, 0x00, 0x3F,
+  0xFE, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x3F, 0xF8, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0x00, 0x1F, 0xEF, 0xE0,
+  0x03, 0xF8, 0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x3F, 0xC1, 0xFC, 0x07, 0xF0, 0x1F, 0xC1, 0xFC, 0x03,
+  0xFC, 0x7F, 0x80, 0x3F, 0xCF, 0xE0, 0x03, 0xFB, 0xF8, 0x00, 0x3F, 0x80, // 'X'
+  0xFF, 0x00, 0x1F, 0xEF, 0xF0, 0x03, 0xF8, 0xFE, 0x00, 0xFF, 0x1F, 0xE0, 0x3F, 0xC1, 0xFE, 0x07,
+  0xF0, 0x1F, 0xC1, 0xFE, 0x03, 0xFC, 0x7F, 0x80, 0x3F, 0x8F, 0xE0, 0x03, 0xFB, 0xFC, 0x00, 0x7F,
+  0xFF, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0x80, 0x00,
+  0x1F, 0xF0, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00,
+  0x00, 0x1F, 0xC0, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x01, 0xFC,
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x07, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, // 'Y'
+  0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x00,
+  0x03, 0xFC, 0x00, 0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x1F, 0xC0, 0x00, 0x3F,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00,
+  0x07, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0x80, 0x00, 0x7F,
+  0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, // 'Z'
+  0x7F, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC,
+  0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F,
+  0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xC0, 0xFC, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, // '['
+  0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0xC0, 0x1E, 0x00, 0xF0,
+  0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1E, 0x00, 0xF0, 0x07,
+  0x80, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xF0, 0x07, 0x80,
+  0x3C, 0x00, 0xE0, // '\'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83,
+  0xF0, 0x7E, 0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xC1, 0xF8,
+  0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, // ']'
+  0x00, 0x7E, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0x7F, 0xFE, 0x01, 0xF8,
+  0xFE, 0x07, 0xE0, 0x7E, 0x1F, 0x00, 0x7E, 0x7C, 0x00, 0x7D, 0xF0, 0x00, 0x3C, // '^'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '_'
+  0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x01, 0xE0, 0x3C, // '`'
+  0x0F, 0xFE, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0xC7, 0xFF, 0xFE, 0x7C, 0x1F, 0xF0, 0x00, 0x7F, 0x00,
+  0x03, 0xF0, 0x00, 0x3F, 0x0F, 0xFF, 0xF3, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
+  0xFF, 0xC0, 0x3F, 0xFC, 0x07, 0xFF, 0xC0, 0x7F, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+  0xFF, 0x3F, 0x1F, 0xE3, 0xF0, 0x30, 0x00, // 'a'
+  0x7C, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x3F, 0x83, 0xF9, 0xFF, 0x0F, 0xEF, 0xFE, 0x3F, 0xFF,
+  0xFC, 0xFF, 0xFF, 0xFB, 0xFE, 0x0F, 0xEF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF,
+  0xC0, 0xFE, 0xFF, 0xC7, 0xFB, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xBF, 0xF8, 0xFE, 0x7F, 0x80,
+  0x00, 0x10, 0x00, // 'b'
+  0x01, 0xFF, 0x01, 0xFF, 0xF1, 0xFF, 0xFC, 0xFF, 0xFF, 0x7F, 0xFF, 0xDF, 0xE0, 0x3F, 0xF0, 0x03,
+  0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x01, 0xFC, 0x01, 0x7F, 0xC1, 0xCF, 0xFF, 0xF1, 0xFF, 0xFC, 0x3F, 0xFF, 0x03, 0xFF, 0x80,
+  0x0C, 0x00, // 'c'
+  0x00, 0x00, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07,
+  0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x07, 0xE1, 0xFC, 0x3F, 0xE7, 0xF1, 0xFF, 0xDF, 0xCF, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFD, 0xFC, 0x1F, 0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8,
+  0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x3F, 0xFF,
+  0xC0, 0xFF, 0x7F, 0x8F, 0xFD, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0x0F, 0xF1, 0xFC,
+  0x02, 0x00, 0x00, // 'd'
+  0x01, 0xFE, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0xFC, 0x0F, 0xFF, 0xF8, 0x7F, 0xCF, 0xF1, 0xFC, 0x0F,
+  0xEF, 0xE0, 0x1F, 0xBF, 0x80, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x06, 0x7F, 0x80, 0xF8, 0xFF,
+  0xFF, 0xE1, 0xFF, 0xFF, 0x83, 0xFF, 0xFE, 0x03, 0xFF, 0xC0, 0x00, 0xE0, 0x00, // 'e'
+  0x00, 0x7E, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x1F, 0xFF, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
+  0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
+  0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0,
+  0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, 0x1F, 0xC0, // 'f'
+  0x07, 0xE0, 0xF8, 0x3F, 0xE7, 0xF1, 0xFF, 0xDF, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFD, 0xFC, 0x1F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x3F, 0xDF, 0xC1, 0xFF, 0x7F, 0xFF, 0xFC, 0xFF,
+  0xFF, 0xF1, 0xFF, 0xDF, 0xC3, 0xFE, 0x7F, 0x03, 0xE1, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x8C,
+  0x01, 0xFE, 0x3C, 0x1F, 0xF0, 0xFF, 0xFF, 0xC3, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x0F, 0xFE, 0x00, // 'g'
+  0x7C, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x03,
+  0xF8, 0x00, 0x1F, 0xC0, 0x00, 0xFE, 0x1F, 0x87, 0xF3, 0xFE, 0x3F, 0xBF, 0xF9, 0xFF, 0xFF, 0xEF,
+  0xFF, 0xFF, 0x7F, 0xC3, 0xFF, 0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
+  0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE,
+  0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80, // 'h'
+  0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // 'i'
+  0x07, 0xC1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x07, 0xC1, 0xFC, 0x3F, 0x87,
+  0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8,
+  0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7E, 0x1F, 0xDF, 0xFB, 0xFE,
+  0x7F, 0x8F, 0xC0, // 'j'
+  0x7C, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00,
+  0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x03, 0xFB, 0xF8, 0x1F, 0xEF, 0xE0, 0xFF, 0x3F, 0x87,
+  0xF8, 0xFE, 0x3F, 0xC3, 0xF9, 0xFE, 0x0F, 0xEF, 0xE0, 0x3F, 0xFF, 0x00, 0xFF, 0xF8, 0x03, 0xFF,
+  0xC0, 0x0F, 0xFF, 0x00, 0x3F, 0xFE, 0x00, 0xFF, 0xFC, 0x03, 0xFB, 0xF8, 0x0F, 0xE7, 0xF0, 0x3F,
+  0x8F, 0xE0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x8F, 0xE0, 0xFF, 0x3F, 0x81, 0xFE, 0xFE, 0x03, 0xFC, // 'k'
+  0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, // 'l'
+  0x7C, 0x3F, 0x01, 0xF8, 0x7F, 0x3F, 0xC3, 0xFF, 0x3F, 0xFF, 0xF3, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+  0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xE1, 0xFF, 0xFC, 0x1F, 0xE0, 0xFF, 0xFC, 0x0F, 0xF0,
+  0x3F, 0xFE, 0x07, 0xF0, 0x1F, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0x81, 0xFC, 0x07, 0xFF, 0xC0, 0xFE,
+  0x03, 0xFF, 0xE0, 0x7F, 0x01, 0xFF, 0xF0, 0x3F, 0x80, 0xFF, 0xF8, 0x1F, 0xC0, 0x7F, 0xFC, 0x0F,
+  0xE0, 0x3F, 0xFE, 0x07, 0xF0, 0x1F, 0xFF, 0x03, 0xF8, 0x0F, 0xFF, 0x81, 0xFC, 0x07, 0xFF, 0xC0,
+  0xFE, 0x03, 0xFF, 0xE0, 0x7F, 0x01, 0xF8, // 'm'
+  0x7C, 0x1F, 0x87, 0xF3, 0xFE, 0x3F, 0xBF, 0xF9, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x7F, 0xC3, 0xFF,
+  0xFC, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF,
+  0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF,
+  0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0x80, // 'n'
+  0x01, 0xFE, 0x00, 0x3F, 0xFE, 0x01, 0xFF, 0xFE, 0x0F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF9, 0xFC, 0x0F,
+  0xEF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xC0, 0x1F, 0xFF, 0x00,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0xFE, 0x7F, 0x87, 0xF8, 0xFF,
+  0xFF, 0xC3, 0xFF, 0xFE, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x00, 0xC0, 0x00, // 'o'
+  0x7C, 0x3F, 0x83, 0xF9, 0xFF, 0x0F, 0xEF, 0xFE, 0x3F, 0xFF, 0xFC, 0xFF, 0xFF, 0xFB, 0xFE, 0x0F,
+  0xEF, 0xF0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xC0, 0xFE, 0xFF, 0xC7, 0xFB, 0xFF,
+  0xFF, 0xCF, 0xFF, 0xFF, 0x3F, 0xBF, 0xF8, 0xFE, 0x7F, 0x83, 0xF8, 0x10, 0x0F, 0xE0, 0x00, 0x3F,
+  0x80, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00, 0x00, // 'p'
+  0x07, 0xE0, 0xF8, 0x3F, 0xE7, 0xF1, 0xFF, 0xDF, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFD, 0xFC, 0x1F,
+  0xFF, 0xE0, 0x3F, 0xFF, 0x80, 0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0x80,
+  0x7F, 0xFE, 0x01, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0xC0, 0xFF, 0x7F, 0x8F, 0xFD, 0xFF,
+  0xFF, 0xF3, 0xFF, 0xFF, 0xC7, 0xFF, 0x7F, 0x0F, 0xF1, 0xFC, 0x02, 0x07, 0xF0, 0x00, 0x1F, 0xC0,
+  0x00, 0x7F, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F, 0x00, 0x01, 0xFC, // 'q'
+  0x7C, 0x3F, 0xFC, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xC0, 0x7F, 0x80, 0xFE,
+  0x01, 0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x1F, 0xC0, 0x3F, 0x80, 0x7F, 0x00, 0xFE, 0x01,
+  0xFC, 0x03, 0xF8, 0x07, 0xF0, 0x0F, 0xE0, 0x00, // 'r'
+  0x0F, 0xFE, 0x07, 0xFF, 0xF1, 0xFF, 0xFE, 0x3F, 0xFF, 0xCF, 0xF0, 0xF9, 0xF8, 0x01, 0x3F, 0x00,
+  0x07, 0xF0, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xC1, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0, 0x7F, 0xFC, 0x00,
+  0x3F, 0x80, 0x03, 0xF8, 0x00, 0x7F, 0xF0, 0x0F, 0xDF, 0xFF, 0xFB, 0xFF, 0xFF, 0x7F, 0xFF, 0xC7,
+  0xFF, 0xE0, 0x01, 0x80, 0x00, // 's'
+  0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+  0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x7F, 0xF8, 0x3F,
+  0xFE, 0x0F, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xC0, // 't'
+  0xFC, 0x03, 0xF7, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x3F, 0xFF, 0x01, 0xFF,
+  0xF8, 0x0F, 0xFF, 0xC0, 0x7F, 0xFE, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x80, 0xFF, 0xFC, 0x07, 0xFF,
+  0xE0, 0x3F, 0xFF, 0x01, 0xFF, 0xF8, 0x1F, 0xFF, 0xC1, 0xFF, 0xFF, 0xBF, 0xFB, 0xFF, 0xFF, 0xDF,
+  0xFF, 0xFE, 0x7F, 0xF7, 0xF1, 0xFE, 0x3F, 0x80, 0x80, 0x00, // 'u'
+  0xFC, 0x00, 0x7D, 0xFC, 0x01, 0xFF, 0xF8, 0x03, 0xF3, 0xF0, 0x0F, 0xE7, 0xF0, 0x1F, 0x87, 0xE0,
+  0x3F, 0x0F, 0xC0, 0xFE, 0x1F, 0xC1, 0xF8, 0x1F, 0x87, 0xF0, 0x3F, 0x0F, 0xC0, 0x3F, 0x1F, 0x80,
+  0x7E, 0x7F, 0x00, 0xFC, 0xFC, 0x00, 0xFD, 0xF8, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x03, 0xFF,
+  0x80, 0x07, 0xFE, 0x00, 0x07, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xE0, 0x00, // 'v'
+  0xF8, 0x07, 0xC0, 0x7F, 0xF8, 0x1F, 0x80, 0xFF, 0xF0, 0x3F, 0x81, 0xFF, 0xE0, 0x7F, 0x07, 0xFF,
+  0xE0, 0xFE, 0x0F, 0xCF, 0xC3, 0xFC, 0x1F, 0x9F, 0x87, 0xFC, 0x3F, 0x3F, 0x0F, 0xF8, 0xFE, 0x7F,
+  0x1E, 0xF1, 0xF8, 0x7E, 0x7D, 0xE3, 0xF0, 0xFC, 0xF3, 0xE7, 0xE1, 0xF9, 0xE3, 0xDF, 0xC3, 0xFB,
+  0xC7, 0xBF, 0x03, 0xFF, 0x8F, 0xFE, 0x07, 0xFF, 0x1F, 0xFC, 0x0F, 0xFC, 0x3F, 0xF0, 0x0F, 0xF8,
+  0x3F, 0xE0, 0x1F, 0xF0, 0x7F, 0xC0, 0x3F, 0xE0, 0xFF, 0x80, 0x7F, 0x81, 0xFE, 0x00, 0x7F, 0x01,
+  0xFC, 0x00, // 'w'
+  0x7E, 0x00, 0xFD, 0xFC, 0x07, 0xF7, 0xF0, 0x3F, 0x8F, 0xE1, 0xFC, 0x1F, 0xC7, 0xE0, 0x3F, 0x3F,
+  0x80, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x07, 0xFC, 0x00, 0x1F, 0xE0, 0x00, 0x7F,
+  0xC0, 0x03, 0xFF, 0x00, 0x1F, 0xFE, 0x00, 0xFF, 0xFC, 0x03, 0xF3, 0xF8, 0x1F, 0xC7, 0xE0, 0xFE,
+  0x1F, 0xC7, 0xF0, 0x3F, 0x9F, 0xC0, 0x7F, 0xFE, 0x01, 0xFC, // 'x'
+  0xFC, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0xE0, 0x0F, 0xDF, 0x80, 0x7F, 0x7F, 0x01, 0xF8, 0xFC, 0x07,
+  0xE3, 0xF0, 0x3F, 0x8F, 0xE0, 0xFC, 0x1F, 0x83, 0xF0, 0x7F, 0x1F, 0x80, 0xFC, 0x7E, 0x03, 0xF1,
+  0xF8, 0x07, 0xEF, 0xC0, 0x1F, 0xBF, 0x00, 0x7F, 0xF8, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0x80, 0x07,
+  0xFC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xC0, 0x00,
+  0x3F, 0x00, 0x01, 0xFC, 0x00, 0x7F, 0xE0, 0x01, 0xFF, 0x00, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, // 'y'
+  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xF0, 0x07, 0xF8,
+  0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x03,
+  0xF8, 0x01, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, // 'z'
+  0x00, 0x0F, 0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x3F, 0xF8, 0x1F, 0x80, 0x1F, 0xC0, 0x0F,
+  0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x1F, 0x80,
+  0x3F, 0xC0, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x00, 0xFE, 0x00, 0x3F, 0x00, 0x1F,
+  0xC0, 0x0F, 0xE0, 0x07, 0xF0, 0x03, 0xF8, 0x01, 0xFC, 0x00, 0xFE, 0x00, 0x7F, 0x00, 0x3F, 0x80,
+  0x0F, 0xE0, 0x07, 0xFF, 0x03, 0xFF, 0x80, 0xFF, 0xC0, 0x1F, 0xE0, // '{'
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, // '|'
+  0xF8, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0xFE, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x0F,
+  0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x80, 0x1F, 0xC0,
+  0x07, 0xF8, 0x03, 0xFF, 0x80, 0x7F, 0xC0, 0x7F, 0xE0, 0x7F, 0xF0, 0x3F, 0x80, 0x3F, 0x80, 0x1F,
+  0xC0, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00,
+  0x3F, 0x81, 0xFF, 0xC0, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xC0, 0x00, // '}'
+  0x1F, 0xE0, 0x03, 0x3F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFE, 0xC0,
+  0x0F, 0xF8, 0x80, 0x01, 0xC0, // '~'
+};
+
+const GFXglyph FreeSansBold24pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,  13,    0,    0 }, // ' '
+  {     0,   7,  27,  17,    5,  -27 }, // '!'
+  {    24,  12,  10,  20,    4,  -27 }, // '"'
+  {    39,  26,  27,  32,    3,  -27 }, // '#'
+  {   127,  21,  35,  26,    3,  -29 }, // '$'
+  {   219,  35,  29,  38,    1,  -28 }, // '%'
+  {   346,  29,  29,  33,    2,  -28 }, // '&'
+  {   452,   4,  10,  12,    4,  -27 }, // '''
+  {   457,  11,  34,  17,    3,  -29 }, // '('
+  {   504,  11,  34,  17,    3,  -29 }, // ')'
+  {   551,  18,  18,  20,    1,  -28 }, // '*'
+  {   592,  24,  24,  32,    4,  -24 }, // '+'
+  {   664,   8,  12,  14,    2,   -7 }, // ','
+  {   676,  12,   6,  16,    2,  -14 }, // '-'
+  {   685,   6,   7,  14,    4,   -7 }, // '.'
+  {   691,  13,  31,  14,    0,  -27 }, // '/'
+  {   742,  22,  29,  26,    2,  -28 }, // '0'
+  {   822,  20,  27,  26,    4,  -27 }, // '1'
+  {   890,  20,  28,  26,    3,  -28 }, // '2'
+  {   960,  20,  29,  26,    3,  -28 }, // '3'
+  {  1033,  22,  27,  26,    2,  -27 }, // '4'
+  {  1108,  21,  28,  26,    3,  -27 }, // '5'
+  {  1182,  22,  29,  26,    2,  -28 }, // '6'
+  {  1262,  20,  27,  26,    3,  -27 }, // '7'
+  {  1330,  22,  29,  26,    2,  -28 }, // '8'
+  {  1410,  22,  29,  26,    2,  -28 }, // '9'
+  {  1490,   7,  21,  15,    4,  -21 }, // ':'
+  {  1509,   8,  26,  15,    3,  -21 }, // ';'
+  {  1535,  24,  21,  32,    4,  -22 }, // '<'
+  {  1598,  24,  13,  32,    4,  -18 }, // '='
+  {  1637,  24,  21,  32,    4,  -22 }, // '>'
+  {  1700,  16,  28,  22,    3,  -28 }, // '?'
+  {  1756,  33,  33,  38,    2,  -26 }, // '@'
+  {  1893,  29,  27,  29,    0,  -27 }, // 'A'
+  {  1991,  23,  27,  29,    3,  -27 }, // 'B'
+  {  2069,  23,  29,  28,    2,  -28 }, // 'C'
+  {  2153,  26,  27,  31,    3,  -27 }, // 'D'
+  {  2241,  20,  27,  26,    3,  -27 }, // 'E'
+  {  2309,  20,  27,  26,    3,  -27 }, // 'F'
+  {  2377,  26,  29,  31,    2,  -28 }, // 'G'
+  {  2472,  25,  27,  31,    3,  -27 }, // 'H'
+  {  2557,   8,  27,  14,    3,  -27 }, // 'I'
+  {  2584,  13,  35,  14,   -2,  -27 }, // 'J'
+  {  2641,  27,  27,  29,    3,  -27 }, // 'K'
+  {  2733,  20,  27,  24,    3,  -27 }, // 'L'
+  {  2801,  31,  27,  37,    3,  -27 }, // 'M'
+  {  2906,  25,  27,  31,    3,  -27 }, // 'N'
+  {  2991,  28,  29,  32,    2,  -28 }, // 'O'
+  {  3093,  23,  27,  28,    3,  -27 }, // 'P'
+  {  3171,  28,  34,  32,    2,  -28 }, // 'Q'
+  {  3290,  25,  27,  29,    3,  -27 }, // 'R'
+  {  3375,  21,  29,  27,    3,  -28 }, // 'S'
+  {  3452,  25,  27,  26,    0,  -27 }, // 'T'
+  {  3537,  24,  28,  31,    3,  -27 }, // 'U'
+  {  3621,  28,  27,  29,    1,  -27 }, // 'V'
+  {  3716,  39,  27,  41,    1,  -27 }, // 'W'
+  {  3848,  27,  27,  29,    1,  -27 }, // 'X'
+  {  3940,  27,  27,  27,    0,  -27 }, // 'Y'
+  {  4032,  24,  27,  27,    2,  -27 }, // 'Z'
+  {  4113,  12,  34,  17,    3,  -29 }, // '['
+  {  4164,  13,  31,  14,    0,  -27 }, // '\'
+  {  4215,  11,  34,  17,    3,  -29 }, // ']'
+  {  4262,  23,  10,  32,    4,  -27 }, // '^'
+  {  4291,  19,   4,  19,    0,    5 }, // '_'
+  {  4301,  10,   7,  19,    2,  -30 }, // '`'
+  {  4310,  20,  22,  25,    2,  -21 }, // 'a'
+  {  4365,  22,  30,  27,    3,  -29 }, // 'b'
+  {  4448,  18,  22,  22,    2,  -21 }, // 'c'
+  {  4498,  22,  30,  27,    2,  -29 }, // 'd'
+  {  4581,  22,  22,  26,    2,  -21 }, // 'e'
+  {  4642,  16,  29,  16,    1,  -29 }, // 'f'
+  {  4700,  22,  29,  27,    2,  -21 }, // 'g'
+  {  4780,  21,  29,  27,    3,  -29 }, // 'h'
+  {  4857,   7,  29,  13,    3,  -29 }, // 'i'
+  {  4883,  11,  37,  13,   -1,  -29 }, // 'j'
+  {  4934,  22,  29,  25,    3,  -29 }, // 'k'
+  {  5014,   7,  29,  13,    3,  -29 }, // 'l'
+  {  5040,  33,  21,  39,    3,  -21 }, // 'm'
+  {  5127,  21,  21,  27,    3,  -21 }, // 'n'
+  {  5183,  22,  22,  26,    2,  -21 }, // 'o'
+  {  5244,  22,  29,  27,    3,  -21 }, // 'p'
+  {  5324,  22,  29,  27,    2,  -21 }, // 'q'
+  {  5404,  15,  21,  19,    3,  -21 }, // 'r'
+  {  5444,  19,  22,  22,    2,  -21 }, // 's'
+  {  5497,  17,  26,  18,    0,  -26 }, // 't'
+  {  5553,  21,  22,  27,    3,  -21 }, // 'u'
+  {  5611,  23,  21,  25,    1,  -21 }, // 'v'
+  {  5672,  31,  21,  35,    2,  -21 }, // 'w'
+  {  5754,  22,  21,  24,    1,  -21 }, // 'x'
+  {  5812,  22,  29,  25,    1,  -21 }, // 'y'
+  {  5892,  18,  21,  22,    2,  -21 }, // 'z'
+  {  5940,  17,  35,  27,    5,  -29 }, // '{'
+  {  6015,   4,  38,  14,    5,  -29 }, // '|'
+  {  6034,  17,  35,  27,    5,  -29 }, // '}'
+  {  6109,  24,   7,  32,    4,  -15 }, // '~'
+};
+
+const GFXfont FreeSansBold24pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold24pt7bBitmaps,
+  (GFXglyph *)FreeSansBold24pt7bGlyphs,
+  0x20, 0x7E, 44
+};
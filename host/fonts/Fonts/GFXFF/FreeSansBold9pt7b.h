@@ -0,0 +1,206 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans-Bold.ttf - do not edit
+// Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
+
+const uint8_t FreeSansBold9pt7bBitmaps[] PROGMEM = {
+  0xFF, 0xF4, 0xF0, // '!'
+  0xDE, 0xF6, 0x90, // '"'
+  0x09, 0x06, 0x47, 0xF9, 0xFF, 0x12, 0x0C, 0x8F, 0xF9, 0xD8, 0x24, 0x19, 0x00, // '#'
+  0x18, 0x7E, 0xFE, 0xD0, 0xF8, 0x7E, 0x1F, 0x13, 0xFF, 0x7E, 0x10, 0x10, // '$'
+  0x78, 0x41, 0x33, 0x0C, 0xC8, 0x13, 0x60, 0x79, 0x00, 0x09, 0xE0, 0x6C, 0xC1, 0x33, 0x0C, 0xC8,
+  0x21, 0xE0, // '%'
+  0x3E, 0x1C, 0x87, 0x00, 0xE0, 0x7C, 0xFB, 0xBC, 0x7F, 0x9E, 0xFF, 0x9F, 0xF0, // '&'
+  0xFD, // '''
+  0x33, 0x66, 0xEE, 0xEE, 0xE6, 0x63, 0x30, // '('
+  0x46, 0x67, 0x33, 0x33, 0x37, 0x66, 0xC0, // ')'
+  0x22, 0xB7, 0x3E, 0xA4, 0x80, // '*'
+  0x0C, 0x06, 0x03, 0x01, 0x8F, 0xF8, 0x60, 0x30, 0x18, 0x0C, 0x00, // '+'
+  0x7F, 0xEC, // ','
+  0xFF, // '-'
+  0x7F, 0x80, // '.'
+  0x18, 0xC4, 0x63, 0x10, 0x8C, 0x42, 0x30, // '/'
+  0x7E, 0xEE, 0xE7, 0xC7, 0xC7, 0xC7, 0xC7, 0xE7, 0x7E, 0x3C, // '0'
+  0xF1, 0xE0, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0xFF, 0xFC, // '1'
+  0xFE, 0xCE, 0x07, 0x06, 0x0E, 0x1C, 0x38, 0x70, 0xFF, 0xFF, // '2'
+  0xFE, 0x4E, 0x06, 0x0E, 0x3C, 0x3E, 0x07, 0x07, 0xFE, 0xFC, // '3'
+  0x1E, 0x1E, 0x3E, 0x6E, 0x4E, 0xCE, 0xFF, 0xFF, 0x0E, 0x0E, // '4'
+  0xFE, 0xFE, 0xE0, 0xFC, 0xFE, 0x07, 0x07, 0x07, 0xFE, 0xFC, // '5'
+  0x3E, 0x72, 0xE0, 0xFC, 0xFE, 0xE7, 0xE7, 0xE7, 0x7F, 0x3E, // '6'
+  0xFF, 0xFF, 0x06, 0x0E, 0x0C, 0x1C, 0x18, 0x38, 0x30, 0x70, // '7'
+  0x7E, 0xE7, 0xE7, 0xE6, 0x7C, 0xEE, 0xC7, 0xC7, 0xFF, 0x7E, // '8'
+  0x7C, 0xEE, 0xC7, 0xC7, 0xE7, 0x7F, 0x17, 0x06, 0xFE, 0xFC, // '9'
+  0xFC, 0x3F, // ':'
+  0x6D, 0x80, 0xDB, 0xD8, // ';'
+  0x01, 0x87, 0xDF, 0x1C, 0x07, 0x80, 0x78, 0x0E, // '<'
+  0x7F, 0xBF, 0xC0, 0x0F, 0xFF, 0xF8, // '='
+  0xE0, 0x3E, 0x03, 0xE0, 0x70, 0xF9, 0xE3, 0x80, // '>'
+  0xFF, 0x70, 0xC7, 0x38, 0xC2, 0x00, 0x71, 0xC0, // '?'
+  0x0F, 0x83, 0x9C, 0x60, 0x64, 0x6B, 0xCF, 0x99, 0x99, 0x99, 0x99, 0x9B, 0xCF, 0xE4, 0x00, 0x30,
+  0x41, 0xF8, // '@'
+  0x0E, 0x03, 0xE0, 0x7C, 0x1D, 0x83, 0xB8, 0x63, 0x1F, 0xF3, 0xFE, 0x60, 0xDC, 0x1C, // 'A'
+  0xFE, 0x7F, 0xB8, 0xDC, 0xEF, 0xE7, 0xFB, 0x8F, 0xC7, 0xFF, 0x7F, 0x00, // 'B'
+  0x3F, 0x7B, 0xE0, 0xE0, 0xC0, 0xC0, 0xE0, 0xE0, 0x7F, 0x3F, // 'C'
+  0xFF, 0x3F, 0xEE, 0x3B, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x8E, 0xFF, 0xBF, 0x80, // 'D'
+  0xFE, 0xFE, 0xE0, 0xE0, 0xFE, 0xFE, 0xE0, 0xE0, 0xFF, 0xFF, // 'E'
+  0xFF, 0xFF, 0x87, 0x0F, 0xFF, 0xF8, 0x70, 0xE1, 0xC0, // 'F'
+  0x3F, 0x9E, 0xEE, 0x03, 0x80, 0xC3, 0xB1, 0xFE, 0x1F, 0x87, 0x7F, 0xCF, 0xE0, // 'G'
+  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xFF, 0xFF, 0xFE, 0x1F, 0x87, 0xE1, 0xF8, 0x70, // 'H'
+  0xFF, 0xFF, 0xFF, 0xFC, // 'I'
+  0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCF, 0xEE, 0x00, // 'J'
+  0xE3, 0xB9, 0xCE, 0xE3, 0xF0, 0xF8, 0x3F, 0x0F, 0xE3, 0x9C, 0xE3, 0xB8, 0x70, // 'K'
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF, 0xFF, // 'L'
+  0xF0, 0xFF, 0x0F, 0xF9, 0xFF, 0x9F, 0xEF, 0x7E, 0xF7, 0xE7, 0x7E, 0x67, 0xE0, 0x7E, 0x07, // 'M'
+  0xF1, 0xFC, 0x7F, 0x9F, 0xE7, 0xED, 0xFB, 0x7E, 0x7F, 0x9F, 0xE3, 0xF8, 0xF0, // 'N'
+  0x3F, 0x1F, 0xEE, 0x1F, 0x87, 0xC0, 0xF0, 0x3E, 0x1F, 0x87, 0x7F, 0x8F, 0xC0, // 'O'
+  0xFF, 0x7F, 0xB8, 0xFC, 0x7F, 0xF7, 0xFB, 0x81, 0xC0, 0xE0, 0x70, 0x00, // 'P'
+  0x3F, 0x1F, 0xEE, 0x1F, 0x87, 0xC0, 0xF0, 0x3E, 0x1F, 0x87, 0x7F, 0x8F, 0xC0, 0x30, 0x0E, // 'Q'
+  0xFE, 0x7F, 0xB8, 0xDC, 0x6F, 0xE7, 0xF3, 0x9D, 0xC6, 0xE3, 0xF0, 0xC0, // 'R'
+  0x7E, 0xF6, 0xC0, 0xF0, 0x7E, 0x3F, 0x07, 0x07, 0xFF, 0xFE, // 'S'
+  0xFF, 0xFF, 0xE1, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x00, // 'T'
+  0xE1, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x8F, 0xC7, 0x7F, 0x9F, 0x80, // 'U'
+  0xE0, 0xEC, 0x19, 0xC7, 0x38, 0xC3, 0x38, 0x77, 0x06, 0xC0, 0xF8, 0x1F, 0x01, 0xC0, // 'V'
+  0xC7, 0x1F, 0x1C, 0x7E, 0x79, 0xB9, 0x66, 0x6D, 0xB9, 0xB2, 0xE7, 0xCF, 0x9F, 0x3C, 0x38, 0xF0,
+  0xE1, 0xC0, // 'W'
+  0xE3, 0xB3, 0x9D, 0xC7, 0xC1, 0xC1, 0xF0, 0xF8, 0xEE, 0xE3, 0xE1, 0xC0, // 'X'
+  0xE1, 0xDC, 0xE3, 0xB8, 0xFC, 0x1E, 0x03, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, // 'Y'
+  0xFF, 0x7F, 0x81, 0x81, 0xC1, 0xC1, 0xC1, 0xC1, 0xC0, 0xFF, 0xFF, 0xC0, // 'Z'
+  0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEF, 0xF0, // '['
+  0xC2, 0x10, 0xC6, 0x10, 0xC6, 0x10, 0xC6, // '\'
+  0xFF, 0x33, 0x33, 0x33, 0x33, 0x3F, 0xF0, // ']'
+  0x38, 0x7C, 0xE6, 0x81, // '^'
+  0xFE, // '_'
+  0xCC, // '`'
+  0x7D, 0xFC, 0x1B, 0xFF, 0xF8, 0xFB, 0xFB, // 'a'
+  0xC0, 0xE0, 0xE0, 0xEE, 0xFF, 0xE7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFE, // 'b'
+  0x3D, 0xFE, 0x30, 0xC3, 0x8F, 0xDF, // 'c'
+  0x03, 0x07, 0x07, 0x77, 0xFF, 0xE7, 0xC7, 0xC7, 0xC7, 0xFF, 0x7F, // 'd'
+  0x3C, 0xFE, 0xC7, 0xFF, 0xFF, 0xC0, 0xF7, 0x7E, // 'e'
+  0x1C, 0xF3, 0x3F, 0xFD, 0xC7, 0x1C, 0x71, 0xC7, 0x00, // 'f'
+  0x73, 0xFF, 0xE7, 0xC7, 0xC7, 0xE7, 0xFF, 0x7F, 0x07, 0x7E, 0x7C, // 'g'
+  0xC0, 0xE0, 0xE0, 0xEE, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, // 'h'
+  0xDC, 0x6F, 0xFF, 0xFF, 0x80, // 'i'
+  0x67, 0x06, 0x77, 0x77, 0x77, 0x77, 0xEE, // 'j'
+  0xC0, 0xE0, 0xE0, 0xE7, 0xEE, 0xFC, 0xF8, 0xF8, 0xFC, 0xEE, 0xE7, // 'k'
+  0xDF, 0xFF, 0xFF, 0xFF, 0x80, // 'l'
+  0xCC, 0xE7, 0xFF, 0xB9, 0xCF, 0xCE, 0x7E, 0x73, 0xF3, 0x9F, 0x9C, 0xFC, 0xE7, // 'm'
+  0xCE, 0xFF, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, // 'n'
+  0x3C, 0xFE, 0xE7, 0xC7, 0xC7, 0xC7, 0xFE, 0x7C, // 'o'
+  0xCE, 0xFF, 0xE7, 0xE3, 0xE3, 0xE3, 0xFF, 0xFE, 0xE0, 0xE0, 0xE0, // 'p'
+  0x73, 0xFF, 0xE7, 0xC7, 0xC7, 0xC7, 0xFF, 0x7F, 0x07, 0x07, 0x07, // 'q'
+  0xCF, 0xFE, 0x38, 0xE3, 0x8E, 0x38, // 'r'
+  0x7D, 0xFB, 0x07, 0xC7, 0xC1, 0xF3, 0xFE, // 's'
+  0x71, 0xCF, 0xFF, 0x71, 0xC7, 0x1C, 0x3C, 0xF0, // 't'
+  0xC3, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xFF, 0x7F, // 'u'
+  0xC3, 0xC7, 0xC6, 0xEE, 0x6C, 0x7C, 0x3C, 0x38, // 'v'
+  0xC4, 0x79, 0xCF, 0x39, 0xF7, 0x77, 0xBC, 0xF7, 0x9E, 0xF3, 0x8E, // 'w'
+  0xC6, 0xEE, 0x7C, 0x38, 0x38, 0x7C, 0xEE, 0xC7, // 'x'
+  0xC3, 0xC6, 0xE6, 0x6E, 0x6C, 0x7C, 0x3C, 0x38, 0x38, 0x70, 0xF0, // 'y'
+  0xFD, 0xFC, 0x71, 0xC7, 0x1C, 0x3F, 0x7F, // 'z'
+  0x1C, 0xF3, 0x0C, 0x30, 0xCF, 0x3C, 0x30, 0xC3, 0x0E, 0x3C, // '{'
+  0xFF, 0xFC, // '|'
+  0xE3, 0xC3, 0x0C, 0x30, 0xC1, 0xCF, 0x30, 0xC3, 0x1C, 0xF0, // '}'
+  0x60, 0xFF, 0x0E, // '~'
+};
+
+const GFXglyph FreeSansBold9pt7bGlyphs[] PROGMEM = {
+  {     0,   0,   0,   5,    0,    0 }, // ' '
+  {     0,   2,  10,   6,    2,  -10 }, // '!'
+  {     3,   5,   4,   7,    1,  -10 }, // '"'
+  {     6,  10,  10,  12,    1,  -10 }, // '#'
+  {    19,   8,  12,  10,    1,  -10 }, // '$'
+  {    31,  14,  10,  14,    0,  -10 }, // '%'
+  {    49,  10,  10,  12,    1,  -10 }, // '&'
+  {    62,   2,   4,   4,    1,  -10 }, // '''
+  {    63,   4,  13,   6,    1,  -11 }, // '('
+  {    70,   4,  13,   6,    1,  -11 }, // ')'
+  {    77,   6,   6,   7,    1,  -10 }, // '*'
+  {    82,   9,   9,  12,    1,   -9 }, // '+'
+  {    93,   3,   5,   5,    1,   -3 }, // ','
+  {    95,   4,   2,   6,    1,   -5 }, // '-'
+  {    96,   3,   3,   5,    1,   -3 }, // '.'
+  {    98,   5,  11,   5,    0,  -10 }, // '/'
+  {   105,   8,  10,  10,    1,  -10 }, // '0'
+  {   115,   7,  10,  10,    2,  -10 }, // '1'
+  {   124,   8,  10,  10,    1,  -10 }, // '2'
+  {   134,   8,  10,  10,    1,  -10 }, // '3'
+  {   144,   8,  10,  10,    1,  -10 }, // '4'
+  {   154,   8,  10,  10,    1,  -10 }, // '5'
+  {   164,   8,  10,  10,    1,  -10 }, // '6'
+  {   174,   8,  10,  10,    1,  -10 }, // '7'
+  {   184,   8,  10,  10,    1,  -10 }, // '8'
+  {   194,   8,  10,  10,    1,  -10 }, // '9'
+  {   204,   2,   8,   6,    2,   -8 }, // ':'
+  {   206,   3,  10,   6,    1,   -8 }, // ';'
+  {   210,   9,   7,  12,    1,   -8 }, // '<'
+  {   218,   9,   5,  12,    1,   -7 }, // '='
+  {   224,   9,   7,  12,    1,   -8 }, // '>'
+  {   232,   6,  10,   8,    1,  -10 }, // '?'
+  {   240,  12,  12,  14,    1,  -10 }, // '@'
+  {   258,  11,  10,  11,    0,  -10 }, // 'A'
+  {   272,   9,  10,  11,    1,  -10 }, // 'B'
+  {   284,   8,  10,  10,    1,  -10 }, // 'C'
+  {   294,  10,  10,  12,    1,  -10 }, // 'D'
+  {   307,   8,  10,  10,    1,  -10 }, // 'E'
+  {   317,   7,  10,  10,    1,  -10 }, // 'F'
+  {   326,  10,  10,  12,    1,  -10 }, // 'G'
+  {   339,  10,  10,  12,    1,  -10 }, // 'H'
+  {   352,   3,  10,   5,    1,  -10 }, // 'I'
+  {   356,   5,  13,   5,   -1,  -10 }, // 'J'
+  {   365,  10,  10,  11,    1,  -10 }, // 'K'
+  {   378,   8,  10,   9,    1,  -10 }, // 'L'
+  {   388,  12,  10,  14,    1,  -10 }, // 'M'
+  {   403,  10,  10,  12,    1,  -10 }, // 'N'
+  {   416,  10,  10,  12,    1,  -10 }, // 'O'
+  {   429,   9,  10,  10,    1,  -10 }, // 'P'
+  {   441,  10,  12,  12,    1,  -10 }, // 'Q'
+  {   456,   9,  10,  11,    1,  -10 }, // 'R'
+  {   468,   8,  10,  10,    1,  -10 }, // 'S'
+  {   478,  10,  10,  10,    0,  -10 }, // 'T'
+  {   491,   9,  10,  11,    1,  -10 }, // 'U'
+  {   503,  11,  10,  11,    0,  -10 }, // 'V'
+  {   517,  14,  10,  16,    1,  -10 }, // 'W'
+  {   535,   9,  10,  11,    1,  -10 }, // 'X'
+  {   547,  10,  10,  10,    0,  -10 }, // 'Y'
+  {   560,   9,  10,  10,    1,  -10 }, // 'Z'
+  {   572,   4,  13,   6,    1,  -11 }, // '['
+  {   579,   5,  11,   5,    0,  -10 }, // '\'
+  {   586,   4,  13,   6,    1,  -11 }, // ']'
+  {   593,   8,   4,  12,    2,  -10 }, // '^'
+  {   597,   7,   1,   7,    0,    2 }, // '_'
+  {   598,   3,   2,   7,    1,  -11 }, // '`'
+  {   599,   7,   8,  10,    1,   -8 }, // 'a'
+  {   606,   8,  11,  10,    1,  -11 }, // 'b'
+  {   617,   6,   8,   8,    1,   -8 }, // 'c'
+  {   623,   8,  11,  10,    1,  -11 }, // 'd'
+  {   634,   8,   8,  10,    1,   -8 }, // 'e'
+  {   642,   6,  11,   6,    0,  -11 }, // 'f'
+  {   651,   8,  11,  10,    1,   -8 }, // 'g'
+  {   662,   8,  11,  10,    1,  -11 }, // 'h'
+  {   673,   3,  11,   5,    1,  -11 }, // 'i'
+  {   678,   4,  14,   5,    0,  -11 }, // 'j'
+  {   685,   8,  11,   9,    1,  -11 }, // 'k'
+  {   696,   3,  11,   5,    1,  -11 }, // 'l'
+  {   701,  13,   8,  15,    1,   -8 }, // 'm'
+  {   714,   8,   8,  10,    1,   -8 }, // 'n'
+  {   722,   8,   8,  10,    1,   -8 }, // 'o'
+  {   730,   8,  11,  10,    1,   -8 }, // 'p'
+  {   741,   8,  11,  10,    1,   -8 }, // 'q'
+  {   752,   6,   8,   7,    1,   -8 }, // 'r'
+  {   758,   7,   8,   8,    1,   -8 }, // 's'
+  {   765,   6,  10,   7,    0,  -10 }, // 't'
+  {   773,   8,   8,  10,    1,   -8 }, // 'u'
+  {   781,   8,   8,   9,    1,   -8 }, // 'v'
+  {   789,  11,   8,  13,    1,   -8 }, // 'w'
+  {   800,   8,   8,   9,    1,   -8 }, // 'x'
+  {   808,   8,  11,   9,    1,   -8 }, // 'y'
+  {   819,   7,   8,   8,    1,   -8 }, // 'z'
+  {   826,   6,  13,  10,    2,  -11 }, // '{'
+  {   836,   1,  14,   5,    2,  -11 }, // '|'
+  {   838,   6,  13,  10,    2,  -11 }, // '}'
+  {   848,   8,   3,  12,    2,   -6 }, // '~'
+};
+
+const GFXfont FreeSansBold9pt7b PROGMEM = {
+  (uint8_t  *)FreeSansBold9pt7bBitmaps,
+  (GFXglyph *)FreeSansBold9pt7bGlyphs,
+  0x20, 0x7E, 17
+};
@@ -0,0 +1,27 @@
+// Generated by tools/make_host_fonts.py - do not edit
+// The GFXfont structures as TFT_eSPI declares them.
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+
+#ifdef LOAD_GFXFF
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t  *bitmap;
+  GFXglyph *glyph;
+  uint16_t  first;
+  uint16_t  last;
+  uint8_t   yAdvance;
+} GFXfont;
+
+#endif // LOAD_GFXFF
+
+#endif // _GFXFONT_H_
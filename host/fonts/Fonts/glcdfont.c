@@ -0,0 +1,264 @@
+// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit
+#ifndef FONT5X7_H
+#define FONT5X7_H
+
+static const unsigned char font[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5E, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x3C, 0x16, 0x3C, 0x16,
+  0x4C, 0x5A, 0x52, 0x30, 0x00,
+  0x09, 0x49, 0x30, 0x08, 0x72,
+  0x7E, 0x49, 0x51, 0x60, 0x70,
+  0x06, 0x00, 0x00, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x00, 0x00,
+  0xC3, 0x38, 0x00, 0x00, 0x00,
+  0x04, 0x0E, 0x02, 0x00, 0x00,
+  0x10, 0x10, 0x7C, 0x10, 0x10,
+  0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x10, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00,
+  0xC0, 0x18, 0x02, 0x00, 0x00,
+  0x76, 0x41, 0x41, 0x3E, 0x00,
+  0x40, 0x43, 0x40, 0x40, 0x00,
+  0x61, 0x51, 0x49, 0x46, 0x00,
+  0x41, 0x49, 0x49, 0x36, 0x00,
+  0x18, 0x06, 0x7F, 0x30, 0x00,
+  0x4F, 0x41, 0x49, 0x30, 0x00,
+  0x7E, 0x41, 0x49, 0x78, 0x00,
+  0x01, 0x61, 0x1D, 0x03, 0x00,
+  0x7E, 0x49, 0x49, 0x76, 0x00,
+  0x4A, 0x51, 0x51, 0x3E, 0x00,
+  0x44, 0x00, 0x00, 0x00, 0x00,
+  0xC4, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x18, 0x08, 0x20, 0x24,
+  0x08, 0x08, 0x08, 0x08, 0x08,
+  0x04, 0x24, 0x20, 0x08, 0x18,
+  0x01, 0x59, 0x06, 0x00, 0x00,
+  0x44, 0x82, 0x28, 0x40, 0x28,
+  0x40, 0x38, 0x06, 0x02, 0x38,
+  0x7F, 0x49, 0x49, 0x5E, 0x00,
+  0x36, 0x40, 0x41, 0x41, 0x40,
+  0x7F, 0x41, 0x41, 0x42, 0x3E,
+  0x7F, 0x49, 0x49, 0x49, 0x00,
+  0x7F, 0x09, 0x09, 0x00, 0x00,
+  0x36, 0x40, 0x41, 0x41, 0x72,
+  0x7E, 0x08, 0x08, 0x08, 0x7E,
+  0x7E, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFE, 0x00, 0x00, 0x00,
+  0x7E, 0x18, 0x34, 0x62, 0x40,
+  0x7E, 0x40, 0x40, 0x40, 0x00,
+  0x7F, 0x06, 0x30, 0x18, 0x06,
+  0x7F, 0x06, 0x18, 0x60, 0x7E,
+  0x36, 0x41, 0x41, 0x41, 0x26,
+  0x7F, 0x01, 0x09, 0x0E, 0x00,
+  0x36, 0x41, 0x41, 0xC1, 0x26,
+  0x7F, 0x09, 0x09, 0x3E, 0x40,
+  0x4E, 0x49, 0x49, 0x70, 0x00,
+  0x01, 0x01, 0x7F, 0x01, 0x01,
+  0x3E, 0x40, 0x40, 0x40, 0x3E,
+  0x02, 0x0C, 0x70, 0x60, 0x1C,
+  0x1C, 0x60, 0x1C, 0x03, 0x38,
+  0x62, 0x1C, 0x1C, 0x22, 0x40,
+  0x06, 0x78, 0x04, 0x02, 0x00,
+  0x40, 0x61, 0x51, 0x4D, 0x47,
+  0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x18, 0xC0, 0x00, 0x00,
+  0x01, 0xFF, 0x00, 0x00, 0x00,
+  0x04, 0x02, 0x01, 0x02, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0x54, 0x54, 0x78, 0x00,
+  0x7F, 0x44, 0x44, 0x78, 0x00,
+  0x6C, 0x44, 0x44, 0x00, 0x00,
+  0x4C, 0x44, 0x44, 0x7F, 0x00,
+  0x7C, 0x54, 0x54, 0x58, 0x00,
+  0x04, 0x7E, 0x05, 0x00, 0x00,
+  0x6C, 0x44, 0x44, 0xFC, 0x00,
+  0x7F, 0x04, 0x04, 0x78, 0x00,
+  0x7D, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xFD, 0x00, 0x00, 0x00,
+  0x7F, 0x18, 0x20, 0x44, 0x00,
+  0x7F, 0x00, 0x00, 0x00, 0x00,
+  0x7C, 0x04, 0x04, 0x78, 0x04,
+  0x7C, 0x04, 0x04, 0x78, 0x00,
+  0x6C, 0x44, 0x44, 0x38, 0x00,
+  0xFC, 0x44, 0x44, 0x78, 0x00,
+  0x4C, 0x44, 0x44, 0xFC, 0x00,
+  0x7C, 0x04, 0x04, 0x00, 0x00,
+  0x54, 0x54, 0x74, 0x00, 0x00,
+  0x04, 0x7E, 0x44, 0x00, 0x00,
+  0x7C, 0x40, 0x40, 0x7C, 0x00,
+  0x04, 0x18, 0x40, 0x30, 0x0C,
+  0x38, 0x60, 0x0C, 0x38, 0x60,
+  0x6C, 0x18, 0x28, 0x44, 0x00,
+  0x04, 0x18, 0xE0, 0x30, 0x04,
+  0x40, 0x64, 0x54, 0x4C, 0x00,
+  0x10, 0x7C, 0x81, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xE7, 0x10, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x10, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif // FONT5X7_H
@@ -0,0 +1,17 @@
+#ifndef FREERTOS_FREERTOS_H
+#define FREERTOS_FREERTOS_H
+
+#include <stdint.h>
+
+// The FreeRTOS types and macros the display code uses. The tick is 1 ms, as
+// on the ESP32 Arduino core.
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#endif // FREERTOS_FREERTOS_H
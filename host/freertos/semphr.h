@@ -0,0 +1,20 @@
+#ifndef FREERTOS_SEMPHR_H
+#define FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+// There is only one task on the host, so a mutex is always free to take
+
+typedef void* SemaphoreHandle_t;
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+  static int mutex;
+  return &mutex;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif // FREERTOS_SEMPHR_H
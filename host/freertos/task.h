@@ -0,0 +1,11 @@
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+// There is only one task on the host; a delay moves the virtual clock on as
+// delay() does.
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
+
+#endif // FREERTOS_TASK_H
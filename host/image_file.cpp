@@ -0,0 +1,146 @@
+#include "image_file.h"
+#include <stdio.h>
+#include <string.h>
+
+// 5 and 6 bit channels widen to 8 bits by repeating their top bits, so the
+// 565 value comes back out of the top bits unchanged
+static void toRgb888(uint16_t color, uint8_t* rgb) {
+    uint8_t r = color >> 11;
+    uint8_t g = (color >> 5) & 0x3F;
+    uint8_t b = color & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+static uint16_t toRgb565(const uint8_t* rgb) {
+    return (uint16_t)(((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3));
+}
+
+// ============================================================================
+// PPM
+// ============================================================================
+bool writePpm(const char* path, const std::vector<uint16_t>& pixels, int width, int height) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    std::vector<uint8_t> row(width * 3);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            toRgb888(pixels[y * width + x], &row[x * 3]);
+        }
+        fwrite(row.data(), 1, row.size(), file);
+    }
+    return fclose(file) == 0;
+}
+
+bool readPpm(const char* path, std::vector<uint16_t>& pixels, int& width, int& height) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    int maxValue = 0;
+    bool ok = fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) == 3 && maxValue == 255 &&
+              width > 0 && height > 0 && fgetc(file) != EOF;
+    if (ok) {
+        std::vector<uint8_t> rgb((size_t)width * height * 3);
+        ok = fread(rgb.data(), 1, rgb.size(), file) == rgb.size();
+        pixels.resize((size_t)width * height);
+        for (size_t i = 0; ok && i < pixels.size(); i++) {
+            pixels[i] = toRgb565(&rgb[i * 3]);
+        }
+    }
+    fclose(file);
+    return ok;
+}
+
+// ============================================================================
+// PNG
+// ============================================================================
+static uint32_t crcTable[256];
+
+static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length) {
+    if (crcTable[1] == 0) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            }
+            crcTable[n] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void putBigEndian(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value >> 24);
+    out.push_back(value >> 16);
+    out.push_back(value >> 8);
+    out.push_back(value);
+}
+
+static void writeChunk(FILE* file, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    putBigEndian(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    putBigEndian(chunk, crc32(0, chunk.data() + 4, chunk.size() - 4));
+    fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+// Scanlines go in as stored (uncompressed) deflate blocks, which every PNG
+// reader accepts and which needs no compressor
+bool writePng(const char* path, const std::vector<uint16_t>& pixels, int width, int height) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(signature, 1, sizeof(signature), file);
+
+    std::vector<uint8_t> header;
+    putBigEndian(header, width);
+    putBigEndian(header, height);
+    header.push_back(8); // bits per channel
+    header.push_back(2); // RGB
+    header.push_back(0);
+    header.push_back(0);
+    header.push_back(0);
+    writeChunk(file, "IHDR", header);
+
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)height * (width * 3 + 1));
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0); // no filter
+        for (int x = 0; x < width; x++) {
+            uint8_t rgb[3];
+            toRgb888(pixels[y * width + x], rgb);
+            raw.insert(raw.end(), rgb, rgb + 3);
+        }
+    }
+
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    const size_t MAX_STORED = 65535;
+    for (size_t at = 0; at < raw.size(); at += MAX_STORED) {
+        size_t length = raw.size() - at < MAX_STORED ? raw.size() - at : MAX_STORED;
+        zlib.push_back(at + length == raw.size() ? 1 : 0);
+        zlib.push_back(length & 0xFF);
+        zlib.push_back(length >> 8);
+        zlib.push_back(~length & 0xFF);
+        zlib.push_back((~length >> 8) & 0xFF);
+        zlib.insert(zlib.end(), raw.begin() + at, raw.begin() + at + length);
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putBigEndian(zlib, (b << 16) | a);
+    writeChunk(file, "IDAT", zlib);
+    writeChunk(file, "IEND", std::vector<uint8_t>());
+
+    return fclose(file) == 0;
+}
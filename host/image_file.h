@@ -0,0 +1,15 @@
+#ifndef IMAGE_FILE_H
+#define IMAGE_FILE_H
+
+#include <stdint.h>
+#include <vector>
+
+// RGB565 images to and from files. PPM is the reference format for comparing
+// renders; PNG (uncompressed) is only for viewing.
+bool writePpm(const char* path, const std::vector<uint16_t>& pixels, int width, int height);
+bool writePng(const char* path, const std::vector<uint16_t>& pixels, int width, int height);
+
+// Reads a binary PPM written by writePpm(). Returns false if it cannot.
+bool readPpm(const char* path, std::vector<uint16_t>& pixels, int& width, int& height);
+
+#endif // IMAGE_FILE_H
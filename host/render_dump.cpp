@@ -0,0 +1,315 @@
+// Draws every screen the firmware can show with the real display code and
+// saves each one as an image, so a rendering change can be checked pixel for
+// pixel against the images from before it. Built by the native environment:
+//
+//   pio run -e native
+//   .pio/build/native/program reference
+//   (change something, rebuild)
+//   .pio/build/native/program after --compare reference
+//
+// Run it from the project folder so the smooth fonts are found in data/.
+// With --compare it exits non-zero if any image differs from its reference.
+// Text that overlaps other text, wraps or runs off the screen is listed under
+// the image it shows up in, and also makes it exit non-zero.
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include "globals.h"
+#include "display.h"
+#include "settings.h"
+#include "compositor.h"
+#include "image_file.h"
+#include "render_dump.h"
+#include <LittleFS.h>
+
+static std::string outputDir;
+static std::string referenceDir;
+static bool writePngs = false;
+
+static int imagesWritten = 0;
+static int imagesDiffering = 0;
+static int textProblems = 0;
+
+// Saves the screen as <output>/<name>.ppm and compares it with the reference
+static void capture(const std::string& name) {
+    compositeDirtyWidgets();
+
+    for (const std::string& problem : takeTextProblems()) {
+        fprintf(stderr, "%s: %s\n", name.c_str(), problem.c_str());
+        textProblems++;
+    }
+
+    int width = tft.width();
+    int height = tft.height();
+    std::vector<uint16_t> pixels((size_t)width * height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            pixels[y * width + x] = tft.readPixel(x, y);
+        }
+    }
+
+    std::string path = outputDir + "/" + name;
+    if (!writePpm((path + ".ppm").c_str(), pixels, width, height) ||
+        (writePngs && !writePng((path + ".png").c_str(), pixels, width, height))) {
+        fprintf(stderr, "%s: could not write\n", path.c_str());
+        exit(1);
+    }
+    imagesWritten++;
+
+    if (referenceDir.empty()) return;
+    std::vector<uint16_t> reference;
+    int refWidth, refHeight;
+    std::string refPath = referenceDir + "/" + name + ".ppm";
+    if (!readPpm(refPath.c_str(), reference, refWidth, refHeight)) {
+        fprintf(stderr, "%s: no reference image\n", name.c_str());
+        imagesDiffering++;
+        return;
+    }
+    if (refWidth != width || refHeight != height) {
+        fprintf(stderr, "%s: %dx%d, reference is %dx%d\n", name.c_str(), width, height, refWidth, refHeight);
+        imagesDiffering++;
+        return;
+    }
+
+    int differing = 0;
+    int left = width, top = height, right = -1, bottom = -1;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (pixels[y * width + x] == reference[y * width + x]) continue;
+            differing++;
+            left = min(left, x);
+            top = min(top, y);
+            right = max(right, x);
+            bottom = max(bottom, y);
+        }
+    }
+    if (differing > 0) {
+        fprintf(stderr, "%s: %d pixels differ in (%d,%d)-(%d,%d)\n", name.c_str(), differing, left, top, right, bottom);
+        imagesDiffering++;
+    }
+}
+
+// Moves time on in 1 ms steps, running the render task's periodic work
+static void runFor(unsigned long ms) {
+    for (unsigned long i = 0; i < ms; i++) {
+        delay(1);
+        updateDisplay();
+        handleBrightnessDisplay();
+        compositeDirtyWidgets();
+    }
+}
+
+static void showMessages(const char* const* messages, int count, int index) {
+    for (int i = 0; i < count; i++) {
+        messageHistory[i] = messages[i];
+    }
+    totalMessages = count;
+    displayMessageIndex = index;
+    currentPage = PAGE_MESSAGES;
+    displayCurrentMessage();
+}
+
+static void showMessage(const char* message) {
+    showMessages(&message, 1, 0);
+}
+
+// ============================================================================
+// SCENES
+// ============================================================================
+static void renderMenus(const std::string& prefix) {
+    currentPage = PAGE_MAIN_MENU;
+    for (int i = 0; i < NUM_MAIN_MENU_ITEMS; i++) {
+        mainMenuSelection = i;
+        drawMainMenu();
+        capture(prefix + "main_menu_" + std::to_string(i));
+    }
+    mainMenuSelection = 0;
+
+    currentPage = PAGE_INFO;
+    drawInfoPage();
+    capture(prefix + "info");
+
+    // Moving down the settings list scrolls it
+    currentPage = PAGE_SETTINGS;
+    enterSettingsMenu();
+    for (int i = 0; i < NUM_SETTINGS_ITEMS; i++) {
+        settingsMenuIndex = i;
+        drawSettingsMenu();
+        capture(prefix + "settings_" + std::to_string(i));
+    }
+
+    static const int subMenus[] = { 0, 1, 2, 3, 5, 6, 7 };
+    for (int index : subMenus) {
+        settingsMenuIndex = index;
+        enterSubMenu();
+        capture(prefix + "sub_menu_" + std::to_string(index));
+        exitSubMenu();
+    }
+
+    // The brightness overlay, then the page put back from under it
+    settingsMenuIndex = 0;
+    drawSettingsMenu();
+    showBrightnessChange();
+    capture(prefix + "brightness_overlay");
+    runFor(3100);
+    capture(prefix + "brightness_overlay_gone");
+    exitSettingsMenu();
+}
+
+static const char* LONG_MESSAGE =
+    "This message is long enough that it does not fit the message window in any font, "
+    "so it pauses at the top, scrolls down to the end, pauses there and starts again "
+    "from the top. Every scroll frame draws only the lines that reach the window.";
+
+static void renderMessages(const std::string& prefix) {
+    showMessage("Hello");
+    capture(prefix + "message_short");
+
+    showMessage("A few more words, wrapped onto several lines");
+    capture(prefix + "message_wrapped");
+
+    // Scroll states: paused at the top, part way down, paused at the bottom,
+    // and back at the top
+    showMessage(LONG_MESSAGE);
+    capture(prefix + "scroll_top");
+    runFor(SCROLL_PAUSE + 1000);
+    capture(prefix + "scroll_moving");
+    // Taller screens fit the whole message, so it never scrolls
+    for (unsigned long i = 0; messageScroll.isLong && messageScroll.state != 2 && i < 60000; i++) runFor(1);
+    capture(prefix + "scroll_bottom");
+    runFor(SCROLL_PAUSE + 1);
+    capture(prefix + "scroll_back_at_top");
+
+    // A word too long for any font, and a marquee asked for with #MARQUEE
+    showMessage("Supercalifragilisticexpialidocious-and-then-some");
+    capture(prefix + "message_overflow");
+    showMessage("[MARQUEE]Sideways scrolling text");
+    capture(prefix + "marquee_start");
+    runFor(SCROLL_PAUSE + 1500);
+    capture(prefix + "marquee_moving");
+
+    // Next and Prev end on the new message whatever the transition
+    static const char* pair[] = { "First message", "Second message" };
+    for (int style = TRANSITION_SLIDE; style <= TRANSITION_FADE; style++) {
+        messageTransition = (TransitionStyle)style;
+        showMessages(pair, 2, 0);
+        displayMessageIndex = 1;
+        displayMessageWithTransition(1);
+        capture(prefix + "transition_" + transitionOptions[style]);
+    }
+    loadTransitionSetting();
+}
+
+static void renderMirrored(const std::string& prefix) {
+    mirrorMessages = true;
+    showMessage(LONG_MESSAGE);
+    capture(prefix + "mirror_scroll_top");
+    runFor(SCROLL_PAUSE + 1000);
+    capture(prefix + "mirror_scroll_moving");
+    showMessage("[MARQUEE]Sideways scrolling text");
+    runFor(SCROLL_PAUSE + 1500);
+    capture(prefix + "mirror_marquee_moving");
+    mirrorMessages = false;
+}
+
+static void renderCards(const std::string& prefix) {
+    static const char* ranks[] = { "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K" };
+    static const char* suits[] = { "S", "H", "C", "D" };
+    static const struct { const char* tag; const char* name; } types[] = {
+        { "CARD", "symbols" },
+        { "FACE", "faces" }
+    };
+
+    for (const auto& type : types) {
+        for (const char* suit : suits) {
+            for (const char* rank : ranks) {
+                String message = String("[") + type.tag + ":" + rank + "," + suit + "]";
+                showMessage(message.c_str());
+                capture(prefix + "card_" + type.name + "_" + rank + suit);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// RENDERING
+// ============================================================================
+int renderScreens(const std::string& output, const std::string& reference) {
+    outputDir = output;
+    referenceDir = reference;
+    imagesWritten = 0;
+    imagesDiffering = 0;
+    textProblems = 0;
+    mkdir(outputDir.c_str(), 0755);
+
+    // As setup() does, with settings from an erased EEPROM
+    loadBrightness();
+    loadStandbySetting();
+    loadRotationSetting();
+    loadMirrorSetting();
+    loadSmartTextSetting();
+    loadCardTypeSetting();
+    loadTransitionSetting();
+    initializeDisplay();
+    isConnected = true;
+    batteryLevel = 76;
+    updateHeader();
+
+    // Every screen in landscape and portrait. The 180 degree rotations draw
+    // the same images, so they are only used for mirroring, whose column
+    // offsets differ.
+    for (uint8_t rotation : { 1, 0 }) {
+        screenRotation = rotation;
+        applyScreenRotation();
+        std::string prefix = std::string(rotation & 1 ? "landscape" : "portrait") + "_";
+        renderMenus(prefix);
+        renderMessages(prefix);
+        renderMirrored(prefix);
+        renderCards(prefix);
+    }
+    for (uint8_t rotation : { 3, 2 }) {
+        screenRotation = rotation;
+        applyScreenRotation();
+        renderMirrored(std::string(rotation & 1 ? "landscape180" : "portrait180") + "_");
+    }
+
+    fprintf(stderr, "%d images written to %s\n", imagesWritten, outputDir.c_str());
+    if (!referenceDir.empty()) {
+        fprintf(stderr, "%d of %d differ from %s\n", imagesDiffering, imagesWritten, referenceDir.c_str());
+    }
+    if (textProblems > 0) {
+        fprintf(stderr, "%d text problems\n", textProblems);
+    }
+    return imagesDiffering + textProblems;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+// The golden render test has its own main()
+#ifndef PIO_UNIT_TESTING
+
+static void usage() {
+    fprintf(stderr, "usage: program <output dir> [--png] [--compare <reference dir>] [--data <dir>]\n");
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argv[1][0] == '-') usage();
+    std::string output = argv[1];
+    std::string reference;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--png") == 0) {
+            writePngs = true;
+        } else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc) {
+            reference = argv[++i];
+        } else if (strcmp(argv[i], "--data") == 0 && i + 1 < argc) {
+            LittleFS.setRoot(argv[++i]);
+        } else {
+            usage();
+        }
+    }
+    return renderScreens(output, reference) > 0 ? 1 : 0;
+}
+
+#endif // PIO_UNIT_TESTING
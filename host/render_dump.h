@@ -0,0 +1,12 @@
+#ifndef RENDER_DUMP_H
+#define RENDER_DUMP_H
+
+#include <string>
+
+// Draws every screen and saves each one as <output>/<name>.ppm. With a
+// reference folder each image is also compared with the one of the same name
+// there. Returns the number of images that differ or are missing from the
+// reference plus the number of text problems, so 0 means all is well.
+int renderScreens(const std::string& output, const std::string& reference);
+
+#endif // RENDER_DUMP_H
@@ -0,0 +1,46 @@
+#include "EEPROM.h"
+#include "LittleFS.h"
+
+EEPROMClass EEPROM;
+fs::LittleFSFS LittleFS;
+
+namespace fs {
+
+File::File(FILE* file) : handle(file, fclose) {}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    return handle ? fread(buffer, 1, size, handle.get()) : 0;
+}
+
+int File::read() {
+    return handle ? fgetc(handle.get()) : -1;
+}
+
+bool File::seek(uint32_t position) {
+    return handle && fseek(handle.get(), position, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+    return handle ? (size_t)ftell(handle.get()) : 0;
+}
+
+size_t File::size() const {
+    if (!handle) return 0;
+    long at = ftell(handle.get());
+    fseek(handle.get(), 0, SEEK_END);
+    long end = ftell(handle.get());
+    fseek(handle.get(), at, SEEK_SET);
+    return (size_t)end;
+}
+
+File FS::open(const char* path, const char* mode) {
+    if (strcmp(mode, "r") != 0) return File(); // read only
+    FILE* file = fopen((root + path).c_str(), "rb");
+    return file ? File(file) : File();
+}
+
+bool FS::exists(const char* path) {
+    return (bool)open(path);
+}
+
+} // namespace fs
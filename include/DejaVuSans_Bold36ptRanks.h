@@ -0,0 +1,175 @@
+// Generated by tools/font_subset.py from dejavu-sans.bold.ttf - do not edit
+// Characters: 0123456789AJKQ
+
+#include "rle_font.h"
+
+const uint8_t DejaVuSans_Bold36ptRanksRuns[] PROGMEM = {
+  0x0E, 0x8C, 0x1A, 0x92, 0x16, 0x95, 0x12, 0x98, 0x10, 0x9A, 0x0E, 0x9C, 0x0C, 0x9E, 0x0A, 0xA0,
+  0x09, 0xA0, 0x08, 0x8D, 0x06, 0x8D, 0x06, 0x8D, 0x08, 0x8D, 0x05, 0x8C, 0x0A, 0x8C, 0x05, 0x8C,
+  0x0B, 0x8B, 0x04, 0x8C, 0x0C, 0x8C, 0x03, 0x8C, 0x0C, 0x8C, 0x03, 0x8C, 0x0D, 0x8B, 0x02, 0x8C,
+  0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C,
+  0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x9B, 0x0E, 0x9B, 0x0E, 0x9B, 0x0E, 0x9B,
+  0x0E, 0x9B, 0x0E, 0x9B, 0x0E, 0x9B, 0x0E, 0x8D, 0x00, 0x8C, 0x0E, 0x8D, 0x00, 0x8C, 0x0E, 0x8C,
+  0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C, 0x01, 0x8C, 0x0E, 0x8C,
+  0x01, 0x8C, 0x0E, 0x8C, 0x02, 0x8C, 0x0C, 0x8C, 0x03, 0x8C, 0x0C, 0x8C, 0x03, 0x8C, 0x0C, 0x8C,
+  0x04, 0x8C, 0x0A, 0x8C, 0x05, 0x8C, 0x0A, 0x8C, 0x06, 0x8C, 0x08, 0x8C, 0x07, 0x8E, 0x04, 0x8E,
+  0x08, 0xA0, 0x09, 0xA0, 0x0A, 0x9E, 0x0C, 0x9C, 0x0E, 0x9A, 0x11, 0x97, 0x13, 0x94, 0x17, 0x90,
+  0x1D, 0x89, 0x0F, // '0'
+  0x07, 0x8F, 0x0E, 0x94, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97, 0x0B, 0x97,
+  0x0B, 0x97, 0x0B, 0x87, 0x03, 0x8B, 0x0B, 0x82, 0x08, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B,
+  0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B,
+  0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B,
+  0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B,
+  0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8B, 0x17, 0x8C, 0x0A, 0xFF, 0xFF, 0xC3, // '1'
+  0x07, 0x90, 0x0F, 0x97, 0x08, 0x9D, 0x06, 0x9E, 0x05, 0x9F, 0x04, 0xA0, 0x03, 0xA1, 0x02, 0xA2,
+  0x01, 0xA2, 0x01, 0x88, 0x09, 0x90, 0x00, 0x85, 0x0D, 0x8F, 0x00, 0x83, 0x10, 0x8E, 0x00, 0x81,
+  0x13, 0x8D, 0x00, 0x80, 0x15, 0x8D, 0x16, 0x8D, 0x16, 0x8D, 0x16, 0x8D, 0x16, 0x8C, 0x17, 0x8C,
+  0x17, 0x8C, 0x16, 0x8D, 0x16, 0x8C, 0x16, 0x8D, 0x15, 0x8D, 0x16, 0x8C, 0x16, 0x8D, 0x14, 0x8E,
+  0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8D, 0x15, 0x8D, 0x14, 0x8E,
+  0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8E, 0x14, 0x8D, 0x15, 0x8D, 0x14, 0x8E, 0x15, 0xFF,
+  0xFF, 0xF1, // '2'
+  0x07, 0x91, 0x0E, 0x99, 0x0A, 0x9C, 0x08, 0x9E, 0x06, 0x9F, 0x05, 0xA0, 0x04, 0xA1, 0x03, 0xA1,
+  0x03, 0xA2, 0x02, 0x85, 0x0B, 0x90, 0x02, 0x82, 0x10, 0x8E, 0x17, 0x8D, 0x17, 0x8D, 0x18, 0x8C,
+  0x18, 0x8C, 0x18, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x16, 0x8E, 0x0B, 0x98,
+  0x0C, 0x96, 0x0E, 0x94, 0x10, 0x93, 0x11, 0x95, 0x0F, 0x97, 0x0D, 0x98, 0x0C, 0x99, 0x0B, 0x9A,
+  0x15, 0x90, 0x16, 0x8E, 0x17, 0x8E, 0x17, 0x8D, 0x18, 0x8C, 0x18, 0x8C, 0x18, 0x8C, 0x18, 0x8C,
+  0x18, 0x8C, 0x18, 0x8C, 0x17, 0x90, 0x13, 0x93, 0x10, 0x98, 0x09, 0x91, 0x00, 0xA4, 0x00, 0xA3,
+  0x01, 0xA2, 0x02, 0xA1, 0x03, 0xA0, 0x04, 0x9F, 0x05, 0x9D, 0x0A, 0x97, 0x13, 0x8D, 0x0E, // '3'
+  0x13, 0x8E, 0x1A, 0x8F, 0x1A, 0x8F, 0x19, 0x90, 0x18, 0x91, 0x18, 0x91, 0x17, 0x92, 0x16, 0x93,
+  0x16, 0x93, 0x15, 0x94, 0x14, 0x95, 0x14, 0x88, 0x00, 0x8B, 0x13, 0x89, 0x00, 0x8B, 0x12, 0x89,
+  0x01, 0x8B, 0x12, 0x88, 0x02, 0x8B, 0x11, 0x89, 0x02, 0x8B, 0x10, 0x89, 0x03, 0x8B, 0x10, 0x88,
+  0x04, 0x8B, 0x0F, 0x89, 0x04, 0x8B, 0x0E, 0x89, 0x05, 0x8B, 0x0E, 0x88, 0x06, 0x8B, 0x0D, 0x89,
+  0x06, 0x8B, 0x0C, 0x89, 0x07, 0x8B, 0x0C, 0x88, 0x08, 0x8B, 0x0B, 0x89, 0x08, 0x8B, 0x0A, 0x89,
+  0x09, 0x8B, 0x0A, 0x88, 0x0A, 0x8B, 0x09, 0x88, 0x0B, 0x8B, 0x08, 0x89, 0x0B, 0x8B, 0x08, 0x88,
+  0x0C, 0x8B, 0x07, 0x88, 0x0D, 0x8B, 0x07, 0x88, 0x0D, 0x8B, 0x07, 0xFF, 0xFF, 0xFF, 0xAD, 0x16,
+  0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E, 0x8B, 0x1E,
+  0x8B, 0x07, // '4'
+  0x01, 0xA0, 0x05, 0xA0, 0x05, 0xA0, 0x05, 0xA0, 0x05, 0xA0, 0x05, 0xA0, 0x05, 0xA0, 0x05, 0xA0,
+  0x05, 0xA0, 0x05, 0x8A, 0x1B, 0x8A, 0x1B, 0x8A, 0x1B, 0x8A, 0x1B, 0x8A, 0x1B, 0x8A, 0x1B, 0x8A,
+  0x1B, 0x8A, 0x04, 0x82, 0x13, 0x98, 0x0D, 0x9B, 0x0A, 0x9D, 0x08, 0x9E, 0x07, 0x9F, 0x06, 0xA0,
+  0x05, 0xA1, 0x04, 0xA2, 0x03, 0xA2, 0x03, 0x85, 0x0C, 0x90, 0x02, 0x82, 0x11, 0x8E, 0x18, 0x8D,
+  0x19, 0x8D, 0x18, 0x8D, 0x18, 0x8D, 0x19, 0x8C, 0x19, 0x8C, 0x19, 0x8C, 0x19, 0x8C, 0x19, 0x8C,
+  0x18, 0x8D, 0x18, 0x90, 0x14, 0x8D, 0x00, 0x84, 0x11, 0x8E, 0x00, 0x87, 0x0D, 0x8F, 0x00, 0x8A,
+  0x07, 0x91, 0x01, 0xA4, 0x01, 0xA3, 0x02, 0xA2, 0x03, 0xA1, 0x04, 0xA0, 0x06, 0x9E, 0x09, 0x9A,
+  0x0E, 0x95, 0x15, 0x8C, 0x0E, // '5'
+  0x11, 0x8D, 0x17, 0x94, 0x10, 0x99, 0x0D, 0x9A, 0x0B, 0x9C, 0x0A, 0x9D, 0x09, 0x9E, 0x08, 0x9F,
+  0x08, 0x91, 0x03, 0x89, 0x07, 0x8E, 0x0C, 0x84, 0x06, 0x8D, 0x11, 0x81, 0x06, 0x8C, 0x1A, 0x8C,
+  0x1B, 0x8B, 0x1B, 0x8C, 0x1B, 0x8B, 0x1C, 0x8B, 0x1B, 0x8C, 0x1B, 0x8B, 0x06, 0x87, 0x0D, 0x8B,
+  0x02, 0x8E, 0x0A, 0x8B, 0x00, 0x92, 0x08, 0xA1, 0x06, 0xA2, 0x05, 0xA3, 0x03, 0xA5, 0x02, 0xA6,
+  0x01, 0xA6, 0x01, 0x91, 0x06, 0x8E, 0x00, 0x90, 0x08, 0x8D, 0x00, 0x8F, 0x0A, 0x9C, 0x0C, 0x8C,
+  0x00, 0x8D, 0x0C, 0x8C, 0x00, 0x8D, 0x0C, 0x8C, 0x00, 0x8D, 0x0C, 0x8C, 0x00, 0x8D, 0x0C, 0x8C,
+  0x00, 0x8D, 0x0C, 0x8C, 0x00, 0x8D, 0x0C, 0x8C, 0x01, 0x8C, 0x0C, 0x8C, 0x01, 0x8C, 0x0C, 0x8C,
+  0x01, 0x8C, 0x0C, 0x8C, 0x02, 0x8B, 0x0C, 0x8B, 0x03, 0x8C, 0x0A, 0x8C, 0x03, 0x8C, 0x0A, 0x8C,
+  0x04, 0x8C, 0x08, 0x8C, 0x06, 0x8E, 0x02, 0x8F, 0x06, 0xA0, 0x08, 0x9E, 0x0A, 0x9C, 0x0C, 0x9A,
+  0x0E, 0x98, 0x11, 0x94, 0x15, 0x90, 0x1A, 0x8A, 0x0D, // '6'
+  0xFF, 0xFF, 0xD5, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18,
+  0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18,
+  0x8C, 0x18, 0x8B, 0x18, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17,
+  0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x18, 0x8B, 0x18, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18,
+  0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x18, 0x8B, 0x18,
+  0x8C, 0x18, 0x8C, 0x17, 0x8C, 0x18, 0x8C, 0x12, // '7'
+  0x0B, 0x90, 0x14, 0x96, 0x0F, 0x9A, 0x0C, 0x9C, 0x0A, 0x9E, 0x08, 0xA0, 0x06, 0xA2, 0x05, 0xA2,
+  0x04, 0x8F, 0x04, 0x8F, 0x03, 0x8D, 0x08, 0x8D, 0x03, 0x8C, 0x0A, 0x8C, 0x03, 0x8B, 0x0C, 0x8C,
+  0x01, 0x8C, 0x0C, 0x8C, 0x01, 0x8C, 0x0C, 0x8C, 0x02, 0x8B, 0x0C, 0x8B, 0x03, 0x8B, 0x0C, 0x8B,
+  0x03, 0x8B, 0x0C, 0x8B, 0x03, 0x8C, 0x0A, 0x8C, 0x04, 0x8B, 0x0A, 0x8B, 0x05, 0x8C, 0x08, 0x8C,
+  0x06, 0x8E, 0x03, 0x8D, 0x08, 0x9E, 0x0A, 0x9C, 0x0D, 0x98, 0x11, 0x94, 0x11, 0x98, 0x0D, 0x9C,
+  0x0A, 0x9E, 0x08, 0xA0, 0x06, 0x8D, 0x06, 0x8D, 0x04, 0x8C, 0x0A, 0x8C, 0x03, 0x8B, 0x0C, 0x8B,
+  0x02, 0x8C, 0x0C, 0x8C, 0x01, 0x8B, 0x0E, 0x8B, 0x01, 0x8B, 0x0E, 0x8B, 0x00, 0x8C, 0x0E, 0x99,
+  0x0E, 0x99, 0x0E, 0x99, 0x0E, 0x99, 0x0E, 0x8C, 0x00, 0x8B, 0x0E, 0x8B, 0x01, 0x8C, 0x0C, 0x8C,
+  0x01, 0x8D, 0x0A, 0x8D, 0x01, 0x8E, 0x08, 0x8E, 0x02, 0x90, 0x02, 0x90, 0x03, 0xA4, 0x04, 0xA2,
+  0x06, 0xA0, 0x08, 0x9E, 0x0A, 0x9C, 0x0D, 0x98, 0x11, 0x94, 0x17, 0x8C, 0x0D, // '8'
+  0x0C, 0x8C, 0x18, 0x91, 0x14, 0x95, 0x11, 0x98, 0x0D, 0x9B, 0x0B, 0x9D, 0x09, 0x9F, 0x08, 0xA0,
+  0x06, 0x8E, 0x04, 0x8D, 0x05, 0x8D, 0x08, 0x8C, 0x04, 0x8C, 0x0A, 0x8C, 0x03, 0x8B, 0x0B, 0x8C,
+  0x02, 0x8C, 0x0C, 0x8B, 0x02, 0x8C, 0x0C, 0x8C, 0x01, 0x8C, 0x0C, 0x8C, 0x01, 0x8B, 0x0D, 0x8C,
+  0x01, 0x8B, 0x0D, 0x8D, 0x00, 0x8B, 0x0D, 0x8D, 0x00, 0x8B, 0x0D, 0x8D, 0x00, 0x8C, 0x0C, 0x8D,
+  0x00, 0x8C, 0x0C, 0x8D, 0x00, 0x8C, 0x0C, 0x8D, 0x00, 0x8C, 0x0B, 0x8E, 0x00, 0x8D, 0x0A, 0x8E,
+  0x01, 0x8D, 0x08, 0x90, 0x00, 0x8E, 0x06, 0x91, 0x01, 0xA6, 0x01, 0xA5, 0x03, 0xA4, 0x04, 0xA3,
+  0x05, 0xA2, 0x06, 0xA1, 0x08, 0x91, 0x01, 0x8B, 0x0A, 0x8D, 0x03, 0x8B, 0x0E, 0x85, 0x06, 0x8C,
+  0x1B, 0x8B, 0x1C, 0x8B, 0x1B, 0x8C, 0x1B, 0x8B, 0x1B, 0x8C, 0x1B, 0x8C, 0x1A, 0x8C, 0x06, 0x82,
+  0x0F, 0x8D, 0x07, 0x85, 0x0A, 0x8F, 0x07, 0x9F, 0x08, 0x9E, 0x09, 0x9D, 0x0A, 0x9C, 0x0B, 0x9B,
+  0x0C, 0x9A, 0x0D, 0x98, 0x11, 0x94, 0x18, 0x8B, 0x12, // '9'
+  0x11, 0x90, 0x23, 0x90, 0x22, 0x91, 0x22, 0x92, 0x21, 0x92, 0x20, 0x93, 0x20, 0x94, 0x1E, 0x95,
+  0x1E, 0x95, 0x1E, 0x96, 0x1C, 0x97, 0x1C, 0x98, 0x1B, 0x8B, 0x00, 0x8B, 0x1A, 0x8C, 0x00, 0x8B,
+  0x1A, 0x8B, 0x01, 0x8C, 0x18, 0x8C, 0x02, 0x8B, 0x18, 0x8C, 0x02, 0x8B, 0x18, 0x8B, 0x03, 0x8C,
+  0x16, 0x8C, 0x04, 0x8B, 0x16, 0x8C, 0x04, 0x8C, 0x15, 0x8B, 0x05, 0x8C, 0x14, 0x8C, 0x06, 0x8B,
+  0x14, 0x8C, 0x06, 0x8C, 0x13, 0x8B, 0x07, 0x8C, 0x12, 0x8C, 0x08, 0x8B, 0x12, 0x8C, 0x08, 0x8C,
+  0x10, 0x8C, 0x09, 0x8C, 0x10, 0x8C, 0x0A, 0x8C, 0x0F, 0x8B, 0x0B, 0x8C, 0x0E, 0x8C, 0x0B, 0x8C,
+  0x0E, 0x8C, 0x0C, 0x8C, 0x0D, 0x8B, 0x0D, 0x8C, 0x0C, 0xA7, 0x0C, 0xA8, 0x0A, 0xA9, 0x0A, 0xA9,
+  0x0A, 0xAA, 0x08, 0xAB, 0x08, 0xAC, 0x07, 0xAC, 0x06, 0xAD, 0x06, 0xAE, 0x04, 0x8D, 0x14, 0x8C,
+  0x04, 0x8C, 0x15, 0x8C, 0x04, 0x8C, 0x16, 0x8C, 0x02, 0x8D, 0x16, 0x8C, 0x02, 0x8C, 0x17, 0x8D,
+  0x01, 0x8C, 0x18, 0x8C, 0x00, 0x8D, 0x18, 0x8C, 0x00, 0x8C, 0x19, 0x9A, 0x1A, 0x8C, // 'A'
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8D,
+  0x09, 0x8D, 0x09, 0x8D, 0x09, 0x8C, 0x09, 0x8D, 0x09, 0x8D, 0x08, 0x8E, 0x06, 0x8F, 0x01, 0x95,
+  0x01, 0x94, 0x02, 0x94, 0x02, 0x93, 0x03, 0x92, 0x04, 0x91, 0x05, 0x90, 0x06, 0x8E, 0x08, 0x8C,
+  0x0A, 0x89, 0x0D, // 'J'
+  0x8D, 0x11, 0x8E, 0x02, 0x8D, 0x10, 0x8E, 0x03, 0x8D, 0x0F, 0x8E, 0x04, 0x8D, 0x0E, 0x8E, 0x05,
+  0x8D, 0x0D, 0x8E, 0x06, 0x8D, 0x0C, 0x8E, 0x07, 0x8D, 0x0B, 0x8E, 0x08, 0x8D, 0x0A, 0x8E, 0x09,
+  0x8D, 0x09, 0x8E, 0x0A, 0x8D, 0x08, 0x8E, 0x0B, 0x8D, 0x07, 0x8E, 0x0C, 0x8D, 0x06, 0x8E, 0x0D,
+  0x8D, 0x05, 0x8E, 0x0E, 0x8D, 0x04, 0x8E, 0x0F, 0x8D, 0x03, 0x8E, 0x10, 0x8D, 0x02, 0x8E, 0x11,
+  0x8D, 0x01, 0x8E, 0x12, 0x8D, 0x00, 0x8E, 0x13, 0x9C, 0x14, 0x9B, 0x15, 0x9A, 0x16, 0x99, 0x17,
+  0x98, 0x18, 0x97, 0x19, 0x97, 0x19, 0x98, 0x18, 0x99, 0x17, 0x9A, 0x16, 0x9B, 0x15, 0x9C, 0x14,
+  0x9D, 0x13, 0x9E, 0x12, 0x8D, 0x00, 0x90, 0x11, 0x8D, 0x01, 0x90, 0x10, 0x8D, 0x03, 0x8F, 0x0F,
+  0x8D, 0x04, 0x8F, 0x0E, 0x8D, 0x05, 0x8F, 0x0D, 0x8D, 0x06, 0x8F, 0x0C, 0x8D, 0x07, 0x8F, 0x0B,
+  0x8D, 0x08, 0x8F, 0x0A, 0x8D, 0x09, 0x8F, 0x09, 0x8D, 0x0A, 0x8F, 0x08, 0x8D, 0x0B, 0x8F, 0x07,
+  0x8D, 0x0C, 0x8F, 0x06, 0x8D, 0x0D, 0x8F, 0x05, 0x8D, 0x0E, 0x8F, 0x04, 0x8D, 0x0F, 0x8F, 0x03,
+  0x8D, 0x10, 0x8F, 0x02, 0x8D, 0x11, 0x8F, 0x01, 0x8D, 0x12, 0x8F, 0x00, 0x8D, 0x13, 0x8F, // 'K'
+  0x11, 0x8F, 0x20, 0x95, 0x1B, 0x9A, 0x16, 0x9D, 0x13, 0xA1, 0x10, 0xA3, 0x0E, 0xA5, 0x0C, 0xA7,
+  0x0A, 0xA9, 0x08, 0x92, 0x04, 0x93, 0x07, 0x8F, 0x0B, 0x8F, 0x06, 0x8F, 0x0D, 0x8F, 0x04, 0x8F,
+  0x0F, 0x8F, 0x03, 0x8E, 0x11, 0x8E, 0x03, 0x8D, 0x13, 0x8D, 0x02, 0x8D, 0x14, 0x8E, 0x01, 0x8D,
+  0x15, 0x8D, 0x01, 0x8D, 0x15, 0x8D, 0x00, 0x8D, 0x17, 0x9B, 0x17, 0x9B, 0x17, 0x9B, 0x17, 0x9A,
+  0x19, 0x99, 0x19, 0x99, 0x19, 0x99, 0x19, 0x99, 0x19, 0x99, 0x19, 0x99, 0x19, 0x99, 0x19, 0x99,
+  0x18, 0x9B, 0x17, 0x9B, 0x17, 0x9B, 0x17, 0x9B, 0x17, 0x8C, 0x01, 0x8D, 0x15, 0x8D, 0x01, 0x8D,
+  0x15, 0x8D, 0x01, 0x8E, 0x13, 0x8D, 0x03, 0x8D, 0x13, 0x8D, 0x03, 0x8E, 0x11, 0x8E, 0x04, 0x8E,
+  0x0F, 0x8E, 0x05, 0x8F, 0x0D, 0x8F, 0x06, 0x90, 0x09, 0x90, 0x08, 0xA9, 0x09, 0xA8, 0x0B, 0xA6,
+  0x0D, 0xA4, 0x0F, 0xA2, 0x12, 0x9F, 0x14, 0x9C, 0x18, 0x99, 0x1C, 0x96, 0x20, 0x93, 0x27, 0x8C,
+  0x27, 0x8B, 0x28, 0x8B, 0x28, 0x8B, 0x27, 0x8C, 0x27, 0x8C, 0x27, 0x8C, 0x27, 0x8C, 0x27, 0x8C,
+  0x03, // 'Q'
+};
+
+const RleGlyph DejaVuSans_Bold36ptRanksGlyphs[] PROGMEM = {
+  {     0,  43,  53,  49,    3,  -52 }, // '0'
+  {   163,  36,  51,  49,    8,  -51 }, // '1'
+  {   255,  37,  52,  49,    6,  -52 }, // '2'
+  {   353,  38,  53,  49,    5,  -52 }, // '3'
+  {   464,  43,  51,  49,    3,  -51 }, // '4'
+  {   594,  39,  52,  49,    5,  -51 }, // '5'
+  {   711,  41,  53,  49,    4,  -52 }, // '6'
+  {   864,  38,  51,  49,    5,  -51 }, // '7'
+  {   952,  41,  53,  49,    4,  -52 }, // '8'
+  {  1109,  41,  53,  49,    4,  -52 }, // '9'
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3A unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3B unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3C unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3D unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3E unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x3F unused
+  {  1262,   0,   0,   0,    0,    0 }, // 0x40 unused
+  {  1262,  53,  51,  55,    1,  -51 }, // 'A'
+  {  1420,   0,   0,   0,    0,    0 }, // 0x42 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x43 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x44 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x45 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x46 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x47 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x48 unused
+  {  1420,   0,   0,   0,    0,    0 }, // 0x49 unused
+  {  1420,  24,  65,  26,   -4,  -51 }, // 'J'
+  {  1551,  50,  51,  55,    6,  -51 }, // 'K'
+  {  1726,   0,   0,   0,    0,    0 }, // 0x4C unused
+  {  1726,   0,   0,   0,    0,    0 }, // 0x4D unused
+  {  1726,   0,   0,   0,    0,    0 }, // 0x4E unused
+  {  1726,   0,   0,   0,    0,    0 }, // 0x4F unused
+  {  1726,   0,   0,   0,    0,    0 }, // 0x50 unused
+  {  1726,  52,  62,  60,    4,  -52 }, // 'Q'
+};
+
+const RleFont DejaVuSans_Bold36ptRanks PROGMEM = {
+  DejaVuSans_Bold36ptRanksRuns,
+  DejaVuSans_Bold36ptRanksGlyphs,
+  0x30, 0x51, 83
+};
@@ -0,0 +1,111 @@
+#include "backlight.h"
+#include <driver/ledc.h>
+#include <esp_idf_version.h>
+#include <freertos/semphr.h>
+
+const ledc_mode_t BACKLIGHT_MODE = LEDC_LOW_SPEED_MODE;
+const ledc_timer_t BACKLIGHT_TIMER = LEDC_TIMER_0;
+const ledc_channel_t BACKLIGHT_CHANNEL = LEDC_CHANNEL_0;
+const ledc_timer_bit_t BACKLIGHT_RESOLUTION = LEDC_TIMER_12_BIT;
+
+// Duty (of 4095) for each brightness percent: 4095 * (percent / 100) ^ 2.2, so
+// equal steps in percent look like equal steps in brightness
+static const uint16_t BACKLIGHT_GAMMA[101] = {
+       0,    0,    1,    2,    3,    6,    8,   12,   16,   20,
+      26,   32,   39,   46,   54,   63,   73,   83,   94,  106,
+     119,  132,  146,  161,  177,  194,  211,  230,  249,  269,
+     290,  311,  334,  357,  382,  407,  433,  460,  487,  516,
+     545,  576,  607,  640,  673,  707,  742,  778,  815,  852,
+     891,  931,  972, 1013, 1056, 1099, 1144, 1189, 1235, 1283,
+    1331, 1380, 1431, 1482, 1534, 1587, 1642, 1697, 1753, 1810,
+    1868, 1928, 1988, 2049, 2111, 2175, 2239, 2304, 2371, 2438,
+    2506, 2576, 2646, 2718, 2790, 2864, 2939, 3014, 3091, 3169,
+    3248, 3328, 3409, 3491, 3574, 3658, 3743, 3830, 3917, 4005,
+    4095
+};
+
+static bool backlightReady = false;
+static int targetLevel = 0;
+
+// The render task changes the brightness while the loop task dims the
+// backlight before sleep, so each change to the LEDC channel holds this
+static SemaphoreHandle_t backlightMutex = nullptr;
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 4, 0)
+static unsigned long fadeEndTime = 0; // millis() when the last fade finishes
+#endif
+
+void initBacklight() {
+    if (backlightMutex == nullptr) backlightMutex = xSemaphoreCreateMutex();
+
+    ledc_timer_config_t timer = {};
+    timer.speed_mode = BACKLIGHT_MODE;
+    timer.duty_resolution = BACKLIGHT_RESOLUTION;
+    timer.timer_num = BACKLIGHT_TIMER;
+    timer.freq_hz = BACKLIGHT_PWM_FREQUENCY;
+    timer.clk_cfg = LEDC_AUTO_CLK;
+
+    ledc_channel_config_t channel = {};
+    channel.gpio_num = BACKLIGHT_PIN;
+    channel.speed_mode = BACKLIGHT_MODE;
+    channel.channel = BACKLIGHT_CHANNEL;
+    channel.intr_type = LEDC_INTR_DISABLE;
+    channel.timer_sel = BACKLIGHT_TIMER;
+    channel.duty = 0;
+    channel.hpoint = 0;
+
+    if (ledc_timer_config(&timer) != ESP_OK || ledc_channel_config(&channel) != ESP_OK ||
+        ledc_fade_func_install(0) != ESP_OK) {
+        Serial.println("Backlight LEDC setup failed");
+        return;
+    }
+    backlightReady = true;
+    targetLevel = 0;
+}
+
+static void setDuty(uint32_t duty) {
+    ledc_set_duty(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, duty);
+    ledc_update_duty(BACKLIGHT_MODE, BACKLIGHT_CHANNEL);
+}
+
+// Starts a hardware fade to duty. The LEDC driver makes any new duty or fade
+// wait for a fade that is still running (up to the 1 s dim fade), so that one
+// is stopped where it is first. Cores older than IDF 4.4 cannot stop a fade,
+// so there the backlight jumps straight to the new duty instead.
+static void startFade(uint32_t duty, unsigned long fadeMs, ledc_fade_mode_t wait) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+    ledc_fade_stop(BACKLIGHT_MODE, BACKLIGHT_CHANNEL);
+#else
+    if ((long)(fadeEndTime - millis()) > 0) fadeMs = 0;
+    fadeEndTime = millis() + fadeMs;
+#endif
+    if (fadeMs == 0) {
+        setDuty(duty);
+        return;
+    }
+    ledc_set_fade_with_time(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, duty, fadeMs);
+    ledc_fade_start(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, wait);
+}
+
+void fadeBacklight(int level, unsigned long fadeMs) {
+    if (!backlightReady) return;
+    level = constrain(level, 0, 100);
+    xSemaphoreTake(backlightMutex, portMAX_DELAY);
+    if (fadeMs == 0 || level != targetLevel) {
+        startFade(BACKLIGHT_GAMMA[level], fadeMs, LEDC_FADE_NO_WAIT);
+    }
+    targetLevel = level;
+    xSemaphoreGive(backlightMutex);
+}
+
+int backlightLevel() {
+    return targetLevel;
+}
+
+void backlightOffForSleep() {
+    if (!backlightReady) return;
+    xSemaphoreTake(backlightMutex, portMAX_DELAY);
+    startFade(0, BACKLIGHT_SLEEP_FADE_TIME, LEDC_FADE_WAIT_DONE);
+    ledc_stop(BACKLIGHT_MODE, BACKLIGHT_CHANNEL, 0);
+    targetLevel = 0;
+    xSemaphoreGive(backlightMutex);
+}
@@ -0,0 +1,39 @@
+#ifndef BACKLIGHT_H
+#define BACKLIGHT_H
+
+#include "globals.h"
+
+// Backlight on the LEDC peripheral. Levels are perceived brightness in percent,
+// turned into PWM duty through a gamma table, and changes are hardware fades
+// that run without the CPU.
+
+// TFT_BL is left out of the build flags so TFT_eSPI never drives this pin
+const int BACKLIGHT_PIN = 4;
+const uint32_t BACKLIGHT_PWM_FREQUENCY = 5000; // Hz
+const unsigned long BACKLIGHT_FADE_TIME = 150; // ms, brightness changes
+const unsigned long BACKLIGHT_WAKE_FADE_TIME = 400; // ms, from off after boot or sleep
+const unsigned long BACKLIGHT_SLEEP_FADE_TIME = 300; // ms, down to off before sleep
+const unsigned long BACKLIGHT_DIM_FADE_TIME = 1000; // ms, down to the dim level
+
+// Dim before sleep: this long before the standby timeout (or halfway, for short
+// timeouts) the backlight fades down to BACKLIGHT_DIM_LEVEL until there is activity
+const unsigned long DIM_BEFORE_SLEEP = 10000; // ms
+const int BACKLIGHT_DIM_LEVEL = 5; // percent
+
+// Takes over the backlight pin with the backlight off. Call it before
+// tft.init() so the panel never lights up before the first page is drawn.
+void initBacklight();
+
+// Fades to level percent (0-100) over fadeMs; 0 switches at once. A fade still
+// running is stopped where it is, so this never waits. Safe to call from any
+// task.
+void fadeBacklight(int level, unsigned long fadeMs);
+
+// Level the last fade was heading for
+int backlightLevel();
+
+// Blocks for the sleep fade until the backlight is off, then stops the PWM
+// output low
+void backlightOffForSleep();
+
+#endif // BACKLIGHT_H
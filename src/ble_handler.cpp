@@ -1,9 +1,13 @@
 #include "ble_handler.h"
 #include "display.h"
+#include "render_task.h"
+#include "render_profile.h"
 #include <BLE2902.h>
 #include <Arduino.h>
+#include <freertos/semphr.h>
 
 bool expectingCardCode = false;
+bool expectingMarquee = false;
 
 // Forward declaration
 void clearAllMessages();
@@ -14,6 +18,9 @@ extern String messageBuffer;
 extern unsigned long lastDataTime;
 extern unsigned long lastMessageReceivedTime;
 
+// messageBuffer and lastDataTime are filled by the BLE task and drained by loop()
+static SemaphoreHandle_t ingestMutex = nullptr;
+
 // ============================================================================
 // BLE CALLBACK CLASSES
 // ============================================================================
@@ -27,8 +34,10 @@ class MyCallbacks : public BLECharacteristicCallbacks {
             Serial.println("'");
             
             lastActivityTime = millis();
+            xSemaphoreTake(ingestMutex, portMAX_DELAY);
             messageBuffer += value;
             lastDataTime = millis();
+            xSemaphoreGive(ingestMutex);
         }
     }
 };
@@ -36,22 +45,21 @@ class MyCallbacks : public BLECharacteristicCallbacks {
 class MyServerCallbacks : public BLEServerCallbacks {
     void onConnect(BLEServer* pServer) {
         Serial.println("Client connected");
-        setConnected(true);
+        postRenderCommand(RENDER_CONNECTION, 1);
+        xSemaphoreTake(ingestMutex, portMAX_DELAY);
         messageBuffer = "";
         lastDataTime = 0;
+        xSemaphoreGive(ingestMutex);
         lastActivityTime = millis();
     }
 
     void onDisconnect(BLEServer* pServer) {
         Serial.println("Client disconnected");
-        setConnected(false);
-        if (messageBuffer.length() > 0) {
-            messageBuffer.trim();
-            if (messageBuffer.length() > 0) {
-                addMessageToHistory(messageBuffer);
-            }
-            messageBuffer = "";
-        }
+        postRenderCommand(RENDER_CONNECTION, 0);
+        // Let loop() hand over whatever is left in the buffer straight away
+        xSemaphoreTake(ingestMutex, portMAX_DELAY);
+        lastDataTime = 0;
+        xSemaphoreGive(ingestMutex);
         delay(500);
         BLEDevice::startAdvertising();  
     }
@@ -62,6 +70,8 @@ class MyServerCallbacks : public BLEServerCallbacks {
 // ============================================================================
 
 void setupBLE() {
+    if (ingestMutex == nullptr) ingestMutex = xSemaphoreCreateMutex();
+
     BLEDevice::init("TTGO-BLE-Display");
     BLEServer *pServer = BLEDevice::createServer();
     pServer->setCallbacks(new MyServerCallbacks());
@@ -85,7 +95,32 @@ void setupBLE() {
 void setConnected(bool connected) {
     if (isConnected != connected) {
         isConnected = connected;
-        updateHeader();
+        // Only the status square changes; the render task repaints it
+        invalidateHeader(HEADER_STATUS);
+    }
+}
+
+// Runs on the loop task. Complete lines, and a fragment that has gone quiet for
+// MESSAGE_TIMEOUT, are handed to the render task in one command.
+void processReceivedData() {
+    if (ingestMutex == nullptr) return;
+
+    String received;
+    xSemaphoreTake(ingestMutex, portMAX_DELAY);
+    int newlinePos = messageBuffer.lastIndexOf('\n');
+    if (newlinePos >= 0) {
+        received = messageBuffer.substring(0, newlinePos + 1);
+        messageBuffer = messageBuffer.substring(newlinePos + 1);
+    }
+    if (messageBuffer.length() > 0 && (millis() - lastDataTime) > MESSAGE_TIMEOUT) {
+        received += messageBuffer;
+        messageBuffer = "";
+    }
+    xSemaphoreGive(ingestMutex);
+
+    // addMessageToHistory splits it back into lines
+    if (received.length() > 0) {
+        postRenderCommand(RENDER_MESSAGE, 0, received.c_str());
     }
 }
 
@@ -103,11 +138,28 @@ bool processSmartTextMessage(String message) {
         expectingCardCode = true;
         return true;
     }
+    if (message.equalsIgnoreCase("#MARQUEE")) {
+        expectingMarquee = true;
+        return true;
+    }
+    if (message.equalsIgnoreCase("#CARDBENCH")) {
+        benchmarkCardFaces();
+        return true;
+    }
+    if (message.equalsIgnoreCase("#PROFILE")) {
+        printRenderProfile();
+        return true;
+    }
+    if (message.equalsIgnoreCase("#OVERLAY")) {
+        toggleProfileOverlay();
+        return true;
+    }
     return false;
 }
 
 // The original addMessageToHistory, but renamed and declared static
 static void addSingleMessageToHistory(String message) {
+    bool marquee = false;
     if (smartTextEnabled) {
         if (processSmartTextMessage(message)) {
             return; // Smart text command was processed, so don't add to history
@@ -121,10 +173,17 @@ static void addSingleMessageToHistory(String message) {
                 return; // Invalid card code, do nothing.
             }
         }
+        if (expectingMarquee) {
+            expectingMarquee = false;
+            marquee = true;
+        }
     }
 
     message.trim();
     if (message.length() == 0) return;
+    if (marquee && !message.startsWith("[CARD:") && !message.startsWith("[FACE:")) {
+        message = "[MARQUEE]" + message;
+    }
     
     Serial.print("Adding to history: '");
     Serial.print(message);
@@ -218,6 +277,8 @@ String getCardName(String code) {
 
     if (cardTypeSelection == CARD_TYPE_SYMBOLS) {
         return "[CARD:" + rankStr + "," + suitStr + "]";
+    } else if (cardTypeSelection == CARD_TYPE_FACES) {
+        return "[FACE:" + rankStr + "," + suitStr + "]";
     } else {
         // Convert rank and suit to words
         if (rankStr == "A") rankStr = "Ace";
@@ -5,6 +5,7 @@
 
 void setupBLE();
 void setConnected(bool connected);
+void processReceivedData();
 void addMessageToHistory(String message);
 bool processSmartTextMessage(String message);
 void checkAutoClear();
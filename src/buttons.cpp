@@ -1,8 +1,10 @@
 #include "buttons.h"
 #include "display.h"
 #include "settings.h"
+#include "render_task.h"
 
-// Button state variables are now encapsulated in this file
+// Button state variables are now encapsulated in this file. Only the input
+// loop reads the pins; the handlers below run on the render task.
 static int lastButton1State = HIGH;
 static int lastButton2State = HIGH;
 static unsigned long lastDebounceTime1 = 0;
@@ -13,26 +15,64 @@ static bool button1LongPress = false;
 static bool button2LongPress = false;
 
 // ============================================================================
-// MAIN BUTTON DISPATCHER
+// INPUT POLLING
 // ============================================================================
+
+// Posts a press on the falling edge (debounced) and a long press once the
+// button has been held for LONG_PRESS_TIME
+static void pollButton(int button, int state, int& lastState, unsigned long& lastDebounceTime,
+                       unsigned long& pressTime, bool& longPress) {
+    if (state == LOW && lastState == HIGH) {
+        if ((millis() - lastDebounceTime) > DEBOUNCE_DELAY) {
+            postRenderCommand(RENDER_BUTTON, button);
+            lastDebounceTime = millis();
+        }
+    }
+
+    if (state == LOW) {
+        if (pressTime == 0) {
+            pressTime = millis();
+        } else if (!longPress && (millis() - pressTime > LONG_PRESS_TIME)) {
+            postRenderCommand(RENDER_LONG_PRESS, button);
+            longPress = true; // Prevent repeated trigger
+        }
+    } else {
+        pressTime = 0;
+        longPress = false;
+    }
+
+    lastState = state;
+}
+
 void handleButtons() {
+    int button1State = digitalRead(BUTTON_1);
+    int button2State = digitalRead(BUTTON_2);
+
     // Update activity time on any button activity
-    if (digitalRead(BUTTON_1) == LOW || digitalRead(BUTTON_2) == LOW) {
+    if (button1State == LOW || button2State == LOW) {
         lastActivityTime = millis();
     }
 
+    pollButton(1, button1State, lastButton1State, lastDebounceTime1, button1PressTime, button1LongPress);
+    pollButton(2, button2State, lastButton2State, lastDebounceTime2, button2PressTime, button2LongPress);
+}
+
+// ============================================================================
+// MAIN BUTTON DISPATCHER
+// ============================================================================
+void handleButtonEvent(int button, bool longPress) {
     switch (currentPage) {
         case PAGE_MAIN_MENU:
-            handleMainMenuButtons();
+            if (!longPress) handleMainMenuButtons(button);
             break;
         case PAGE_INFO:
-            handleInfoPageButtons();
+            if (!longPress) handleInfoPageButtons(button);
             break;
         case PAGE_MESSAGES:
-            handleMessageButtons();
+            handleMessageButtons(button, longPress);
             break;
         case PAGE_SETTINGS:
-            handleSettingsMenu();
+            if (!longPress) handleSettingsMenu(button);
             break;
     }
 }
@@ -41,195 +81,115 @@ void handleButtons() {
 // PAGE-SPECIFIC BUTTON HANDLERS
 // ============================================================================
 
-void handleMainMenuButtons() {
-    int button1State = digitalRead(BUTTON_1);
-    int button2State = digitalRead(BUTTON_2);
-
+void handleMainMenuButtons(int button) {
     // Button 1 (Nxt->) - Cycle through menu items
-    if (button1State == LOW && lastButton1State == HIGH) {
-        if ((millis() - lastDebounceTime1) > DEBOUNCE_DELAY) {
-            mainMenuSelection = (mainMenuSelection + 1) % NUM_MAIN_MENU_ITEMS;
-            drawMainMenu();
-            lastDebounceTime1 = millis();
-        }
+    if (button == 1) {
+        mainMenuSelection = (mainMenuSelection + 1) % NUM_MAIN_MENU_ITEMS;
+        drawMainMenu();
     }
 
     // Button 2 (Sel->) - Select a menu item
-    if (button2State == LOW && lastButton2State == HIGH) {
-        if ((millis() - lastDebounceTime2) > DEBOUNCE_DELAY) {
-            if (mainMenuSelection == 0) { // Messages
-                currentPage = PAGE_MESSAGES;
-                displayCurrentMessage();
-            } else if (mainMenuSelection == 1) { // Settings
-                currentPage = PAGE_SETTINGS;
-                enterSettingsMenu();
-            } else if (mainMenuSelection == 2) { // Info
-                currentPage = PAGE_INFO;
-                drawInfoPage();
-            }
-            lastDebounceTime2 = millis();
+    if (button == 2) {
+        if (mainMenuSelection == 0) { // Messages
+            currentPage = PAGE_MESSAGES;
+            displayCurrentMessage();
+        } else if (mainMenuSelection == 1) { // Settings
+            currentPage = PAGE_SETTINGS;
+            enterSettingsMenu();
+        } else if (mainMenuSelection == 2) { // Info
+            currentPage = PAGE_INFO;
+            drawInfoPage();
         }
     }
-
-    lastButton1State = button1State;
-    lastButton2State = button2State;
 }
 
-void handleInfoPageButtons() {
-    int button1State = digitalRead(BUTTON_1);
-    int button2State = digitalRead(BUTTON_2);
-
+void handleInfoPageButtons(int button) {
     // Any button press returns to the main menu
-    if ((button1State == LOW && lastButton1State == HIGH) || (button2State == LOW && lastButton2State == HIGH)) {
-        if ((millis() - lastDebounceTime1) > DEBOUNCE_DELAY && (millis() - lastDebounceTime2) > DEBOUNCE_DELAY) {
-            currentPage = PAGE_MAIN_MENU;
-            mainMenuSelection = 0; // Reset selection
-            drawMainMenu();
-            lastDebounceTime1 = millis();
-            lastDebounceTime2 = millis();
-        }
-    }
-
-    lastButton1State = button1State;
-    lastButton2State = button2State;
+    currentPage = PAGE_MAIN_MENU;
+    mainMenuSelection = 0; // Reset selection
+    drawMainMenu();
 }
 
-void handleMessageButtons() {
-    int button1State = digitalRead(BUTTON_1);
-    int button2State = digitalRead(BUTTON_2);
-
+void handleMessageButtons(int button, bool longPress) {
     // Long press on either button to return to main menu
-    if (button1State == LOW) {
-        if (button1PressTime == 0) {
-            button1PressTime = millis();
-        } else if (!button1LongPress && (millis() - button1PressTime > LONG_PRESS_TIME)) {
-            Serial.println(">>> BUTTON 1 LONG PRESS - MAIN MENU");
-            currentPage = PAGE_MAIN_MENU;
-            drawMainMenu();
-            button1LongPress = true; // Prevent repeated trigger
-            return; // Exit to avoid short press detection
-        }
-    } else {
-        button1PressTime = 0;
-        button1LongPress = false;
+    if (longPress) {
+        Serial.print(">>> BUTTON ");
+        Serial.print(button);
+        Serial.println(" LONG PRESS - MAIN MENU");
+        currentPage = PAGE_MAIN_MENU;
+        drawMainMenu();
+        return;
     }
 
-    if (button2State == LOW) {
-        if (button2PressTime == 0) {
-            button2PressTime = millis();
-        } else if (!button2LongPress && (millis() - button2PressTime > LONG_PRESS_TIME)) {
-            Serial.println(">>> BUTTON 2 LONG PRESS - MAIN MENU");
+    // Button 1 (Next->) - Next message (short press)
+    if (button == 1) {
+        Serial.println(">>> BUTTON 1 PRESSED - NEXT MESSAGE");
+        if (totalMessages > 0) {
+            displayMessageIndex = (displayMessageIndex + 1) % totalMessages;
+            displayMessageWithTransition(1);
+        } else {
             currentPage = PAGE_MAIN_MENU;
             drawMainMenu();
-            button2LongPress = true; // Prevent repeated trigger
-            return; // Exit to avoid short press detection
-        }
-    } else {
-        button2PressTime = 0;
-        button2LongPress = false;
-    }
-
-    // Button 1 (Next->) - Next message (short press)
-    if (button1State == LOW && lastButton1State == HIGH) {
-        if ((millis() - lastDebounceTime1) > DEBOUNCE_DELAY) {
-            Serial.println(">>> BUTTON 1 PRESSED - NEXT MESSAGE");
-            if (totalMessages > 0) {
-                displayMessageIndex = (displayMessageIndex + 1) % totalMessages;
-                displayCurrentMessage();
-            } else {
-                currentPage = PAGE_MAIN_MENU;
-                drawMainMenu();
-            }
-            lastDebounceTime1 = millis();
         }
     }
 
     // Button 2 (Prev->) - Previous message (short press)
-    if (button2State == LOW && lastButton2State == HIGH) {
-        if ((millis() - lastDebounceTime2) > DEBOUNCE_DELAY) {
-            Serial.println(">>> BUTTON 2 PRESSED - PREVIOUS MESSAGE");
-            if (totalMessages > 0) {
-                displayMessageIndex--;
-                if (displayMessageIndex < 0) displayMessageIndex = totalMessages - 1;
-                displayCurrentMessage();
-            } else {
-                currentPage = PAGE_MAIN_MENU;
-                drawMainMenu();
-            }
-            lastDebounceTime2 = millis();
+    if (button == 2) {
+        Serial.println(">>> BUTTON 2 PRESSED - PREVIOUS MESSAGE");
+        if (totalMessages > 0) {
+            displayMessageIndex--;
+            if (displayMessageIndex < 0) displayMessageIndex = totalMessages - 1;
+            displayMessageWithTransition(-1);
+        } else {
+            currentPage = PAGE_MAIN_MENU;
+            drawMainMenu();
         }
     }
-
-    lastButton1State = button1State;
-    lastButton2State = button2State;
 }
 
-void handleSettingsNavigation() {
-    int button1State = digitalRead(BUTTON_1);
-    int button2State = digitalRead(BUTTON_2);
-    
-    if (button1State == LOW && lastButton1State == HIGH) {
-        if ((millis() - lastDebounceTime1) > DEBOUNCE_DELAY) {
+void handleSettingsNavigation(int button) {
+    if (button == 1) {
+        settingsMenuIndex++;
+        if (settingsMenuIndex >= NUM_SETTINGS_ITEMS) {
+            settingsMenuIndex = 0;
+        }
+        // If the new item is the disabled Card Type, skip it
+        if (strcmp(settingsItems[settingsMenuIndex], "Card Type") == 0 && !smartTextEnabled) {
             settingsMenuIndex++;
             if (settingsMenuIndex >= NUM_SETTINGS_ITEMS) {
                 settingsMenuIndex = 0;
             }
-            // If the new item is the disabled Card Type, skip it
-            if (strcmp(settingsItems[settingsMenuIndex], "Card Type") == 0 && !smartTextEnabled) {
-                settingsMenuIndex++;
-                if (settingsMenuIndex >= NUM_SETTINGS_ITEMS) {
-                    settingsMenuIndex = 0;
-                }
-            }
-            drawSettingsMenu();
-            lastDebounceTime1 = millis();
         }
+        drawSettingsMenu();
     }
     
-    if (button2State == LOW && lastButton2State == HIGH) {
-        if ((millis() - lastDebounceTime2) > DEBOUNCE_DELAY) {
-            // If the selected item is the disabled Card Type, do nothing
-            if (strcmp(settingsItems[settingsMenuIndex], "Card Type") == 0 && !smartTextEnabled) {
-                // Do nothing
-            } else if (settingsMenuIndex == NUM_SETTINGS_ITEMS - 1) { // Exit
-                exitSettingsMenu();
-            } else {
-                enterSubMenu();
-            }
-            lastDebounceTime2 = millis();
+    if (button == 2) {
+        // If the selected item is the disabled Card Type, do nothing
+        if (strcmp(settingsItems[settingsMenuIndex], "Card Type") == 0 && !smartTextEnabled) {
+            // Do nothing
+        } else if (settingsMenuIndex == NUM_SETTINGS_ITEMS - 1) { // Exit
+            exitSettingsMenu();
+        } else {
+            enterSubMenu();
         }
     }
-    
-    lastButton1State = button1State;
-    lastButton2State = button2State;
 }
 
-void handleSubMenuNavigation() {
-    int button1State = digitalRead(BUTTON_1);
-    int button2State = digitalRead(BUTTON_2);
-    
-    if (button1State == LOW && lastButton1State == HIGH) {
-        if ((millis() - lastDebounceTime1) > DEBOUNCE_DELAY) {
-            cycleSubMenuOption();
-            drawSubMenu();
-            lastDebounceTime1 = millis();
-        }
+void handleSubMenuNavigation(int button) {
+    if (button == 1) {
+        cycleSubMenuOption();
+        drawSubMenu();
     }
     
-    if (button2State == LOW && lastButton2State == HIGH) {
-        if ((millis() - lastDebounceTime2) > DEBOUNCE_DELAY) {
-            exitSubMenu();
-        }
+    if (button == 2) {
+        exitSubMenu();
     }
-    
-    lastButton1State = button1State;
-    lastButton2State = button2State;
 }
 
-void handleSettingsMenu() {
+void handleSettingsMenu(int button) {
     if (inSubMenu) {
-        handleSubMenuNavigation();
+        handleSubMenuNavigation(button);
     } else {
-        handleSettingsNavigation();
+        handleSettingsNavigation(button);
     }
 }
\ No newline at end of file
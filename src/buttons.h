@@ -3,13 +3,16 @@
 
 #include "globals.h"
 
-// Main button handler
+// Polls the buttons from the input loop and posts presses to the render task
 void handleButtons();
 
+// Applies a press on the render task. button is 1 or 2.
+void handleButtonEvent(int button, bool longPress);
+
 // Page-specific handlers
-void handleMainMenuButtons();
-void handleMessageButtons();
-void handleSettingsMenu();
-void handleInfoPageButtons();
+void handleMainMenuButtons(int button);
+void handleMessageButtons(int button, bool longPress);
+void handleSettingsMenu(int button);
+void handleInfoPageButtons(int button);
 
 #endif // BUTTONS_H
\ No newline at end of file
@@ -0,0 +1,304 @@
+#include "card_face.h"
+#include "card_suits.h"
+#include "pixel_kernels.h"
+
+// Card proportions, in percent of the card's width or height
+const int CARD_ASPECT_WIDTH = 5;  // width : height of a poker card
+const int CARD_ASPECT_HEIGHT = 7;
+const int INDEX_RANK_HEIGHT = 10; // of height, corner rank cap height
+const int INDEX_WIDTH = 13;       // of width, corner index column
+const int PIP_SIZE = 18;          // of width
+const int ACE_PIP_SIZE = 45;      // of width
+const int PIP_COLUMNS[3] = { 30, 50, 70 }; // of width
+const int PIP_TOP = 20;           // of height, first and last pip rows
+const int PIP_BOTTOM = 80;
+const int FRAME_INSET_X = 24;     // of width, J/Q/K frame
+const int FRAME_INSET_Y = 10;     // of height
+const int FRAME_PIP_SIZE = 12;    // of width
+const int FRAME_RANK_HEIGHT = 55; // of frame height
+
+// Pip layouts for 2-10. Each pip is column << 4 | row, with the column an index
+// into PIP_COLUMNS and the row in twelfths from PIP_TOP to PIP_BOTTOM. Pips
+// below the middle row are turned upside down.
+static const uint8_t PIPS_2[] = { 0x10, 0x1C };
+static const uint8_t PIPS_3[] = { 0x10, 0x16, 0x1C };
+static const uint8_t PIPS_4[] = { 0x00, 0x20, 0x0C, 0x2C };
+static const uint8_t PIPS_5[] = { 0x00, 0x20, 0x0C, 0x2C, 0x16 };
+static const uint8_t PIPS_6[] = { 0x00, 0x20, 0x06, 0x26, 0x0C, 0x2C };
+static const uint8_t PIPS_7[] = { 0x00, 0x20, 0x06, 0x26, 0x0C, 0x2C, 0x13 };
+static const uint8_t PIPS_8[] = { 0x00, 0x20, 0x06, 0x26, 0x0C, 0x2C, 0x13, 0x19 };
+static const uint8_t PIPS_9[] = { 0x00, 0x20, 0x04, 0x24, 0x08, 0x28, 0x0C, 0x2C, 0x16 };
+static const uint8_t PIPS_10[] = { 0x00, 0x20, 0x04, 0x24, 0x08, 0x28, 0x0C, 0x2C, 0x12, 0x1A };
+
+struct PipLayout {
+  const uint8_t* pips;
+  uint8_t count;
+};
+static const PipLayout PIP_LAYOUTS[] = {
+    { PIPS_2, sizeof(PIPS_2) }, { PIPS_3, sizeof(PIPS_3) }, { PIPS_4, sizeof(PIPS_4) },
+    { PIPS_5, sizeof(PIPS_5) }, { PIPS_6, sizeof(PIPS_6) }, { PIPS_7, sizeof(PIPS_7) },
+    { PIPS_8, sizeof(PIPS_8) }, { PIPS_9, sizeof(PIPS_9) }, { PIPS_10, sizeof(PIPS_10) }
+};
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+static const unsigned char* suitBits(char suit, uint16_t& color) {
+    switch (suit) {
+        case 'S': color = TFT_BLACK; return spade_bits;
+        case 'H': color = TFT_RED; return heart_bits;
+        case 'C': color = TFT_BLACK; return club_bits;
+        case 'D': color = TFT_RED; return diamond_bits;
+    }
+    return nullptr;
+}
+
+static CardStamp* addStamp(CardFace& face, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (face.stampCount >= MAX_CARD_STAMPS || w <= 0 || h <= 0) return nullptr;
+    CardStamp& stamp = face.stamps[face.stampCount++];
+    stamp = { x, y, w, h, nullptr, 0, 0, 0, false, color };
+    return &stamp;
+}
+
+static void addMaskStamp(CardFace& face, int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* bits,
+                         int16_t srcWidth, int16_t srcHeight, bool rotated, uint16_t color) {
+    CardStamp* stamp = addStamp(face, x, y, w, h, color);
+    if (!stamp) return;
+    stamp->bits = bits;
+    stamp->srcWidth = srcWidth;
+    stamp->srcHeight = srcHeight;
+    stamp->srcStride = (srcWidth + 7) / 8;
+    stamp->rotated = rotated;
+}
+
+// A suit pip of the given size centred on (cx, cy)
+static void addPip(CardFace& face, const unsigned char* bits, int16_t cx, int16_t cy, int16_t size,
+                   bool rotated, uint16_t color) {
+    addMaskStamp(face, cx - size / 2, cy - size / 2, size, size, bits, heart_width, heart_height, rotated, color);
+}
+
+// The same stamp turned 180 degrees about the centre of the card
+static void addRotatedCopy(CardFace& face, int index) {
+    if (face.stampCount >= MAX_CARD_STAMPS) return;
+    CardStamp copy = face.stamps[index];
+    copy.x = face.width - copy.x - copy.w;
+    copy.y = face.height - copy.y - copy.h;
+    copy.rotated = !copy.rotated;
+    face.stamps[face.stampCount++] = copy;
+}
+
+// RLE glyphs only decode top to bottom, so the rank glyphs are unpacked into
+// 1bpp masks that can be sampled in any order
+static bool decodeGlyphMask(const RleFont& font, const RleGlyph& glyph, uint8_t* mask) {
+    int16_t stride = (glyph.width + 7) / 8;
+    if (glyph.width == 0 || stride * glyph.height > CARD_GLYPH_MASK_BYTES) return false;
+    memset(mask, 0, stride * glyph.height);
+
+    RleCursor cursor;
+    RleSpan spans[MAX_RLE_SPANS];
+    beginRleGlyph(cursor, font, glyph);
+    for (int16_t row = 0; row < glyph.height; row++) {
+        uint8_t* line = mask + row * stride;
+        int count = decodeRleRow(cursor, spans);
+        for (int k = 0; k < count; k++) {
+            for (int16_t x = spans[k].x; x < spans[k].x + spans[k].length; x++) {
+                line[x >> 3] |= 0x80 >> (x & 7);
+            }
+        }
+    }
+    return true;
+}
+
+// Stamps the rank glyphs with their baseline at `baseline`, scaled so the cap
+// height is capPixels and squeezed to at most maxWidth. Returns the width used.
+static int16_t addRankText(CardFace& face, int16_t x, int16_t baseline, int16_t capPixels, int16_t maxWidth,
+                           uint16_t color, const RleGlyph** glyphs, int glyphCount, int16_t capHeight) {
+    int32_t textWidth = 0;
+    for (int i = 0; i < glyphCount; i++) {
+        textWidth += (i == glyphCount - 1) ? glyphs[i]->xOffset + glyphs[i]->width : glyphs[i]->xAdvance;
+    }
+
+    // Horizontal scale is xNum / xDen, vertical capPixels / capHeight
+    int32_t xNum = capPixels;
+    int32_t xDen = capHeight;
+    if (textWidth * xNum / xDen > maxWidth) {
+        xNum = maxWidth;
+        xDen = textWidth;
+    }
+
+    int32_t pen = 0;
+    for (int i = 0; i < glyphCount; i++) {
+        const RleGlyph* glyph = glyphs[i];
+        int16_t gx = x + (pen + glyph->xOffset) * xNum / xDen;
+        int16_t gy = baseline + glyph->yOffset * capPixels / capHeight;
+        int16_t gw = max((int32_t)1, glyph->width * xNum / xDen);
+        int16_t gh = max(1, glyph->height * capPixels / capHeight);
+        addMaskStamp(face, gx, gy, gw, gh, face.glyphMasks[i], glyph->width, glyph->height, false, color);
+        pen += glyph->xAdvance;
+    }
+    return textWidth * xNum / xDen;
+}
+
+bool layoutCardFace(CardFace& face, const char* rank, char suit, int16_t maxWidth, int16_t maxHeight,
+                    const RleFont& rankFont) {
+    uint16_t ink;
+    const unsigned char* bits = suitBits(suit, ink);
+    if (!bits) return false;
+    ink = swap565(ink);
+
+    // Rank as A, 2-10, J, Q or K
+    int value = 0;
+    if (strcmp(rank, "A") == 0) value = 1;
+    else if (strcmp(rank, "J") == 0) value = 11;
+    else if (strcmp(rank, "Q") == 0) value = 12;
+    else if (strcmp(rank, "K") == 0) value = 13;
+    else value = atoi(rank);
+    if (value < 1 || value > 13) return false;
+
+    int glyphCount = strlen(rank);
+    if (glyphCount > MAX_CARD_GLYPHS) return false;
+    const RleGlyph* glyphs[MAX_CARD_GLYPHS];
+    for (int i = 0; i < glyphCount; i++) {
+        glyphs[i] = findRleGlyph(rankFont, rank[i]);
+        if (!glyphs[i] || !decodeGlyphMask(rankFont, *glyphs[i], face.glyphMasks[i])) return false;
+    }
+    const RleGlyph* capGlyph = findRleGlyph(rankFont, 'A');
+    int16_t capHeight = capGlyph ? -capGlyph->yOffset : rankFont.yAdvance;
+
+    // Largest poker card proportions that fit
+    face.height = min((int32_t)maxHeight, (int32_t)maxWidth * CARD_ASPECT_HEIGHT / CARD_ASPECT_WIDTH);
+    face.width = face.height * CARD_ASPECT_WIDTH / CARD_ASPECT_HEIGHT;
+    face.radius = max(2, face.width / 14);
+    face.paper = swap565(TFT_WHITE);
+    face.border = swap565(TFT_DARKGREY);
+    face.background = swap565(TFT_BLACK);
+    face.stampCount = 0;
+    const int16_t w = face.width;
+    const int16_t h = face.height;
+
+    // Corner index: rank over a small pip, repeated upside down bottom right
+    int16_t pad = max(2, w / 24);
+    int16_t rankCap = max(5, h * INDEX_RANK_HEIGHT / 100);
+    int16_t indexWidth = max(5, w * INDEX_WIDTH / 100);
+    int first = face.stampCount;
+    int16_t rankWidth = addRankText(face, pad, pad + rankCap, rankCap, indexWidth, ink, glyphs, glyphCount,
+                                    capHeight);
+    int16_t indexPip = max(4, rankCap * 4 / 5);
+    addPip(face, bits, pad + rankWidth / 2, pad + rankCap + pad + indexPip / 2 + rankCap / 5, indexPip, false, ink);
+    int last = face.stampCount;
+    for (int i = first; i < last; i++) addRotatedCopy(face, i);
+
+    if (value == 1) {
+        addPip(face, bits, w / 2, h / 2, w * ACE_PIP_SIZE / 100, false, ink);
+    } else if (value <= 10) {
+        const PipLayout& pips = PIP_LAYOUTS[value - 2];
+        int16_t top = h * PIP_TOP / 100;
+        int16_t span = h * PIP_BOTTOM / 100 - top;
+        int16_t size = w * PIP_SIZE / 100;
+        for (int i = 0; i < pips.count; i++) {
+            int column = pips.pips[i] >> 4;
+            int row = pips.pips[i] & 0x0F;
+            addPip(face, bits, w * PIP_COLUMNS[column] / 100, top + span * row / 12, size, row > 6, ink);
+        }
+    } else {
+        // Court cards: a frame with the rank in the middle and a pip in two of
+        // its corners
+        int16_t fx = w * FRAME_INSET_X / 100;
+        int16_t fy = h * FRAME_INSET_Y / 100;
+        int16_t fw = w - 2 * fx;
+        int16_t fh = h - 2 * fy;
+        addStamp(face, fx, fy, fw, 1, ink);
+        addStamp(face, fx, fy + fh - 1, fw, 1, ink);
+        addStamp(face, fx, fy, 1, fh, ink);
+        addStamp(face, fx + fw - 1, fy, 1, fh, ink);
+
+        int16_t framePip = max(4, w * FRAME_PIP_SIZE / 100);
+        addPip(face, bits, fx + 2 + framePip / 2, fy + 2 + framePip / 2, framePip, false, ink);
+        addPip(face, bits, fx + fw - 2 - framePip / 2, fy + fh - 2 - framePip / 2, framePip, true, ink);
+
+        const RleGlyph* glyph = glyphs[0];
+        int16_t cap = fh * FRAME_RANK_HEIGHT / 100;
+        int16_t gw = glyph->width * cap / capHeight;
+        int16_t maxRankWidth = fw - 2 * framePip - 4;
+        if (gw > maxRankWidth) {
+            cap = cap * maxRankWidth / gw;
+            gw = maxRankWidth;
+        }
+        // Centre the glyph box itself rather than the advance
+        int16_t gh = glyph->height * cap / capHeight;
+        addMaskStamp(face, (w - gw) / 2, (h - gh) / 2, gw, gh, face.glyphMasks[0], glyph->width, glyph->height,
+                     false, ink);
+    }
+    return true;
+}
+
+// ============================================================================
+// RASTER
+// ============================================================================
+
+// Columns cut off each end of a row by the rounded corners, edge being how many
+// rows in from the top or bottom the row is
+static int16_t cornerInset(int16_t radius, int16_t edge) {
+    if (edge >= radius) return 0;
+    int32_t dy = 2 * (radius - edge) - 1; // doubled, measured to pixel centres
+    int32_t r2 = 4 * radius * radius;
+    int16_t inset = 0;
+    while (inset < radius) {
+        int32_t dx = 2 * (radius - inset) - 1;
+        if (dx * dx + dy * dy <= r2) break;
+        inset++;
+    }
+    return inset;
+}
+
+static void renderStampRow(const CardStamp& stamp, int16_t cardWidth, int16_t y, uint16_t* line) {
+    int16_t dy = y - stamp.y;
+    if (dy < 0 || dy >= stamp.h) return;
+
+    int16_t start = max((int16_t)0, stamp.x);
+    int16_t end = min(cardWidth, (int16_t)(stamp.x + stamp.w));
+    if (start >= end) return;
+
+    if (!stamp.bits) {
+        fillSpan565(line + start, stamp.color, end - start);
+        return;
+    }
+
+    // Nearest neighbour, sampling at pixel centres in 16.16 fixed point
+    int32_t sy = (2 * dy + 1) * stamp.srcHeight / (2 * stamp.h);
+    if (stamp.rotated) sy = stamp.srcHeight - 1 - sy;
+    const uint8_t* src = stamp.bits + sy * stamp.srcStride;
+
+    uint32_t step = ((uint32_t)stamp.srcWidth << 16) / stamp.w;
+    uint32_t sx = step / 2 + step * (start - stamp.x);
+    for (int16_t x = start; x < end; x++, sx += step) {
+        int16_t px = sx >> 16;
+        if (stamp.rotated) px = stamp.srcWidth - 1 - px;
+        if (src[px >> 3] & (0x80 >> (px & 7))) line[x] = stamp.color;
+    }
+}
+
+void renderCardFaceRow(const CardFace& face, int16_t y, uint16_t* line) {
+    const int16_t w = face.width;
+    int16_t edge = min(y, (int16_t)(face.height - 1 - y));
+
+    // Paper inside a one pixel border, with the corners rounded off. The border
+    // runs from this row's inset to the next row out's, so the arc stays joined.
+    int16_t inset = cornerInset(face.radius, edge);
+    if (edge == 0) {
+        fillSpan565(line, face.background, w);
+        fillSpan565(line + inset, face.border, w - 2 * inset);
+    } else {
+        int16_t outer = max((int16_t)(inset + 1), cornerInset(face.radius, edge - 1));
+        outer = min(outer, (int16_t)(w / 2));
+        fillSpan565(line, face.background, inset);
+        fillSpan565(line + inset, face.border, outer - inset);
+        fillSpan565(line + outer, face.paper, w - 2 * outer);
+        fillSpan565(line + w - outer, face.border, outer - inset);
+        fillSpan565(line + w - inset, face.background, inset);
+    }
+
+    for (int i = 0; i < face.stampCount; i++) {
+        renderStampRow(face.stamps[i], w, y, line);
+    }
+}
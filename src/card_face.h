@@ -0,0 +1,52 @@
+#ifndef CARD_FACE_H
+#define CARD_FACE_H
+
+#include "globals.h"
+#include "rle_font.h"
+
+// Full playing card faces: a rank and suit index in two corners, the pips for
+// A-10 and a framed rank for J, Q and K. Everything is scaled at layout time
+// from the 1bpp suit bitmaps and the RLE rank font, and the card is rasterised
+// one row at a time so it can go to the panel in bands.
+
+// Something drawn on the card: a scaled 1bpp mask, or a solid block when bits
+// is nullptr
+struct CardStamp {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  const uint8_t* bits;
+  int16_t srcWidth;
+  int16_t srcHeight;
+  int16_t srcStride;
+  bool rotated;   // turned 180 degrees, as on the lower half of a card
+  uint16_t color; // byte-swapped RGB565
+};
+
+const int MAX_CARD_STAMPS = 24;
+const int MAX_CARD_GLYPHS = 2;          // "10" is the longest rank
+const int CARD_GLYPH_MASK_BYTES = 8 * 66; // largest rank glyph, 1bpp
+
+struct CardFace {
+  int16_t width;
+  int16_t height;
+  int16_t radius;
+  // Byte-swapped RGB565
+  uint16_t paper;
+  uint16_t border;
+  uint16_t background; // outside the rounded corners
+  CardStamp stamps[MAX_CARD_STAMPS];
+  int stampCount;
+  uint8_t glyphMasks[MAX_CARD_GLYPHS][CARD_GLYPH_MASK_BYTES]; // decoded rank glyphs
+};
+
+// Lays out rank (A, 2-10, J, Q or K) of suit (S, H, C or D) on the largest card
+// that fits maxWidth x maxHeight. Returns false for an unknown rank or suit.
+bool layoutCardFace(CardFace& face, const char* rank, char suit, int16_t maxWidth, int16_t maxHeight,
+                    const RleFont& rankFont);
+
+// Writes row y of the card (0 at the top), face.width pixels, into line
+void renderCardFaceRow(const CardFace& face, int16_t y, uint16_t* line);
+
+#endif // CARD_FACE_H
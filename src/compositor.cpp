@@ -0,0 +1,76 @@
+#include "compositor.h"
+#include "render_profile.h"
+
+static Widget widgets[MAX_WIDGETS];
+
+// ============================================================================
+// WIDGET REGISTRATION
+// ============================================================================
+int addWidget(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t background, WidgetDrawFn draw) {
+    for (int i = 0; i < MAX_WIDGETS; i++) {
+        if (!widgets[i].active) {
+            widgets[i] = { x, y, w, h, background, draw, true, true };
+            return i;
+        }
+    }
+    Serial.println("Compositor: no free widget slots");
+    return INVALID_WIDGET;
+}
+
+void setWidgetRect(int id, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (id < 0 || id >= MAX_WIDGETS || !widgets[id].active) return;
+
+    // Clear whatever the widget covered before it moved
+    Widget& widget = widgets[id];
+    if (widget.x != x || widget.y != y || widget.w != w || widget.h != h) {
+        invalidateRect(widget.x, widget.y, widget.w, widget.h);
+        tft.fillRect(widget.x, widget.y, widget.w, widget.h, widget.background);
+        widget.x = x;
+        widget.y = y;
+        widget.w = w;
+        widget.h = h;
+        widget.dirty = true;
+    }
+}
+
+// ============================================================================
+// INVALIDATION
+// ============================================================================
+void invalidateWidget(int id) {
+    if (id < 0 || id >= MAX_WIDGETS || !widgets[id].active) return;
+    widgets[id].dirty = true;
+}
+
+void invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int i = 0; i < MAX_WIDGETS; i++) {
+        Widget& widget = widgets[i];
+        if (!widget.active) continue;
+        bool overlaps = x < widget.x + widget.w && widget.x < x + w &&
+                        y < widget.y + widget.h && widget.y < y + h;
+        if (overlaps) widget.dirty = true;
+    }
+}
+
+// ============================================================================
+// COMPOSITING
+// ============================================================================
+void compositeDirtyWidgets() {
+    uint32_t stageStart = beginStage();
+    int repainted = 0;
+
+    for (int i = 0; i < MAX_WIDGETS; i++) {
+        Widget& widget = widgets[i];
+        if (!widget.active || !widget.dirty) continue;
+
+        // Clear the flag first so a draw function can re-dirty its own widget
+        widget.dirty = false;
+        tft.fillRect(widget.x, widget.y, widget.w, widget.h, widget.background);
+        if (widget.draw) widget.draw();
+        repainted++;
+    }
+
+    // The only widgets are the header's
+    if (repainted > 0) {
+        endStage(STAGE_HEADER, stageStart);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include "globals.h"
+
+// A widget owns a rectangle of the screen and a function that draws it there.
+// Widgets are only repainted after they (or a rectangle overlapping them) have
+// been marked dirty, so a change to one widget never touches its neighbours.
+typedef void (*WidgetDrawFn)();
+
+struct Widget {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+  uint16_t background;
+  WidgetDrawFn draw;
+  bool dirty;
+  bool active;
+};
+
+const int MAX_WIDGETS = 16;
+const int INVALID_WIDGET = -1;
+
+// Registration
+int addWidget(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t background, WidgetDrawFn draw);
+void setWidgetRect(int id, int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Invalidation
+void invalidateWidget(int id);
+void invalidateRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+// Repaints every dirty widget (clear to its background, then draw)
+void compositeDirtyWidgets();
+
+#endif // COMPOSITOR_H
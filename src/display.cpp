@@ -1,57 +1,231 @@
 #include "display.h"
+#include "display_dma.h"
+#include "compositor.h"
+#include "pixel_kernels.h"
+#include "smooth_font.h"
+#include "font_ladder.h"
+#include "card_face.h"
+#include "span_text.h"
+#include "render_profile.h"
+#include "backlight.h"
 #include "settings.h"
-#include "DejaVuSans_Bold28pt7b.h"
-#include "DejaVuSans_Bold36pt7b.h"
+#include "DejaVuSans_Bold36ptRanks.h"
 #include <vector>
+#include <climits>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 static bool showingBrightness = false;
+static void drawBrightnessOverlay();
 static bool brightnessChanged = false;
 static unsigned long brightnessDisplayTime = 0;
 
+// Header widgets, registered with the compositor in initializeDisplay()
+static int statusWidget = INVALID_WIDGET;
+static int titleWidget = INVALID_WIDGET;
+static int batteryWidget = INVALID_WIDGET;
+
+// Layout for the current rotation, one of the tables built at compile time
+static const ScreenLayout* layout = &SCREEN_LAYOUTS[DEFAULT_ROTATION];
+static uint8_t appliedRotation = DEFAULT_ROTATION;
+
+// Line buffers for expanding low colour depth pixels to RGB565 on the way to the
+// panel. Rows are expanded into one while the other is still being sent.
+static uint16_t lineBuffers[2][LINE_BUFFER_PIXELS] __attribute__((aligned(4)));
+
+// Card suits, expanded to byte-swapped RGB565 in their colours once at boot so
+// a card shows its suit with a single push. 25 KB for all four. They replace
+// streaming each suit through the line buffers on every draw; the suits were
+// the only 1bpp assets, so that blitter went with it.
+struct SuitSprite {
+  char code;
+  const unsigned char* bits;
+  uint16_t color;
+};
+static const SuitSprite SUIT_SPRITES[] = {
+    { 'S', spade_bits, TFT_WHITE },
+    { 'H', heart_bits, TFT_RED },
+    { 'C', club_bits, TFT_WHITE },
+    { 'D', diamond_bits, TFT_RED }
+};
+const int NUM_SUIT_SPRITES = sizeof(SUIT_SPRITES) / sizeof(SUIT_SPRITES[0]);
+const int SUIT_SIZE = heart_width;
+static_assert(heart_width == SUIT_SIZE && heart_height == SUIT_SIZE &&
+              diamond_width == SUIT_SIZE && diamond_height == SUIT_SIZE &&
+              club_width == SUIT_SIZE && club_height == SUIT_SIZE &&
+              spade_width == SUIT_SIZE && spade_height == SUIT_SIZE,
+              "Suit sprites share one size");
+static uint16_t suitPixels[NUM_SUIT_SPRITES][SUIT_SIZE * SUIT_SIZE] __attribute__((aligned(4)));
+static bool suitSpritesReady = false;
+
+// Palette for the 4bpp page canvas. Page drawing uses these indices as colours.
+enum PageInk {
+    INK_BLACK,
+    INK_WHITE,
+    INK_GREEN,
+    INK_CYAN,
+    INK_GREY,
+    INK_YELLOW,
+    INK_RED
+};
+static const uint16_t pagePalette[] = {
+    TFT_BLACK, TFT_WHITE, TFT_GREEN, TFT_CYAN, TFT_DARKGREY, TFT_YELLOW, TFT_RED
+};
+const int PAGE_PALETTE_SIZE = sizeof(pagePalette) / sizeof(pagePalette[0]);
+
+// Menu pages are composed off screen in a 4bpp sprite (16 KB for the whole
+// panel instead of 64 KB at 16bpp) and expanded through the palette on push
+static TFT_eSprite pageCanvas = TFT_eSprite(&tft);
+static PaletteExpandLut pageLut;
+static int32_t pageCanvasWidth = 0;
+static int32_t pageCanvasHeight = 0;
+
+// Page whose widgets are on screen. Sub-menus add the settings index, as each
+// one has its own title and options.
+enum PageLayout {
+    LAYOUT_NONE,
+    LAYOUT_MAIN_MENU,
+    LAYOUT_INFO,
+    LAYOUT_SETTINGS,
+    LAYOUT_SUB_MENU
+};
+static int pageLayout = LAYOUT_NONE;
+
+// Message text is only ever one colour, so GFX fonts are rendered at 1bpp.
+// Smooth fonts need coverage levels and use 4bpp, indexing a black to green ramp.
+static TFT_eSprite messageCanvas = TFT_eSprite(&tft);
+static MonoExpandLut messageLut;
+static PaletteExpandLut messageRampLut;
+static int32_t messageCanvasWidth = 0;
+static int32_t messageCanvasHeight = 0;
+static int8_t messageCanvasDepth = 0;
+
+// Message transitions. The frame on screen is copied out of the message canvas
+// before the next message is drawn into it, and the two are composited a band
+// at a time. Only the message window is kept, never the whole screen. Each
+// depth's table is the same for every message, so the old frame is expanded
+// through messageLut or messageRampLut as well.
+static bool messageFrameShown = false; // the window holds the canvas as last pushed
+static bool transitionPending = false; // next drawMessageContent() animates
+static int transitionDirection = 1;
+static uint8_t* transitionFrom = nullptr;
+static int32_t transitionFromBytes = 0;
+static int8_t transitionFromDepth = 0;
+static uint16_t transitionRow[TFT_WIDTH > TFT_HEIGHT ? TFT_WIDTH : TFT_HEIGHT] __attribute__((aligned(4)));
+static void runMessageTransition();
+
+// Marquee strip held in the message canvas: the line of text followed by
+// MARQUEE_GAP blank columns, which the window wraps around
+static int32_t marqueeWidth = 0;
+static int32_t marqueeHeight = 0;
+
+// Line table of the message on screen, built once when it is opened so that
+// scroll frames only draw the few lines that reach the viewport
+struct MessageLine {
+  uint16_t start;
+  uint16_t length;
+};
+static String messageText;
+static std::vector<MessageLine> messageLines;
+
 // ============================================================================
 // DISPLAY INITIALIZATION
 // ============================================================================
 void initializeDisplay() {
+    initBacklight(); // off until the first page is up
     tft.init();
-    tft.setRotation(1);
+    appliedRotation = screenRotation & 3;
+    layout = &SCREEN_LAYOUTS[appliedRotation];
+    tft.setRotation(appliedRotation);
     tft.fillScreen(TFT_BLACK);
+    pageLayout = LAYOUT_NONE;
+    initDisplayDMA();
+    initSmoothFonts();
+    initFontLadder();
+    buildSuitSprites();
+    setupHeaderWidgets();
+
+    // Fade up to the brightness loaded from EEPROM while the first page is drawn
+    fadeBacklight(brightness, BACKLIGHT_WAKE_FADE_TIME);
+}
 
-    // Apply brightness immediately (brightness is loaded from EEPROM in main setup)
-    int pwmValue = map(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS, 25, 255);
-    analogWrite(4, pwmValue);
+// The panel is only told about a rotation when the setting changes. Everything
+// on screen is then laid out again from that rotation's table.
+void applyScreenRotation() {
+    uint8_t rotation = screenRotation & 3;
+    if (rotation == appliedRotation) return;
+
+    appliedRotation = rotation;
+    layout = &SCREEN_LAYOUTS[rotation];
+    tft.setRotation(rotation);
+    tft.fillScreen(TFT_BLACK);
+    pageLayout = LAYOUT_NONE;
+    setupHeaderWidgets();
+    updateHeader();
 }
 
 // ============================================================================
 // HEADER & STATUS DRAWING FUNCTIONS
 // ============================================================================
 
+static void drawScreenTitle() {
+    // Screen name, centred in its widget in the largest bold font it fits in.
+    // A name too long for even the small one loses letters from its end.
+    int left = HEADER_STATUS_WIDTH;
+    int maxWidth = layout->headerTitleWidth - 4;
+    String title = currentScreenName;
+    tft.setTextColor(TFT_WHITE, TFT_BLACK);
+    tft.setFreeFont(FONT_SANS_BOLD_12);
+    if (tft.textWidth(title.c_str()) > maxWidth) {
+        tft.setFreeFont(FONT_SANS_BOLD_9);
+        while (title.length() > 1 && tft.textWidth((title + ".").c_str()) > maxWidth) {
+            title = title.substring(0, title.length() - 1);
+        }
+        if (title != currentScreenName) title += ".";
+    }
+    int textWidth = tft.textWidth(title.c_str());
+    tft.setCursor(left + (layout->headerTitleWidth - textWidth) / 2, 18); // Vertically centered in header
+    tft.print(title);
+}
+
+void setupHeaderWidgets() {
+    // Each header element gets its own rectangle so a change to one of them
+    // only repaints that rectangle. The widths come from the layout table.
+    int statusRight = HEADER_STATUS_WIDTH;
+    int titleWidth = layout->headerTitleWidth;
+    int batteryX = statusRight + titleWidth;
+    int batteryWidth = layout->headerBatteryWidth;
+
+    if (statusWidget == INVALID_WIDGET) {
+        statusWidget = addWidget(0, 0, statusRight, HEADER_HEIGHT, TFT_BLACK, drawConnectionStatus);
+        titleWidget = addWidget(statusRight, 0, titleWidth, HEADER_HEIGHT, TFT_BLACK, drawScreenTitle);
+        batteryWidget = addWidget(batteryX, 0, batteryWidth, HEADER_HEIGHT, TFT_BLACK, drawBatteryStatus);
+    } else {
+        setWidgetRect(statusWidget, 0, 0, statusRight, HEADER_HEIGHT);
+        setWidgetRect(titleWidget, statusRight, 0, titleWidth, HEADER_HEIGHT);
+        setWidgetRect(batteryWidget, batteryX, 0, batteryWidth, HEADER_HEIGHT);
+    }
+}
+
+void invalidateHeader(uint8_t parts) {
+    if (parts & HEADER_STATUS) invalidateWidget(statusWidget);
+    if (parts & HEADER_TITLE) invalidateWidget(titleWidget);
+    if (parts & HEADER_BATTERY) invalidateWidget(batteryWidget);
+}
+
 void setScreenName(String name) {
     if (currentScreenName != name) {
         currentScreenName = name;
-        updateHeader();
+        invalidateHeader(HEADER_TITLE);
+        compositeDirtyWidgets();
     }
 }
 
 void updateHeader() {
-    tft.setRotation(1);
-
-    // Clear header area
+    // Full header redraw. Single changes should use invalidateHeader() instead.
     tft.fillRect(0, 0, tft.width(), HEADER_HEIGHT, TFT_BLACK);
-
-
-    // Draw connection status (left)
-    drawConnectionStatus();
-
-    // Draw screen name (center) - use bold font for all headers
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_BOLD_12);
-    int textWidth = tft.textWidth(currentScreenName.c_str());
-    int centerX = (tft.width() - textWidth) / 2;
-    tft.setCursor(centerX, 18); // Vertically centered in header
-    tft.print(currentScreenName);
-
-    // Draw battery status (right)
-    drawBatteryStatus();
+    invalidateHeader(HEADER_ALL);
+    compositeDirtyWidgets();
 
     // Draw separator line below header
     tft.drawLine(0, HEADER_HEIGHT, tft.width(), HEADER_HEIGHT, TFT_DARKGREY);
@@ -74,6 +248,7 @@ void drawBatteryStatus() {
     int batteryHeight = 10;
     int batteryX = tft.width() - batteryWidth - 5; // As far right as possible
     int batteryY = (HEADER_HEIGHT - batteryHeight) / 2; // Center vertically in header
+    bool roomForText = layout->headerBatteryWidth >= HEADER_BATTERY_TEXT_WIDTH;
 
     // Draw battery outline
     tft.drawRect(batteryX, batteryY, batteryWidth, batteryHeight, TFT_WHITE);
@@ -93,6 +268,7 @@ void drawBatteryStatus() {
         if (fillWidth > 0) {
             tft.fillRect(batteryX + 1, batteryY + 1, fillWidth, batteryHeight - 2, fillColor);
         }
+        if (!roomForText) return;
 
         // Show percentage using built-in font (much smaller)
         tft.setTextColor(TFT_WHITE, TFT_BLACK);
@@ -124,147 +300,520 @@ void drawBatteryStatus() {
         int fontHeight = 8; // Built-in font 1 size 1 is 8 pixels tall
         int textY = (HEADER_HEIGHT - fontHeight) / 2 + 1; // +1 to account for baseline
 
+        // Inside the empty battery when there is no room beside it
+        if (!roomForText) {
+            textX = batteryX + (batteryWidth - textWidth) / 2;
+            textY = batteryY + 1;
+        }
+
         tft.setCursor(textX, textY);
         tft.print(noBatteryText);
     }
 }
 
 void clearContentArea() {
-    // Clear only the content area below the header
+    // Clear only the content area below the header. Whatever page was there
+    // has to be drawn in full next time.
+    pageLayout = LAYOUT_NONE;
     tft.fillRect(0, HEADER_HEIGHT + 1, tft.width(), tft.height() - HEADER_HEIGHT - 1, TFT_BLACK);
 }
 
 // ============================================================================
-// PAGE DRAWING FUNCTIONS
+// PAGE CANVAS
 // ============================================================================
 
-void drawMainMenu() {
-    clearContentArea();
-    setScreenName("Main"); // This will call updateHeader
+// Clears the content area of the page canvas, allocating it on first use
+static bool beginPageCanvas() {
+    if (pageCanvasWidth != tft.width() || pageCanvasHeight != tft.height()) {
+        pageCanvas.deleteSprite();
+        pageCanvas.setColorDepth(4);
+        // Even width keeps every row starting on a byte boundary
+        if (!pageCanvas.createSprite((tft.width() + 1) & ~1, tft.height())) {
+            Serial.println("Failed to allocate memory for page canvas");
+            pageCanvasWidth = 0;
+            pageCanvasHeight = 0;
+            return false;
+        }
+        pageCanvas.createPalette(pagePalette, PAGE_PALETTE_SIZE);
 
-    // Draw "BLE Ready!" as a sub-header
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_BOLD_12);
-    tft.setCursor(5, HEADER_HEIGHT + 25);
-    tft.print("BLE Ready!");
+        // Swapped once here so expanded rows can go straight to the panel
+        uint16_t swappedPalette[PAGE_PALETTE_SIZE];
+        swapBytes565(swappedPalette, pagePalette, PAGE_PALETTE_SIZE);
+        buildPaletteExpandLut(pageLut, swappedPalette, PAGE_PALETTE_SIZE);
 
-    // Draw navigation hints
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    String selHint = "Sel->";
-    String nxtHint = "Nxt->";
-    int selWidth = tft.textWidth(selHint.c_str());
-    int nxtWidth = tft.textWidth(nxtHint.c_str());
-
-    // Button 2 is select (top right)
-    tft.setCursor(tft.width() - selWidth - 5, HEADER_HEIGHT + 25);
-    tft.print(selHint);
-    // Button 1 is next (bottom right)
-    tft.setCursor(tft.width() - nxtWidth - 5, tft.height() - 10);
-    tft.print(nxtHint);
-
-    // Draw menu items
-    int startY = HEADER_HEIGHT + 50; // Move menu items down
-    int lineHeight = 22;
-
-    for (int i = 0; i < NUM_MAIN_MENU_ITEMS; i++) {
-        int y = startY + (i * lineHeight);
-        tft.setFreeFont(FONT_SANS_12);
-
-        if (i == mainMenuSelection) {
-            // Highlighted item is green
-            tft.setTextColor(TFT_GREEN, TFT_BLACK);
-        } else {
-            // Non-highlighted items are white
-            tft.setTextColor(TFT_WHITE, TFT_BLACK);
+        pageCanvasWidth = tft.width();
+        pageCanvasHeight = tft.height();
+    }
+
+    pageCanvas.fillRect(0, HEADER_HEIGHT + 1, pageCanvasWidth, pageCanvasHeight - HEADER_HEIGHT - 1, INK_BLACK);
+    return true;
+}
+
+// Expands the content area of the page canvas through the palette and pushes it
+static void pushPageCanvas() {
+    const uint8_t* pixels = (const uint8_t*)pageCanvas.getPointer();
+    const int32_t stride = ((pageCanvasWidth + 1) & ~1) / 2;
+    const int32_t rowsPerChunk = LINE_BUFFER_PIXELS / pageCanvasWidth;
+
+    beginBandPush();
+    for (int32_t row = HEADER_HEIGHT + 1, chunk = 0; row < pageCanvasHeight; row += rowsPerChunk, chunk++) {
+        int32_t rows = min(rowsPerChunk, pageCanvasHeight - row);
+        uint16_t* buffer = lineBuffers[chunk & 1];
+        for (int32_t j = 0; j < rows; j++) {
+            expandPaletteRow(buffer + j * pageCanvasWidth, pixels + (row + j) * stride, pageCanvasWidth, pageLut);
         }
-        tft.setCursor(10, y);
-        tft.print(mainMenuItems[i]);
+        pushBand(0, row, pageCanvasWidth, rows, buffer);
     }
+    endBandPush();
 }
 
-void drawInfoPage() {
-    clearContentArea();
-    setScreenName("Info");
+// ============================================================================
+// PAGE WIDGETS
+// ============================================================================
 
-    // Navigation hints
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    String exitHint = "Exit->";
-    String nxtHint = "Nxt->"; // Per request, both buttons will exit
-    int exitWidth = tft.textWidth(exitHint.c_str());
-    int nxtWidth = tft.textWidth(nxtHint.c_str());
+// Menu pages are retained: a page adds its widgets once when it is opened and
+// after that a keypress only changes their state. Widgets whose state changed
+// are redrawn into the page canvas and just their rectangles are pushed.
+enum PageWidgetType : uint8_t {
+    PAGE_LABEL,
+    PAGE_HINT,  // a label in a right-hand corner, next to its button
+    PAGE_LIST
+};
+
+struct PageWidget {
+  uint8_t type;
+  int16_t x, y, w, h;        // screen rectangle the widget covers
+  const GFXfont* font;
+  uint8_t ink;
+  int16_t textX, baseline;   // where the text (or the first list row) starts
+  const char* text;          // label text
+  const char* const* items;  // list items
+  int8_t count;
+  int8_t visible;            // rows shown at once
+  int8_t selected;
+  int8_t scroll;             // first row shown
+  int8_t disabled;           // item drawn grey, -1 for none
+  int8_t child;              // item drawn with a "- " prefix, -1 for none
+  int16_t lineHeight;
+  int8_t above, below;       // font extent around each baseline
+  uint32_t dirtyRows;        // list rows to repaint when the rest is unchanged
+  bool dirty;
+};
+
+const int MAX_PAGE_WIDGETS = 12;
+
+// Menu names for the latency report, by layout (all sub-menus share one)
+static const char* const PAGE_MENU_NAMES[] = { "", "Main", "Info", "Settings", "Sub-menu" };
+const int NUM_PAGE_MENUS = sizeof(PAGE_MENU_NAMES) / sizeof(PAGE_MENU_NAMES[0]);
+
+// Time of the keypress being handled, 0 outside of one, and the keypress to
+// pixel latency of each menu
+static unsigned long keypressMicros = 0;
+#if RENDER_TIMING_LOG
+static uint32_t menuKeypresses[NUM_PAGE_MENUS];
+static unsigned long menuLatencyTotal[NUM_PAGE_MENUS];
+static unsigned long menuLatencyMax[NUM_PAGE_MENUS];
+#endif
+
+static PageWidget pageWidgets[MAX_PAGE_WIDGETS];
+static int pageWidgetCount = 0;
+
+// Lines of text broken up to fit the screen, kept for the page's labels
+static char pageText[192];
+static int pageTextUsed = 0;
+
+// Rows above and below the baseline that any character of a GFX font reaches
+static void gfxFontExtent(const GFXfont* font, int16_t& above, int16_t& below) {
+    above = 0;
+    below = 0;
+    for (int c = font->first; c <= font->last; c++) {
+        const GFXglyph& glyph = font->glyph[c - font->first];
+        if (glyph.height == 0) continue;
+        above = max(above, (int16_t)-glyph.yOffset);
+        below = max(below, (int16_t)(glyph.height + glyph.yOffset));
+    }
+}
 
-    tft.setCursor(tft.width() - exitWidth - 5, HEADER_HEIGHT + 25);
-    tft.print(exitHint);
-    tft.setCursor(tft.width() - nxtWidth - 5, tft.height() - 10);
-    tft.print(nxtHint);
+// Starts building the widgets for a layout. Returns false if the layout is
+// already on screen, in which case its widgets are kept.
+static bool beginPage(int newLayout) {
+    if (pageLayout == newLayout) return false;
+    pageLayout = newLayout;
+    pageWidgetCount = 0;
+    pageTextUsed = 0;
+    return true;
+}
 
-    // Info content
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    int startY = CONTENT_START_Y + 20;
-    int lineHeight = 18;
-    tft.setCursor(10, startY);
-    tft.println("For use with Toxic+");
-    tft.setCursor(10, startY + lineHeight);
-    tft.println("By Ian Pidgeon");
-    tft.setCursor(10, startY + 2 * lineHeight);
-    tft.println("Created by Rob Testa");
-    tft.setCursor(10, startY + 3 * lineHeight);
-    tft.println("November 2025");
-}
-
-void pushSpriteMirrored(TFT_eSprite* sprite, int32_t x, int32_t y) {
-    static uint16_t* mirroredBuffer = nullptr;
-    static int32_t bufferWidth = 0;
-    static int32_t bufferHeight = 0;
-
-    uint16_t* originalBuffer = (uint16_t*)sprite->getPointer();
-    int32_t w = sprite->width();
-    int32_t h = sprite->height();
-
-    // Check if buffer needs to be (re)allocated. This is to prevent memory
-    // allocation on every frame of the scrolling animation.
-    if (mirroredBuffer == nullptr || bufferWidth != w || bufferHeight != h) {
-        if (mirroredBuffer) free(mirroredBuffer);
-        mirroredBuffer = (uint16_t*)malloc(w * h * sizeof(uint16_t));
-        if (!mirroredBuffer) {
-            Serial.println("Failed to allocate memory for mirrored buffer");
-            bufferWidth = 0;
-            bufferHeight = 0;
-            return;
+static int addPageWidget(const PageWidget& widget) {
+    if (pageWidgetCount >= MAX_PAGE_WIDGETS) {
+        Serial.println("Page: no free widget slots");
+        return INVALID_WIDGET;
+    }
+    pageWidgets[pageWidgetCount] = widget;
+    return pageWidgetCount++;
+}
+
+static int addPageLabel(int16_t x, int16_t baseline, const GFXfont* font, uint8_t ink, const char* text) {
+    int16_t above, below;
+    gfxFontExtent(font, above, below);
+    pageCanvas.setFreeFont(font);
+    int16_t width = pageCanvas.textWidth(text);
+
+    PageWidget widget = {};
+    widget.type = PAGE_LABEL;
+    widget.x = max(0, x - 2);
+    widget.y = baseline - above;
+    widget.w = width + 4;
+    widget.h = above + below;
+    widget.font = font;
+    widget.ink = ink;
+    widget.textX = x;
+    widget.baseline = baseline;
+    widget.text = text;
+    return addPageWidget(widget);
+}
+
+// The font to draw text in on the page: font if it fits maxWidth, else smaller
+static const GFXfont* fittingFont(const char* text, const GFXfont* font, const GFXfont* smaller, int16_t maxWidth) {
+    pageCanvas.setFreeFont(font);
+    return pageCanvas.textWidth(text) <= maxWidth ? font : smaller;
+}
+
+// Adds text as one label per line, broken between words to fit maxWidth (a
+// word wider than that gets a line to itself). Returns the number of lines.
+static int addPageText(int16_t x, int16_t baseline, const GFXfont* font, uint8_t ink, const char* text,
+                       int16_t maxWidth, int16_t lineHeight) {
+    pageCanvas.setFreeFont(font);
+    int lines = 0;
+    const char* start = text;
+    while (*start) {
+        // Take words while the line still fits
+        char* line = pageText + pageTextUsed;
+        int room = (int)sizeof(pageText) - pageTextUsed;
+        int length = 0;
+        const char* next = start;
+        while (*next) {
+            const char* wordEnd = next;
+            while (*wordEnd && *wordEnd != ' ') wordEnd++;
+            int fitted = (int)(wordEnd - start);
+            if (fitted >= room) break;
+            memcpy(line, start, fitted);
+            line[fitted] = '\0';
+            if (length > 0 && pageCanvas.textWidth(line) > maxWidth) break;
+            length = fitted;
+            next = wordEnd;
+            while (*next == ' ') next++;
+        }
+        if (length == 0) {
+            Serial.println("Page: no room for text");
+            break;
+        }
+        line[length] = '\0';
+        pageTextUsed += length + 1;
+        addPageLabel(x, baseline + lines * lineHeight, font, ink, line);
+        lines++;
+        start = next;
+    }
+    return lines;
+}
+
+// Button hint: top right for button 2 (bottom left in portrait), bottom right
+// for button 1
+static int addPageHint(bool top, const char* text) {
+    pageCanvas.setFreeFont(FONT_SANS_9);
+    int16_t x = layout->width - pageCanvas.textWidth(text) - layout->margin;
+    if (top && layout->hintTopLeft) x = layout->margin;
+    int16_t baseline = top ? layout->hintTopBaseline : layout->hintBottomBaseline;
+    int id = addPageLabel(x, baseline, FONT_SANS_9, INK_CYAN, text);
+    if (id != INVALID_WIDGET) pageWidgets[id].type = PAGE_HINT;
+    return id;
+}
+
+static int addPageList(int16_t x, int16_t baseline, const GFXfont* font, int16_t lineHeight,
+                       const char* const* items, int count, int visible) {
+    int16_t above, below;
+    gfxFontExtent(font, above, below);
+    pageCanvas.setFreeFont(font);
+    int16_t width = pageCanvas.textWidth("- "); // room for a child item
+    for (int i = 0; i < count; i++) {
+        width = max(width, (int16_t)(pageCanvas.textWidth("- ") + pageCanvas.textWidth(items[i])));
+    }
+    visible = min(visible, count);
+
+    PageWidget widget = {};
+    widget.type = PAGE_LIST;
+    widget.x = max(0, x - 2);
+    widget.y = baseline - above;
+    widget.w = width + 4;
+    widget.h = (visible - 1) * lineHeight + above + below;
+    widget.font = font;
+    widget.above = above;
+    widget.below = below;
+    widget.textX = x;
+    widget.baseline = baseline;
+    widget.items = items;
+    widget.count = count;
+    widget.visible = visible;
+    widget.disabled = -1;
+    widget.child = -1;
+    widget.lineHeight = lineHeight;
+    return addPageWidget(widget);
+}
+
+// 3-phase list scrolling: the highlight moves down from the top, then stays
+// pinned to the middle row while the list scrolls, then moves down to the end.
+// Lists that fit do not scroll.
+static int listScrollOffset(int selected, int count, int visible) {
+    if (count <= visible) return 0;
+    int pinRow = visible / 2;
+    if (selected < pinRow) return 0;                               // Phase 1
+    if (selected >= count - (visible - pinRow)) return count - visible; // Phase 3
+    return selected - pinRow;                                      // Phase 2
+}
+
+static void markListRowDirty(PageWidget& widget, int item) {
+    int row = item - widget.scroll;
+    if (row >= 0 && row < widget.visible) widget.dirtyRows |= 1u << row;
+}
+
+static void setPageList(int id, int selected, int scroll, int disabled = -1, int child = -1) {
+    if (id < 0 || id >= pageWidgetCount) return;
+    PageWidget& widget = pageWidgets[id];
+    if (widget.selected == selected && widget.scroll == scroll &&
+        widget.disabled == disabled && widget.child == child) return;
+
+    if (widget.scroll == scroll && widget.disabled == disabled && widget.child == child) {
+        // Only the highlight moved: the rows it left and landed on
+        markListRowDirty(widget, widget.selected);
+        markListRowDirty(widget, selected);
+    } else {
+        widget.dirty = true;
+    }
+    widget.selected = selected;
+    widget.scroll = scroll;
+    widget.disabled = disabled;
+    widget.child = child;
+}
+
+static void renderPageWidget(const PageWidget& widget) {
+    pageCanvas.setFreeFont(widget.font);
+    if (widget.type != PAGE_LIST) {
+        pageCanvas.setTextColor(widget.ink, INK_BLACK);
+        pageCanvas.setCursor(widget.textX, widget.baseline);
+        pageCanvas.print(widget.text);
+        return;
+    }
+
+    int end = min((int)widget.count, widget.scroll + widget.visible);
+    for (int i = widget.scroll; i < end; i++) {
+        uint8_t ink = INK_WHITE;
+        if (i == widget.disabled) {
+            ink = INK_GREY;
+        } else if (i == widget.selected) {
+            ink = INK_GREEN;
         }
-        bufferWidth = w;
-        bufferHeight = h;
+        pageCanvas.setTextColor(ink, INK_BLACK);
+        pageCanvas.setCursor(widget.textX, widget.baseline + (i - widget.scroll) * widget.lineHeight);
+        if (i == widget.child) pageCanvas.print("- ");
+        pageCanvas.print(widget.items[i]);
+    }
+}
+
+// Redraws everything the rectangle touches and pushes just that rectangle.
+// Returns the number of bytes sent to the panel.
+static int32_t repaintPageRect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    // Whole source bytes at 4bpp, and nothing over the header
+    int32_t left = max((int32_t)0, x) & ~1;
+    int32_t right = min(pageCanvasWidth, (x + w + 1) & ~1);
+    int32_t top = max(y, (int32_t)HEADER_HEIGHT + 1);
+    int32_t bottom = min(pageCanvasHeight, y + h);
+    if (left >= right || top >= bottom) return 0;
+    w = right - left;
+    h = bottom - top;
+
+    pageCanvas.fillRect(left, top, w, h, INK_BLACK);
+    for (int i = 0; i < pageWidgetCount; i++) {
+        const PageWidget& widget = pageWidgets[i];
+        bool overlaps = left < widget.x + widget.w && widget.x < right &&
+                        top < widget.y + widget.h && widget.y < bottom;
+        if (overlaps) renderPageWidget(widget);
     }
 
-    // Copy and mirror pixels from the original buffer to the static mirrored buffer.
-    // The byte-swap operation that was here previously was causing the color to change
-    // from green to red, and was unnecessary.
-    for (int32_t j = 0; j < h; j++) {
-        for (int32_t i = 0; i < w; i++) {
-            // Get color from original and place it in the mirrored position
-            mirroredBuffer[(w - 1 - i) + j * w] = originalBuffer[i + j * w];
+    const uint8_t* pixels = (const uint8_t*)pageCanvas.getPointer();
+    const int32_t stride = ((pageCanvasWidth + 1) & ~1) / 2;
+    const int32_t rowsPerChunk = LINE_BUFFER_PIXELS / w;
+
+    beginBandPush();
+    for (int32_t row = top, chunk = 0; row < bottom; row += rowsPerChunk, chunk++) {
+        int32_t rows = min(rowsPerChunk, bottom - row);
+        uint16_t* buffer = lineBuffers[chunk & 1];
+        for (int32_t j = 0; j < rows; j++) {
+            expandPaletteRow(buffer + j * w, pixels + (row + j) * stride + left / 2, w, pageLut);
+        }
+        pushBand(left, row, w, rows, buffer);
+    }
+    endBandPush();
+    return w * h * 2;
+}
+
+// Draws the page: everything if it was just built, otherwise only the widgets
+// that changed
+static void flushPage(bool rebuilt) {
+#if RENDER_TIMING_LOG
+    unsigned long start = micros();
+#endif
+    uint32_t stageStart = beginStage();
+    int32_t fullBytes = layout->width * (layout->height - HEADER_HEIGHT - 1) * 2;
+    int32_t bytes = 0;
+    int repainted = 0;
+
+    if (rebuilt) {
+        if (!beginPageCanvas()) {
+            pageLayout = LAYOUT_NONE;
+            return;
+        }
+        for (int i = 0; i < pageWidgetCount; i++) {
+            renderPageWidget(pageWidgets[i]);
+            pageWidgets[i].dirty = false;
+            pageWidgets[i].dirtyRows = 0;
+        }
+        pushPageCanvas();
+        bytes = fullBytes;
+        repainted = pageWidgetCount;
+    } else {
+        for (int i = 0; i < pageWidgetCount; i++) {
+            PageWidget& widget = pageWidgets[i];
+            if (widget.dirty) {
+                bytes += repaintPageRect(widget.x, widget.y, widget.w, widget.h);
+                repainted++;
+            } else if (widget.dirtyRows) {
+                for (int row = 0; row < widget.visible; row++) {
+                    if (!(widget.dirtyRows & (1u << row))) continue;
+                    int16_t baseline = widget.baseline + row * widget.lineHeight;
+                    bytes += repaintPageRect(widget.x, baseline - widget.above, widget.w, widget.above + widget.below);
+                }
+                repainted++;
+            }
+            widget.dirty = false;
+            widget.dirtyRows = 0;
         }
     }
+    if (repainted == 0) return;
+    endStage(STAGE_MENU_PAGE, stageStart);
+
+    // The overlay is drawn straight to the panel, so put it back on top
+    if (showingBrightness) {
+        drawBrightnessOverlay();
+    }
 
-    // Push the entire mirrored buffer to the screen at once
-    tft.pushImage(x, y, w, h, mirroredBuffer);
+#if RENDER_TIMING_LOG
+    int menu = min(pageLayout, NUM_PAGE_MENUS - 1);
+    Serial.print("Page update (");
+    Serial.print(PAGE_MENU_NAMES[menu]);
+    Serial.print("): ");
+    Serial.print(repainted);
+    Serial.print(" of ");
+    Serial.print(pageWidgetCount);
+    Serial.print(" widgets, ");
+    Serial.print(bytes);
+    Serial.print(" of ");
+    Serial.print(fullBytes);
+    Serial.print(" bytes in ");
+    Serial.print(micros() - start);
+    Serial.print(" us");
+
+    // Keypress to the last pixel pushed, for the menu the key was pressed on
+    if (keypressMicros != 0) {
+        unsigned long latency = micros() - keypressMicros;
+        keypressMicros = 0;
+        menuKeypresses[menu]++;
+        menuLatencyTotal[menu] += latency;
+        if (latency > menuLatencyMax[menu]) menuLatencyMax[menu] = latency;
+
+        Serial.print(", ");
+        Serial.print(latency);
+        Serial.print(" us from keypress (avg ");
+        Serial.print(menuLatencyTotal[menu] / menuKeypresses[menu]);
+        Serial.print(", max ");
+        Serial.print(menuLatencyMax[menu]);
+        Serial.print(" over ");
+        Serial.print(menuKeypresses[menu]);
+        Serial.print(")");
+    }
+    Serial.println();
+#else
+    (void)bytes;
+    keypressMicros = 0;
+#endif
 }
 
+void beginKeypress(unsigned long pressedMicros) {
+    keypressMicros = pressedMicros;
+}
 
-void displayCard(String rank, String suit) {
-    clearContentArea();
-    setScreenName("Card");
+void endKeypress() {
+    keypressMicros = 0;
+}
 
-    // Navigation hint
+// ============================================================================
+// PAGE DRAWING FUNCTIONS
+// ============================================================================
+
+void drawMainMenu() {
+    setScreenName("Main"); // This will repaint the header title
+
+    static int menuList = INVALID_WIDGET;
+    bool rebuilt = beginPage(LAYOUT_MAIN_MENU);
+    if (rebuilt) {
+        // "BLE Ready!" as a sub-header, then the hints for button 2 (select,
+        // top right) and button 1 (next, bottom right)
+        addPageLabel(layout->margin, layout->subtitleBaseline,
+                     fittingFont("BLE Ready!", FONT_SANS_BOLD_12, FONT_SANS_BOLD_9, layout->width - 2 * layout->margin),
+                     INK_WHITE, "BLE Ready!");
+        addPageHint(true, "Sel->");
+        addPageHint(false, "Nxt->");
+        menuList = addPageList(2 * layout->margin, layout->mainListBaseline, FONT_SANS_12, layout->mainLineHeight,
+                               mainMenuItems, NUM_MAIN_MENU_ITEMS, NUM_MAIN_MENU_ITEMS);
+    }
+    setPageList(menuList, mainMenuSelection, 0);
+    flushPage(rebuilt);
+}
+
+void drawInfoPage() {
+    setScreenName("Info");
+
+    bool rebuilt = beginPage(LAYOUT_INFO);
+    if (rebuilt) {
+        addPageHint(true, "Exit->");
+        addPageHint(false, "Nxt->"); // Per request, both buttons will exit
+
+        static const char* const infoLines[] = {
+            "For use with Toxic+", "By Ian Pidgeon", "Created by Rob Testa", "November 2025"
+        };
+        int x = 2 * layout->margin;
+        int y = layout->infoBaseline;
+        int lineHeight = layout->infoLineHeight;
+        for (const char* text : infoLines) {
+            y += lineHeight * addPageText(x, y, FONT_SANS_9, INK_WHITE, text, layout->width - x - layout->margin, lineHeight);
+        }
+    }
+    flushPage(rebuilt);
+}
+
+static void drawCardBackHint() {
     tft.setTextColor(TFT_CYAN, TFT_BLACK);
     tft.setFreeFont(FONT_SANS_9);
     String backHint = "Back->";
     int backWidth = tft.textWidth(backHint.c_str());
-    tft.setCursor(tft.width() - backWidth - 5, tft.height() - 10);
+    tft.setCursor(layout->width - backWidth - layout->margin, layout->hintBottomBaseline);
     tft.print(backHint);
+}
+
+void displayCard(String rank, String suit) {
+    clearContentArea();
+    setScreenName("Card");
+
+    drawCardBackHint();
 
     // Display card
     String cardText = rank + suit;
@@ -272,104 +821,495 @@ void displayCard(String rank, String suit) {
     
     // Calculate text width to center it
     int textWidth = tft.textWidth(cardText.c_str());
-    int x = (tft.width() - textWidth) / 2;
-    int y = (tft.height() - HEADER_HEIGHT) / 2 + HEADER_HEIGHT; // Center vertically in content area
+    int x = (layout->width - textWidth) / 2;
+    int y = (layout->height - HEADER_HEIGHT) / 2 + HEADER_HEIGHT; // Center vertically in content area
 
     tft.setCursor(x, y);
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
     tft.print(cardText);
 }
 
-void drawSuitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
-    const int16_t bytesPerRow = (w + 7) / 8; // Correct stride calculation
-    uint16_t *buffer = (uint16_t *)malloc(w * h * sizeof(uint16_t));
-    if (!buffer) {
-        Serial.println("Failed to allocate memory for suit bitmap buffer");
-        return;
+void drawRleText(int16_t x, int16_t y, const String& text, const RleFont& font, uint16_t color, uint16_t background) {
+    // Byte-swap the colors for pushImage to prevent red from becoming blue.
+    uint16_t swappedColor = swap565(color);
+    uint16_t swappedBackground = swap565(background);
+    RleSpan spans[MAX_RLE_SPANS];
+
+    beginBandPush();
+    int chunk = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        const RleGlyph* glyph = findRleGlyph(font, text[i]);
+        if (!glyph) continue;
+
+        // Each glyph box goes out as a few bands. Rows start as background and
+        // every decoded span is one fill, so no pixel is tested on its own.
+        int16_t w = glyph->width;
+        int16_t h = glyph->height;
+        int16_t rowsPerChunk = (w > 0) ? LINE_BUFFER_PIXELS / w : 0;
+        RleCursor cursor;
+        beginRleGlyph(cursor, font, *glyph);
+
+        for (int16_t row = 0; row < h && w > 0; row += rowsPerChunk, chunk++) {
+            int16_t rows = min((int16_t)(h - row), rowsPerChunk);
+            uint16_t* buffer = lineBuffers[chunk & 1];
+            for (int16_t j = 0; j < rows; j++) {
+                uint16_t* line = buffer + j * w;
+                fillSpan565(line, swappedBackground, w);
+                int count = decodeRleRow(cursor, spans);
+                for (int k = 0; k < count; k++) {
+                    fillSpan565(line + spans[k].x, swappedColor, spans[k].length);
+                }
+            }
+            pushBand(x + glyph->xOffset, y + glyph->yOffset + row, w, rows, buffer);
+        }
+        x += glyph->xAdvance;
     }
+    endBandPush();
+}
 
-    for (int16_t j = 0; j < h; j++) {
-        for (int16_t i = 0; i < w; i++) {
-            uint8_t byte = pgm_read_byte(&bitmap[j * bytesPerRow + i / 8]);
-            bool pixelOn = byte & (0x80 >> (i % 8));
-            if (pixelOn) {
-                // Byte-swap the color for pushImage to prevent red from becoming blue.
-                buffer[j * w + i] = (color >> 8) | (color << 8);
-            } else {
-                buffer[j * w + i] = TFT_BLACK;
-            }
+// ============================================================================
+// CARD SUIT SPRITES
+// ============================================================================
+void buildSuitSprites() {
+    if (suitSpritesReady) return;
+    unsigned long start = micros();
+
+    const int16_t bytesPerRow = (SUIT_SIZE + 7) / 8;
+    MonoExpandLut lut;
+    for (int i = 0; i < NUM_SUIT_SPRITES; i++) {
+        buildMonoExpandLut(lut, swap565(SUIT_SPRITES[i].color), swap565(TFT_BLACK));
+        for (int16_t row = 0; row < SUIT_SIZE; row++) {
+            expandMonoRow(suitPixels[i] + row * SUIT_SIZE, SUIT_SPRITES[i].bits + row * bytesPerRow, 0, SUIT_SIZE, lut);
         }
     }
+    suitSpritesReady = true;
 
-    tft.pushImage(x, y, w, h, buffer);
-    free(buffer);
+    Serial.print("Suit sprites: ");
+    Serial.print(sizeof(suitPixels));
+    Serial.print(" bytes, built in ");
+    Serial.print(micros() - start);
+    Serial.println(" us");
 }
 
+// Pushes the cached sprite for a suit code (S, H, C or D). Returns false for
+// any other code.
+bool drawSuitSprite(int16_t x, int16_t y, char suit) {
+    for (int i = 0; i < NUM_SUIT_SPRITES; i++) {
+        if (SUIT_SPRITES[i].code != suit) continue;
+
+        beginBandPush();
+        pushBand(x, y, SUIT_SIZE, SUIT_SIZE, suitPixels[i]);
+        endBandPush();
+        return true;
+    }
+    return false;
+}
 
 void drawCardSymbol(String rank, String suitChar) {
+    uint32_t stageStart = beginStage();
     clearContentArea();
     setScreenName("Card");
     
-    // Navigation hint
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    String backHint = "Back->";
-    int backWidth = tft.textWidth(backHint.c_str());
-    tft.setCursor(tft.width() - backWidth - 5, tft.height() - 10);
-    tft.print(backHint);
+    drawCardBackHint();
     
     // --- Display card rank and suit bitmap ---
-    const GFXfont* rankFont = &DejaVuSans_Bold36pt7b;
-    tft.setFreeFont(rankFont);
+    const RleFont* rankFont = FONT_CARD_RANK;
     
     int rankHeight = rankFont->yAdvance;
-    int rankWidth = tft.textWidth(rank);
-    int spacing = 8;
-    
-    const unsigned char* suit_bits = nullptr;
-    int suit_width = 0;
-    int suit_height = 0;
-    uint16_t suitColor;
+    int rankWidth = rleTextWidth(*rankFont, rank.c_str());
+    int spacing = CARD_SPACING;
     
-    if (suitChar == "H") {
-        suit_bits = heart_bits; suit_width = heart_width; suit_height = heart_height;
-        suitColor = TFT_RED;
-    } else if (suitChar == "D") {
-        suit_bits = diamond_bits; suit_width = diamond_width; suit_height = diamond_height;
-        suitColor = TFT_RED;
-    } else if (suitChar == "S") {
-        suit_bits = spade_bits; suit_width = spade_width; suit_height = spade_height;
-        suitColor = TFT_WHITE;
-    } else if (suitChar == "C") {
-        suit_bits = club_bits; suit_width = club_width; suit_height = club_height;
-        suitColor = TFT_WHITE;
-    }
+    int suit_width = SUIT_SIZE;
+    int suit_height = SUIT_SIZE;
     
     int totalWidth = rankWidth + spacing + suit_width;
-    int startX = (tft.width() - totalWidth) / 2;
+    int startX = (layout->width - totalWidth) / 2;
 
     // Find the max height for vertical alignment calculations
     int maxHeight = max(rankHeight, suit_height);
 
-    // Calculate the top Y position for the combined element, then move it up by 6 pixels
-    int startY = ((tft.height() - HEADER_HEIGHT - maxHeight) / 2) + HEADER_HEIGHT;
+    // Top of the combined element, centred in the content area
+    int startY = ((layout->height - HEADER_HEIGHT - maxHeight) / 2) + HEADER_HEIGHT;
     
     // Draw Rank
     // The rank should always be white.
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setCursor(startX, startY + (maxHeight - rankHeight) / 2 + 58);
-    tft.print(rank);
+    drawRleText(startX, startY + (maxHeight - rankHeight) / 2 + CARD_RANK_BASELINE, rank, *rankFont, TFT_WHITE, TFT_BLACK);
     
-    // Draw Suit
-    if (suit_bits) {
-        drawSuitBitmap(startX + rankWidth + spacing, startY + (maxHeight - suit_height) / 2 - 8, suit_bits, suit_width, suit_height, suitColor);
+    // Draw Suit, already expanded in its colour at boot
+    if (suitChar.length() == 1) {
+        drawSuitSprite(startX + rankWidth + spacing, startY + (maxHeight - suit_height) / 2 - CARD_SUIT_RAISE, suitChar[0]);
+    }
+    endStage(STAGE_CARD_SYMBOL, stageStart);
+}
+
+// ============================================================================
+// CARD FACES
+// ============================================================================
+
+// Laid out once per card, then rasterised a band at a time into the line buffers
+static CardFace cardFace;
+
+// Space a card face may take: the content area, less the hint row in portrait
+// where the card spans the full width
+static void cardFaceBox(int16_t& top, int16_t& maxWidth, int16_t& maxHeight) {
+    top = layout->cardTop;
+    maxWidth = layout->width - 2 * layout->margin;
+    maxHeight = layout->cardBottom - top;
+}
+
+// Pushes the laid out face with its top left corner at (x, y). Returns the time
+// spent rasterising rows, the rest being spent waiting on the panel.
+static unsigned long pushCardFace(int16_t x, int16_t y) {
+    const int16_t w = cardFace.width;
+    const int16_t rowsPerChunk = LINE_BUFFER_PIXELS / w;
+    unsigned long renderMicros = 0;
+
+    beginBandPush();
+    for (int16_t row = 0, chunk = 0; row < cardFace.height; row += rowsPerChunk, chunk++) {
+        int16_t rows = min((int16_t)(cardFace.height - row), rowsPerChunk);
+        uint16_t* buffer = lineBuffers[chunk & 1];
+
+        unsigned long start = micros();
+        for (int16_t j = 0; j < rows; j++) {
+            renderCardFaceRow(cardFace, row + j, buffer + j * w);
+        }
+        renderMicros += micros() - start;
+        pushBand(x, y + row, w, rows, buffer);
+    }
+    endBandPush();
+    return renderMicros;
+}
+
+void drawCardFace(String rank, String suitChar) {
+    uint32_t stageStart = beginStage();
+    int16_t top, maxWidth, maxHeight;
+    cardFaceBox(top, maxWidth, maxHeight);
+    if (suitChar.length() != 1 ||
+        !layoutCardFace(cardFace, rank.c_str(), suitChar[0], maxWidth, maxHeight, *FONT_CARD_RANK)) {
+        // Not a card this renderer knows; show it the way symbol mode would
+        drawCardSymbol(rank, suitChar);
+        return;
+    }
+
+    clearContentArea();
+    setScreenName("Card");
+    drawCardBackHint();
+
+#if RENDER_TIMING_LOG
+    unsigned long start = micros();
+    unsigned long renderMicros = pushCardFace((layout->width - cardFace.width) / 2,
+                                              top + (maxHeight - cardFace.height) / 2);
+    endStage(STAGE_CARD_FACE, stageStart);
+    Serial.print("Card face ");
+    Serial.print(cardFace.width);
+    Serial.print("x");
+    Serial.print(cardFace.height);
+    Serial.print(" drawn in ");
+    Serial.print(micros() - start);
+    Serial.print(" us (");
+    Serial.print(renderMicros);
+    Serial.println(" us rasterising)");
+#else
+    pushCardFace((layout->width - cardFace.width) / 2, top + (maxHeight - cardFace.height) / 2);
+    endStage(STAGE_CARD_FACE, stageStart);
+#endif
+}
+
+// Clears the content area and draws the current page over it in full
+static void redrawCurrentPage() {
+    clearContentArea();
+    switch (currentPage) {
+        case PAGE_MAIN_MENU: drawMainMenu(); break;
+        case PAGE_INFO: drawInfoPage(); break;
+        case PAGE_MESSAGES: displayCurrentMessage(); break;
+        case PAGE_SETTINGS:
+            if (inSubMenu) drawSubMenu();
+            else drawSettingsMenu();
+            break;
+    }
+}
+
+// Draws all 52 faces back to back and reports layout, raster and total time
+// per card, then puts back the page that was showing
+void benchmarkCardFaces() {
+    static const char* ranks[] = { "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K" };
+    static const char suits[] = { 'S', 'H', 'C', 'D' };
+
+    int16_t top, maxWidth, maxHeight;
+    cardFaceBox(top, maxWidth, maxHeight);
+    clearContentArea();
+    setScreenName("Card Bench");
+
+    int cards = 0;
+    unsigned long layoutTotal = 0;
+    unsigned long renderTotal = 0;
+    unsigned long total = 0;
+    unsigned long fastest = ULONG_MAX;
+    unsigned long slowest = 0;
+    String slowestCard;
+    for (char suit : suits) {
+        for (const char* rank : ranks) {
+            unsigned long start = micros();
+            if (!layoutCardFace(cardFace, rank, suit, maxWidth, maxHeight, *FONT_CARD_RANK)) continue;
+            unsigned long laidOut = micros();
+            unsigned long renderMicros = pushCardFace((layout->width - cardFace.width) / 2,
+                                                      top + (maxHeight - cardFace.height) / 2);
+            unsigned long elapsed = micros() - start;
+
+            cards++;
+            layoutTotal += laidOut - start;
+            renderTotal += renderMicros;
+            total += elapsed;
+            if (elapsed < fastest) fastest = elapsed;
+            if (elapsed > slowest) {
+                slowest = elapsed;
+                slowestCard = String(rank) + suit;
+            }
+        }
+    }
+    if (cards == 0) return;
+
+    Serial.print("Card faces: ");
+    Serial.print(cards);
+    Serial.print(" cards at ");
+    Serial.print(cardFace.width);
+    Serial.print("x");
+    Serial.print(cardFace.height);
+    Serial.print(", avg ");
+    Serial.print(total / cards);
+    Serial.print(" us (layout ");
+    Serial.print(layoutTotal / cards);
+    Serial.print(", raster ");
+    Serial.print(renderTotal / cards);
+    Serial.print("), min ");
+    Serial.print(fastest);
+    Serial.print(" us, max ");
+    Serial.print(slowest);
+    Serial.print(" us (");
+    Serial.print(slowestCard);
+    Serial.print("), ");
+    Serial.print(total / 1000);
+    Serial.println(" ms for the deck");
+
+    // Put back whatever the benchmark covered
+    redrawCurrentPage();
+}
+
+static bool ensureMessageCanvas(int32_t width, int32_t height, int8_t depth) {
+    if (messageCanvasWidth == width && messageCanvasHeight == height && messageCanvasDepth == depth) return true;
+
+    messageCanvas.deleteSprite();
+    messageCanvas.setColorDepth(depth);
+    if (!messageCanvas.createSprite(width, height)) {
+        Serial.println("Failed to allocate memory for message canvas");
+        messageCanvasWidth = 0;
+        messageCanvasHeight = 0;
+        messageCanvasDepth = 0;
+        return false;
+    }
+
+    // Byte-swap the colors for pushImage to prevent red from becoming blue.
+    if (depth == 1) {
+        buildMonoExpandLut(messageLut, swap565(TFT_GREEN), swap565(TFT_BLACK));
+    } else {
+        uint16_t ramp[16];
+        for (int i = 0; i < 16; i++) {
+            ramp[i] = swap565(((63 * i + 7) / 15) << 5);
+        }
+        buildPaletteExpandLut(messageRampLut, ramp, 16);
+    }
+    messageCanvasWidth = width;
+    messageCanvasHeight = height;
+    messageCanvasDepth = depth;
+    return true;
+}
+
+// Word wrap for message text. fitMessageText() follows the same rules, so the
+// line count here always matches the height it worked out. Words within a line
+// are only ever separated by the spaces between them in the message, so each
+// line is kept as a range of the message rather than a copy.
+static void wrapMessageLines(const String& message, int maxWidth, int font, std::vector<MessageLine>& lines) {
+    const char* text = message.c_str();
+    int length = message.length();
+    int lineStart = 0, lineEnd = 0;
+    bool lineEmpty = true;
+    int wordStart = 0;
+
+    for (int i = 0; i < length; i++) {
+        char c = text[i];
+        if (c != ' ' && c != '\n' && i != length - 1) continue;
+
+        int wordEnd = (i == length - 1 && c != ' ' && c != '\n') ? i + 1 : i;
+        bool wordEmpty = (wordEnd == wordStart);
+
+        // currentLine + " " + word, or the word alone on an empty line
+        int testStart = lineEmpty ? wordStart : lineStart;
+        if (!lineEmpty && ladderTextWidth(font, text + testStart, wordEnd - testStart) > maxWidth) {
+            lines.push_back({ (uint16_t)lineStart, (uint16_t)(lineEnd - lineStart) });
+            lineStart = wordStart;
+            lineEmpty = wordEmpty;
+        } else {
+            lineStart = testStart;
+            lineEmpty = lineEmpty && wordEmpty;
+        }
+        lineEnd = wordEnd;
+        wordStart = i + 1;
+
+        if (c == '\n') {
+            lines.push_back({ (uint16_t)lineStart, (uint16_t)(lineEmpty ? 0 : lineEnd - lineStart) });
+            lineEmpty = true;
+        }
+    }
+    if (!lineEmpty) {
+        lines.push_back({ (uint16_t)lineStart, (uint16_t)(lineEnd - lineStart) });
+    }
+}
+
+static bool isMarqueeMessage() {
+    return totalMessages > 0 && messageHistory[displayMessageIndex].startsWith("[MARQUEE]");
+}
+
+static String currentMessageText() {
+    if (totalMessages == 0) return "Waiting for messages...";
+    if (displayMessageIndex < 0) displayMessageIndex = 0;
+    if (displayMessageIndex >= totalMessages) displayMessageIndex = totalMessages - 1;
+    if (isMarqueeMessage()) return messageHistory[displayMessageIndex].substring(9);
+    return messageHistory[displayMessageIndex];
+}
+
+static int32_t marqueeStripBytes(int32_t width, int32_t height, int8_t depth) {
+    return (depth == 1) ? (width + 7) / 8 * height : (width + 1) / 2 * height;
+}
+
+// Lays the message out on one line: the largest font whose line fits the
+// content height and whose strip fits MARQUEE_STRIP_BYTES. The smallest font
+// is used regardless, with the strip cut short if it is still too wide.
+static void layoutMarquee(const String& text, int contentHeight, FitResult& fit) {
+    int maxHeight = contentHeight;
+    int32_t width;
+    int8_t depth;
+    for (;;) {
+        fitMessageText(text, INT16_MAX, maxHeight, fit);
+        width = ladderTextWidth(fit.font, text) + MARQUEE_GAP;
+        depth = (ladderSmoothFont(fit.font) >= 0) ? 4 : 1;
+        if (marqueeStripBytes(width, fit.height, depth) <= MARQUEE_STRIP_BYTES) break;
+        if (fit.font == fontLadderSize() - 1) {
+            width = MARQUEE_STRIP_BYTES / max(fit.height, 1) * (depth == 1 ? 8 : 2);
+            break;
+        }
+        maxHeight = fit.height - 1; // rule out this font and any as tall
+    }
+
+    marqueeWidth = (width + 1) & ~1; // whole bytes per row at 4bpp
+    marqueeHeight = max(fit.height, 1);
+    Serial.print("Marquee strip: ");
+    Serial.print(marqueeWidth);
+    Serial.print("x");
+    Serial.print(marqueeHeight);
+    Serial.print(", ");
+    Serial.print(marqueeStripBytes(marqueeWidth, marqueeHeight, depth));
+    Serial.println(" bytes");
+}
+
+// Draws the text into the strip once, indented like wrapped messages; frames
+// only copy a window out of it
+static bool renderMarqueeStrip(const String& text) {
+    int font = messageScroll.font;
+    int smoothFont = ladderSmoothFont(font);
+    int8_t depth = (smoothFont >= 0) ? 4 : 1;
+    if (!ensureMessageCanvas(marqueeWidth, marqueeHeight, depth)) return false;
+
+    SpanCanvas canvas;
+    if (!beginSpanCanvas(canvas, (uint8_t*)messageCanvas.getPointer(), marqueeWidth, marqueeHeight, depth)) return false;
+    if (smoothFont >= 0) {
+        drawSmoothTextSpans(canvas, smoothFont, layout->margin, messageScroll.ascent, text);
+    } else {
+        drawGfxTextSpans(canvas, ladderGfxFont(font), layout->margin, messageScroll.ascent, text.c_str(), text.length());
+    }
+    finishSpanCanvas(canvas);
+    return true;
+}
+
+// Expands w pixels of a 1bpp or 4bpp canvas row starting at column x
+static void expandCanvasSpan(uint16_t* dst, const uint8_t* row, int32_t x, int32_t w, int8_t depth,
+                             const MonoExpandLut& monoLut, const PaletteExpandLut& rampLut) {
+    if (w <= 0) return;
+    if (depth == 1) {
+        expandMonoRow(dst, row, x, w, monoLut);
+        return;
+    }
+    if (x & 1) {
+        // Odd start: the low nibble of the first byte
+        *dst++ = rampLut.colors[row[x >> 1] & 0x0F];
+        x++;
+        w--;
+    }
+    expandPaletteRow(dst, row + (x >> 1), w, rampLut);
+}
+
+// Expands w pixels of a strip row starting at column x
+static void expandStripSpan(uint16_t* dst, const uint8_t* row, int32_t x, int32_t w, int8_t depth) {
+    expandCanvasSpan(dst, row, x, w, depth, messageLut, messageRampLut);
+}
+
+// Pushes the part of the strip under the window, starting at column
+// messageScroll.offset. Only the strip's rows are sent, not the content area.
+static void drawMarqueeFrame() {
+    int contentStartY = layout->messageTop;
+    int contentWidth = layout->width;
+    int contentHeight = layout->messageHeight;
+    int32_t stripY = contentStartY + max(0, (contentHeight - (int)marqueeHeight) / 2);
+    int32_t rowsVisible = min(marqueeHeight, (int32_t)contentHeight);
+
+    beginFrameTiming();
+    uint32_t stageStart = beginStage();
+    if (mirrorMessages) {
+        setMirroredColumnOrder(true);
+    }
+
+    const uint8_t* pixels = (const uint8_t*)messageCanvas.getPointer();
+    const int8_t depth = messageCanvasDepth;
+    const int32_t stride = (depth == 1) ? (marqueeWidth + 7) / 8 : marqueeWidth / 2;
+    const int32_t rowsPerChunk = LINE_BUFFER_PIXELS / contentWidth;
+
+    beginBandPush();
+    for (int32_t row = 0, chunk = 0; row < rowsVisible; row += rowsPerChunk, chunk++) {
+        unsigned long renderStart = micros();
+        int32_t rows = min(rowsPerChunk, rowsVisible - row);
+        uint16_t* buffer = lineBuffers[chunk & 1];
+        for (int32_t j = 0; j < rows; j++) {
+            uint16_t* dst = buffer + j * contentWidth;
+            const uint8_t* src = pixels + (row + j) * stride;
+
+            // The window wraps to the start of the strip, more than once if
+            // the strip is narrower than the screen
+            int32_t x = messageScroll.offset;
+            for (int32_t filled = 0; filled < contentWidth; ) {
+                int32_t n = min(contentWidth - filled, marqueeWidth - x);
+                expandStripSpan(dst + filled, src, x, n, depth);
+                filled += n;
+                x = 0;
+            }
+        }
+        markFrameRenderTime(micros() - renderStart);
+
+        pushBand(0, stripY + row, contentWidth, rows, buffer);
+    }
+    endBandPush();
+
+    if (mirrorMessages) {
+        setMirroredColumnOrder(false);
     }
+    endStage(STAGE_MARQUEE, stageStart);
+    endFrameTiming("marquee");
 }
 
 void displayCurrentMessage() {
     // This function is now an initializer for the message screen.
     // It sets up the static elements and determines if scrolling is needed.
     
+    messageFrameShown = false;
+
     // First, check if the message is a card symbol message
     if (totalMessages > 0 && messageHistory[displayMessageIndex].startsWith("[CARD:")) {
         String message = messageHistory[displayMessageIndex];
@@ -382,63 +1322,100 @@ void displayCurrentMessage() {
             return;
         }
     }
+    if (totalMessages > 0 && messageHistory[displayMessageIndex].startsWith("[FACE:")) {
+        String message = messageHistory[displayMessageIndex];
+        int rankEnd = message.indexOf(',');
+        int suitEnd = message.indexOf(']');
+        if (rankEnd != -1 && suitEnd != -1) {
+            drawCardFace(message.substring(6, rankEnd), message.substring(rankEnd + 1, suitEnd));
+            return;
+        }
+    }
     
-    clearContentArea();
-    tft.setRotation(1);
+    if (transitionPending) {
+        // The message window is animated over, so only clear around it
+        pageLayout = LAYOUT_NONE;
+        int windowBottom = layout->messageTop + layout->messageHeight;
+        tft.fillRect(0, HEADER_HEIGHT + 1, tft.width(), layout->messageTop - HEADER_HEIGHT - 1, TFT_BLACK);
+        tft.fillRect(0, windowBottom, tft.width(), tft.height() - windowBottom, TFT_BLACK);
+    } else {
+        clearContentArea();
+    }
 
     currentPage = PAGE_MESSAGES;
     setScreenName("Messages");
 
     // Reset scrolling state for the new message
     messageScroll.isLong = false;
+    messageScroll.marquee = false;
     messageScroll.offset = 0;
     messageScroll.state = 0; // 0 = paused at top
     messageScroll.lastTime = millis();
 
     // --- Draw static UI elements ---
-    int topY = HEADER_HEIGHT + 16;
-    int bottomY = tft.height() - 6;
+    int topY = layout->messageHintBaseline;
+    int bottomY = layout->messageFooterBaseline;
+    int margin = layout->margin;
     
     tft.setTextColor(TFT_CYAN, TFT_BLACK);
     tft.setFreeFont(FONT_SANS_9);
 
     String msgCountText = "Msg " + (totalMessages > 0 ? String(displayMessageIndex + 1) : "0") + "/" + String(totalMessages);
-    tft.setCursor(5, topY);
+    tft.setCursor(margin, topY);
     tft.print(msgCountText);
 
     String topRightText = (totalMessages > 0) ? "Prev->" : "Exit->";
     int topRightWidth = tft.textWidth(topRightText.c_str());
-    tft.setCursor(tft.width() - topRightWidth - 5, topY);
+    tft.setCursor(layout->width - topRightWidth - margin, topY);
     tft.print(topRightText);
 
-    tft.setCursor(5, bottomY);
+    tft.setCursor(margin, layout->messageHoldBaseline);
     tft.print("Hold Bttn: Main");
 
     String bottomRightText = "Next->";
     int bottomRightWidth = tft.textWidth(bottomRightText.c_str());
-    tft.setCursor(tft.width() - bottomRightWidth - 5, bottomY);
+    tft.setCursor(layout->width - bottomRightWidth - margin, bottomY);
     tft.print(bottomRightText);
 
-    // --- Calculate message height and determine if scrolling is needed ---
-    if (totalMessages > 0) {
-        int contentWidth = tft.width();
-        int contentHeight = tft.height() - (topY + 8) - 20;
-        String message = messageHistory[displayMessageIndex];
-
-        // Find best font size that fits horizontally
-        messageScroll.font = FONT_SANS_9; // Default to smallest
-        if (calculateWrappedTextHeight(message, FONT_SANS_BOLD_12, contentWidth - 10) <= contentHeight) {
-            messageScroll.font = FONT_SANS_BOLD_12;
-        } else if (calculateWrappedTextHeight(message, FONT_SANS_12, contentWidth - 10) <= contentHeight) {
-            messageScroll.font = FONT_SANS_12;
+    // --- Pick the font and determine if scrolling is needed ---
+    int contentWidth = layout->width;
+    int contentHeight = layout->messageHeight;
+
+    String text = currentMessageText();
+    FitResult fit;
+    fitMessageText(text, contentWidth - 2 * layout->margin, contentHeight, fit);
+
+    // Sent after #MARQUEE, or has a word that would be clipped even in the
+    // smallest font: show it on one line scrolling sideways
+    if (isMarqueeMessage() || fit.overflow) {
+        // Marquee frames only cover the strip, so there is nothing to animate to
+        if (transitionPending) {
+            transitionPending = false;
+            tft.fillRect(0, layout->messageTop, contentWidth, contentHeight, TFT_BLACK);
         }
+        layoutMarquee(text, contentHeight, fit);
+        messageScroll.font = fit.font;
+        messageScroll.ascent = fit.ascent;
+        messageScroll.totalHeight = fit.height;
+        if (renderMarqueeStrip(text)) {
+            messageScroll.marquee = true;
+            drawMarqueeFrame();
+            return;
+        }
+        // No memory for the strip: wrap it like any other message
+        fitMessageText(text, contentWidth - 2 * layout->margin, contentHeight, fit);
+    }
 
-        // Now get the full height with the chosen font
-        messageScroll.totalHeight = calculateWrappedTextHeight(message, messageScroll.font, contentWidth - 10);
+    messageScroll.font = fit.font;
+    messageScroll.ascent = fit.ascent;
+    messageScroll.totalHeight = fit.height;
 
-        if (messageScroll.totalHeight > contentHeight) {
-            messageScroll.isLong = true;
-        }
+    messageText = text;
+    messageLines.clear();
+    wrapMessageLines(messageText, contentWidth - 2 * layout->margin, fit.font, messageLines);
+
+    if (messageScroll.totalHeight > contentHeight) {
+        messageScroll.isLong = true;
     }
 
     // Perform the initial draw of the message content
@@ -447,94 +1424,409 @@ void displayCurrentMessage() {
 
 void drawMessageContent() {
     // This function draws the message content itself, using the current scrollOffset
-    int topY = HEADER_HEIGHT + 16;
-    int contentStartY = topY + 8;
-    int contentWidth = tft.width();
-    int contentHeight = tft.height() - contentStartY - 20;
-
-    TFT_eSprite messageSprite = TFT_eSprite(&tft);
-    messageSprite.createSprite(contentWidth, contentHeight);
-    messageSprite.fillSprite(TFT_BLACK);
-    messageSprite.setTextColor(TFT_GREEN, TFT_BLACK);
-
-    if (totalMessages == 0) {
-        messageSprite.setFreeFont(FONT_SANS_9);
-        messageSprite.setCursor(5, messageSprite.fontHeight() - 8);
-        messageSprite.println("Waiting for messages...");
-    } else {
-        if (displayMessageIndex < 0) displayMessageIndex = 0;
-        if (displayMessageIndex >= totalMessages) displayMessageIndex = totalMessages - 1;
+    int contentStartY = layout->messageTop;
+    int contentWidth = layout->width;
+    int contentHeight = layout->messageHeight;
+
+    int font = messageScroll.font;
+    int smoothFont = ladderSmoothFont(font);
+    int8_t depth = (smoothFont >= 0) ? 4 : 1;
+
+    if (!ensureMessageCanvas(contentWidth, contentHeight, depth)) return;
+
+    beginFrameTiming();
+    unsigned long renderStart = micros();
+    uint32_t stageStart = beginStage();
+
+    int lineHeight = ladderLineHeight(font);
+    int firstBaseline = messageScroll.ascent - messageScroll.offset;
+
+    // Only the lines that reach the viewport are drawn, so a frame costs the
+    // same however long the message is. Start one line early for descenders.
+    int lineCount = messageLines.size();
+    int first = max(0, (messageScroll.offset - messageScroll.ascent) / lineHeight - 1);
+    int last = first;
+    while (last < lineCount && firstBaseline + last * lineHeight - lineHeight < contentHeight) {
+        last++;
+    }
 
-        String message = messageHistory[displayMessageIndex];
-        
-        messageSprite.setFreeFont(messageScroll.font);
-        // Set cursor with scroll offset
-        messageSprite.setCursor(5, messageSprite.fontHeight() - 8 - messageScroll.offset);
-
-        // Simple word wrap implementation onto the sprite
-        String currentLine = "";
-        String word = "";
-        for (int i = 0; i < message.length(); i++) {
-            char c = message[i];
-            if (c == ' ' || c == '\n' || i == message.length() - 1) {
-                if (i == message.length() - 1 && c != ' ' && c != '\n') word += c;
-
-                String testLine = currentLine + (currentLine == "" ? word : " " + word);
-                if (messageSprite.textWidth(testLine.c_str()) > contentWidth - 10 && currentLine != "") {
-                    messageSprite.println(currentLine);
-                    currentLine = word;
-                } else {
-                    currentLine = testLine;
-                }
-                word = "";
-                if (c == '\n') {
-                    messageSprite.println(currentLine);
-                    currentLine = "";
-                }
+    // Text and background are written in one pass over the canvas rather than
+    // clearing it and then drawing over the top
+    SpanCanvas canvas;
+    if (!beginSpanCanvas(canvas, (uint8_t*)messageCanvas.getPointer(), contentWidth, contentHeight, depth)) return;
+    const GFXfont* gfxFont = ladderGfxFont(font);
+    for (int i = first; i < last; i++) {
+        const MessageLine& line = messageLines[i];
+        int baseline = firstBaseline + i * lineHeight;
+        if (smoothFont >= 0) {
+            // Coverage goes straight into the 4bpp buffer as ramp indices
+            drawSmoothTextSpans(canvas, smoothFont, layout->margin, baseline,
+                                messageText.substring(line.start, line.start + line.length));
+        } else {
+            drawGfxTextSpans(canvas, gfxFont, layout->margin, baseline, messageText.c_str() + line.start, line.length);
+        }
+    }
+    finishSpanCanvas(canvas);
+    markFrameRenderTime(micros() - renderStart);
+    endStage(STAGE_MESSAGE_TEXT, stageStart);
+
+    if (transitionPending) {
+        transitionPending = false;
+        runMessageTransition();
+        messageFrameShown = true;
+        return;
+    }
+
+    // Mirroring is done by the panel's column address order, so mirrored frames
+    // push exactly the same pixels as normal ones. The message window spans the
+    // full width, so its position is the same either way.
+    stageStart = beginStage();
+    if (mirrorMessages) {
+        setMirroredColumnOrder(true);
+    }
+
+    // Expand a few rows at a time to RGB565 while the previous rows are sent
+    const uint8_t* pixels = (const uint8_t*)messageCanvas.getPointer();
+    const int32_t stride = (depth == 1) ? (contentWidth + 7) / 8 : (contentWidth + 1) / 2;
+    const int32_t rowsPerChunk = LINE_BUFFER_PIXELS / contentWidth;
+
+    beginBandPush();
+    for (int32_t row = 0, chunk = 0; row < contentHeight; row += rowsPerChunk, chunk++) {
+        renderStart = micros();
+        int32_t rows = min(rowsPerChunk, (int32_t)contentHeight - row);
+        uint16_t* buffer = lineBuffers[chunk & 1];
+        for (int32_t j = 0; j < rows; j++) {
+            if (depth == 1) {
+                expandMonoRow(buffer + j * contentWidth, pixels + (row + j) * stride, 0, contentWidth, messageLut);
             } else {
-                word += c;
+                expandPaletteRow(buffer + j * contentWidth, pixels + (row + j) * stride, contentWidth, messageRampLut);
             }
         }
-        if (currentLine != "") {
-            messageSprite.println(currentLine);
+        markFrameRenderTime(micros() - renderStart);
+
+        pushBand(0, contentStartY + row, contentWidth, rows, buffer);
+    }
+    endBandPush();
+
+    if (mirrorMessages) {
+        setMirroredColumnOrder(false);
+    }
+    endStage(STAGE_MESSAGE_PUSH, stageStart);
+
+    endFrameTiming("message");
+    messageFrameShown = true;
+}
+
+// ============================================================================
+// MESSAGE TRANSITIONS
+// ============================================================================
+
+// Copies the message window as last pushed, with the colours it was drawn in
+static bool snapshotMessageFrame() {
+    if (!messageFrameShown || messageCanvasWidth != layout->width || messageCanvasHeight != layout->messageHeight) {
+        return false;
+    }
+
+    int32_t stride = (messageCanvasDepth == 1) ? (messageCanvasWidth + 7) / 8 : (messageCanvasWidth + 1) / 2;
+    int32_t bytes = stride * messageCanvasHeight;
+    if (bytes > transitionFromBytes) {
+        free(transitionFrom);
+        transitionFrom = (uint8_t*)malloc(bytes);
+        transitionFromBytes = transitionFrom ? bytes : 0;
+        if (!transitionFrom) {
+            Serial.println("Failed to allocate memory for message transition");
+            return false;
+        }
+    }
+
+    memcpy(transitionFrom, messageCanvas.getPointer(), bytes);
+    transitionFromDepth = messageCanvasDepth;
+    return true;
+}
+
+void displayMessageWithTransition(int direction) {
+    if (messageTransition != TRANSITION_OFF && currentPage == PAGE_MESSAGES && snapshotMessageFrame()) {
+        transitionPending = true;
+        transitionDirection = direction;
+    }
+    displayCurrentMessage();
+    transitionPending = false; // cards draw without one
+}
+
+// Blends two byte-swapped RGB565 pixels, alpha 0 (from) to 32 (to). Green and
+// red/blue are spread over a 32 bit word so one multiply blends all three.
+static inline uint16_t blend565(uint16_t from, uint16_t to, uint32_t alpha) {
+    uint32_t a = swap565(from);
+    uint32_t b = swap565(to);
+    a = (a | (a << 16)) & 0x07E0F81F;
+    b = (b | (b << 16)) & 0x07E0F81F;
+    uint32_t blended = ((((b - a) * alpha) >> 5) + a) & 0x07E0F81F;
+    return swap565((uint16_t)(blended | (blended >> 16)));
+}
+
+// One row of the window part way through, progress 0-256
+static void composeTransitionRow(uint16_t* dst, const uint8_t* fromRow, const uint8_t* toRow, int32_t w,
+                                 int8_t toDepth, int32_t progress) {
+    if (messageTransition == TRANSITION_FADE) {
+        expandCanvasSpan(dst, fromRow, 0, w, transitionFromDepth, messageLut, messageRampLut);
+        expandCanvasSpan(transitionRow, toRow, 0, w, toDepth, messageLut, messageRampLut);
+        uint32_t alpha = progress >> 3;
+        for (int32_t x = 0; x < w; x++) {
+            dst[x] = blend565(dst[x], transitionRow[x], alpha);
+        }
+        return;
+    }
+
+    // Slide: the old message moves out as the new one follows it in
+    int32_t shift = w * progress >> 8;
+    if (transitionDirection > 0) {
+        expandCanvasSpan(dst, fromRow, shift, w - shift, transitionFromDepth, messageLut, messageRampLut);
+        expandCanvasSpan(dst + w - shift, toRow, 0, shift, toDepth, messageLut, messageRampLut);
+    } else {
+        expandCanvasSpan(dst, toRow, w - shift, shift, toDepth, messageLut, messageRampLut);
+        expandCanvasSpan(dst + shift, fromRow, 0, w - shift, transitionFromDepth, messageLut, messageRampLut);
+    }
+}
+
+// Streams frames from the snapshot to the message canvas at TRANSITION_FPS. As
+// with scrolling, each frame's position comes from the time it is drawn, so a
+// late frame catches up rather than stretching the animation.
+static void runMessageTransition() {
+    const int32_t contentStartY = layout->messageTop;
+    const int32_t w = layout->width;
+    const int32_t h = layout->messageHeight;
+    const int8_t toDepth = messageCanvasDepth;
+    const uint8_t* toPixels = (const uint8_t*)messageCanvas.getPointer();
+    const int32_t toStride = (toDepth == 1) ? (w + 7) / 8 : (w + 1) / 2;
+    const int32_t fromStride = (transitionFromDepth == 1) ? (w + 7) / 8 : (w + 1) / 2;
+    const int32_t rowsPerChunk = LINE_BUFFER_PIXELS / w;
+    const unsigned long frameInterval = TRANSITION_FRAME_INTERVAL * 1000;
+
+    if (mirrorMessages) {
+        setMirroredColumnOrder(true);
+    }
+
+    unsigned long start = micros();
+    unsigned long due = start;
+    unsigned long lastFrame = start;
+    unsigned long intervalMin = ULONG_MAX;
+    unsigned long intervalMax = 0;
+    uint32_t frames = 0;
+    uint32_t late = 0;
+    int32_t progress = 0;
+
+    while (progress < 256) {
+        unsigned long now = micros();
+        if ((long)(due - now) > 0) {
+            // Sleep out the rest of the interval, rounded up to a whole tick,
+            // so the other tasks run while the frame waits
+            vTaskDelay(pdMS_TO_TICKS((due - now + 999) / 1000));
+            now = micros();
+        }
+        if (frames > 0) {
+            unsigned long interval = now - lastFrame;
+            if (interval < intervalMin) intervalMin = interval;
+            if (interval > intervalMax) intervalMax = interval;
+            if (interval > frameInterval * 3 / 2) late++;
+        }
+        lastFrame = now;
+
+        // Ease out: quick to start, settling into place
+        unsigned long elapsed = now - start;
+        int32_t linear = min((unsigned long)256, elapsed * 256 / (TRANSITION_TIME * 1000));
+        progress = 256 - (256 - linear) * (256 - linear) / 256;
+
+        beginFrameTiming();
+        uint32_t stageStart = beginStage();
+        beginBandPush();
+        for (int32_t row = 0, chunk = 0; row < h; row += rowsPerChunk, chunk++) {
+            unsigned long renderStart = micros();
+            int32_t rows = min(rowsPerChunk, h - row);
+            uint16_t* buffer = lineBuffers[chunk & 1];
+            for (int32_t j = 0; j < rows; j++) {
+                composeTransitionRow(buffer + j * w, transitionFrom + (row + j) * fromStride,
+                                     toPixels + (row + j) * toStride, w, toDepth, progress);
+            }
+            markFrameRenderTime(micros() - renderStart);
+            pushBand(0, contentStartY + row, w, rows, buffer);
+        }
+        endBandPush();
+        endStage(STAGE_TRANSITION, stageStart);
+        endFrameTiming("transition");
+        frames++;
+
+        // Next frame is due one interval after this one was, unless we have
+        // fallen a whole frame behind
+        due += frameInterval;
+        if ((long)(micros() - due) >= (long)frameInterval) {
+            due = micros();
         }
     }
 
     if (mirrorMessages) {
-        pushSpriteMirrored(&messageSprite, 0, contentStartY);
+        setMirroredColumnOrder(false);
+    }
+
+    Serial.print("Transition (");
+    Serial.print(transitionOptions[messageTransition]);
+    Serial.print("): ");
+    Serial.print(frames);
+    Serial.print(" frames in ");
+    Serial.print((micros() - start) / 1000);
+    Serial.print(" ms, target ");
+    Serial.print(TRANSITION_FRAME_INTERVAL);
+    if (frames > 1) {
+        Serial.print(" ms, interval min ");
+        Serial.print(intervalMin / 1000.0, 1);
+        Serial.print(", avg ");
+        Serial.print((lastFrame - start) / (frames - 1) / 1000.0, 1);
+        Serial.print(", max ");
+        Serial.print(intervalMax / 1000.0, 1);
+    }
+    Serial.print(" ms, ");
+    Serial.print(late);
+    Serial.println(" late");
+}
+
+// Scroll frame pacing since the last report
+static unsigned long lastScrollFrameMicros = 0;
+static uint32_t scrollFrames = 0;
+static uint32_t lateScrollFrames = 0;
+static unsigned long scrollIntervalTotal = 0;
+static unsigned long scrollIntervalMin = 0;
+static unsigned long scrollIntervalMax = 0;
+
+static void recordScrollFrame(bool firstFrame) {
+    unsigned long now = micros();
+    unsigned long interval = now - lastScrollFrameMicros;
+    lastScrollFrameMicros = now;
+    if (firstFrame) return; // the gap since the pause is not a frame interval
+
+    // Frame ticks are counted even when the offset has not moved yet (slow
+    // start of the ease), so this measures pacing and not scroll speed
+    if (scrollFrames == 0 || interval < scrollIntervalMin) scrollIntervalMin = interval;
+    if (interval > scrollIntervalMax) scrollIntervalMax = interval;
+    if (interval > SCROLL_FRAME_INTERVAL * 1500) lateScrollFrames++;
+    scrollIntervalTotal += interval;
+    scrollFrames++;
+
+    if (scrollFrames < FRAME_REPORT_INTERVAL) return;
+
+    Serial.print("Scroll pacing: target ");
+    Serial.print(SCROLL_FRAME_INTERVAL);
+    Serial.print(" ms, avg ");
+    Serial.print(scrollIntervalTotal / scrollFrames / 1000.0, 1);
+    Serial.print(" ms (min ");
+    Serial.print(scrollIntervalMin / 1000.0, 1);
+    Serial.print(", max ");
+    Serial.print(scrollIntervalMax / 1000.0, 1);
+    Serial.print("), ");
+    Serial.print(lateScrollFrames);
+    Serial.println(" late");
+
+    scrollFrames = 0;
+    lateScrollFrames = 0;
+    scrollIntervalTotal = 0;
+    scrollIntervalMax = 0;
+}
+
+// Scroll position a given time into the scroll. Speed ramps linearly from 0 to
+// SCROLL_SPEED over SCROLL_EASE, holds, then ramps back to 0 at the bottom.
+// Short scrolls never reach full speed and just speed up then slow down.
+static int scrollOffsetAt(unsigned long elapsed, int distance) {
+    if (distance <= 0) return 0;
+
+    float speed = SCROLL_SPEED / 1000.0f; // px per ms
+    float ease = min((float)SCROLL_EASE, distance / speed);
+    float duration = distance / speed + ease;
+    float t = elapsed;
+
+    float position;
+    if (t >= duration) {
+        return distance;
+    } else if (t < ease) {
+        position = speed * t * t / (2 * ease);
+    } else if (t < duration - ease) {
+        position = speed * ease / 2 + speed * (t - ease);
     } else {
-        messageSprite.pushSprite(0, contentStartY);
+        float remaining = duration - t;
+        position = distance - speed * remaining * remaining / (2 * ease);
+    }
+    return (int)(position + 0.5f);
+}
+
+// Marquee: pause at the start of the text, then scroll left at a constant
+// MARQUEE_SPEED, wrapping around the strip for as long as the message is shown
+static void updateMarquee(unsigned long time) {
+    if (messageScroll.state == 0) {
+        if (time - messageScroll.lastTime > SCROLL_PAUSE) {
+            messageScroll.state = 1;
+            messageScroll.lastTime = time;
+            messageScroll.lastFrame = time;
+            recordScrollFrame(true);
+        }
+        return;
+    }
+
+    if (time - messageScroll.lastFrame < SCROLL_FRAME_INTERVAL) return;
+    recordScrollFrame(false);
+    messageScroll.lastFrame += SCROLL_FRAME_INTERVAL;
+    if (time - messageScroll.lastFrame >= SCROLL_FRAME_INTERVAL) {
+        messageScroll.lastFrame = time;
     }
 
-    messageSprite.deleteSprite();
+    uint64_t travelled = (uint64_t)(time - messageScroll.lastTime) * MARQUEE_SPEED / 1000;
+    int offset = travelled % marqueeWidth;
+    if (offset != messageScroll.offset) {
+        messageScroll.offset = offset;
+        drawMarqueeFrame();
+    }
 }
 
 void updateDisplay() {
-    if (currentPage != PAGE_MESSAGES || !messageScroll.isLong) {
-        return; // Only scroll on the message page for long messages
-    }
+    if (currentPage != PAGE_MESSAGES) return;
 
     unsigned long time = millis();
+    if (messageScroll.marquee) {
+        updateMarquee(time);
+        return;
+    }
+    if (!messageScroll.isLong) {
+        return; // Only scroll on the message page for long messages
+    }
 
     // State 0: Paused at the top
     if (messageScroll.state == 0) {
         if (time - messageScroll.lastTime > SCROLL_PAUSE) {
             messageScroll.state = 1; // Start scrolling down
             messageScroll.lastTime = time;
+            messageScroll.lastFrame = time;
+            recordScrollFrame(true);
         }
     }
-    // State 1: Scrolling down
+    // State 1: Scrolling down. The position comes from the time since the
+    // scroll started, so a late frame catches up instead of slowing the scroll.
     else if (messageScroll.state == 1) {
-        if (time - messageScroll.lastTime > SCROLL_DELAY) {
-            messageScroll.offset++;
-            messageScroll.lastTime = time;
+        if (time - messageScroll.lastFrame < SCROLL_FRAME_INTERVAL) return;
+        recordScrollFrame(false);
+
+        // Next frame is due one interval after this one was, unless we have
+        // fallen a whole frame behind
+        messageScroll.lastFrame += SCROLL_FRAME_INTERVAL;
+        if (time - messageScroll.lastFrame >= SCROLL_FRAME_INTERVAL) {
+            messageScroll.lastFrame = time;
+        }
 
-            int contentHeight = tft.height() - (HEADER_HEIGHT + 16 + 8) - 20;
-            if (messageScroll.offset >= messageScroll.totalHeight - contentHeight) {
-                messageScroll.offset = messageScroll.totalHeight - contentHeight;
-                messageScroll.state = 2; // Reached bottom, start pause
-                messageScroll.lastTime = time;
-            }
+        int contentHeight = layout->messageHeight;
+        int distance = messageScroll.totalHeight - contentHeight;
+        int offset = scrollOffsetAt(time - messageScroll.lastTime, distance);
+        if (offset >= distance) {
+            offset = distance;
+            messageScroll.state = 2; // Reached bottom, start pause
+            messageScroll.lastTime = time;
+        }
+        if (offset != messageScroll.offset) {
+            messageScroll.offset = offset;
             drawMessageContent();
         }
     }
@@ -549,237 +1841,124 @@ void updateDisplay() {
     }
 }
 
-int calculateWrappedTextHeight(String message, const GFXfont* font, int maxWidth) {
-    // This function uses a temporary sprite to measure text height without drawing to the screen
-    TFT_eSprite tempSprite = TFT_eSprite(&tft);
-    tempSprite.createSprite(1, 1); // Minimal sprite to access font properties
-    tempSprite.setFreeFont(font);
-
-    int lineHeight = tempSprite.fontHeight();
-    int currentY = 0;
-    String currentLine = "";
-    String word = "";
-
-    for (int i = 0; i < message.length(); i++) {
-        char c = message[i];
-
-        if (c == ' ' || c == '\n' || i == message.length() - 1) {
-            if (i == message.length() - 1 && c != ' ' && c != '\n') {
-                word += c;
-            }
-
-            String testLine = currentLine + (currentLine == "" ? word : " " + word);
-            int textWidth = tempSprite.textWidth(testLine.c_str());
-
-            if (textWidth > maxWidth && currentLine != "") {
-                currentY += lineHeight;
-                currentLine = word;
-            } else {
-                currentLine = testLine;
-            }
-
-            word = "";
-            if (c == '\n') {
-                currentY += lineHeight;
-                currentLine = "";
-            }
-        } else {
-            word += c;
-        }
-    }
-
-    if (currentLine != "") {
-        currentY += lineHeight;
-    }
-
-    tempSprite.deleteSprite();
-    return currentY;
-}
-
 // ============================================================================
 // SETTINGS MENU DRAWING
 // ============================================================================
 
 void drawSettingsMenu() {
-    clearContentArea();
-    tft.setRotation(1);
-
-    // Draw navigation hints
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    String nextHint = "Sel->";
-    String selectHint = "Nxt->";
-    int nextWidth = tft.textWidth(nextHint.c_str());
-    int selectWidth = tft.textWidth(selectHint.c_str());
-
-    tft.setCursor(tft.width() - nextWidth - 5, HEADER_HEIGHT + 25);
-    tft.print(nextHint);
-    tft.setCursor(tft.width() - selectWidth - 5, tft.height() - 10);
-    tft.print(selectHint);
-
-    // New 3-phase scrolling logic
-    const int VISIBLE_ITEMS = 5;
-    const int PIN_ROW = VISIBLE_ITEMS / 2; // Middle row (index 2 for 5 items)
-
-    if (settingsMenuIndex < PIN_ROW) {
-        // Phase 1: Highlight moves down from top
-        settingsScrollOffset = 0;
-    } else if (settingsMenuIndex >= (NUM_SETTINGS_ITEMS - (VISIBLE_ITEMS - PIN_ROW))) {
-        // Phase 3: Highlight moves down at the bottom
-        settingsScrollOffset = NUM_SETTINGS_ITEMS - VISIBLE_ITEMS;
-    } else {
-        // Phase 2: Highlight is pinned to the middle, list scrolls
-        settingsScrollOffset = settingsMenuIndex - PIN_ROW;
+    // Draw settings items at the top of content area, as many as fit
+    int visibleItems = min((int)layout->settingsRows, NUM_SETTINGS_ITEMS);
+    static int settingsList = INVALID_WIDGET;
+    bool rebuilt = beginPage(LAYOUT_SETTINGS);
+    if (rebuilt) {
+        addPageHint(true, "Sel->");
+        addPageHint(false, "Nxt->");
+        settingsList = addPageList(2 * layout->margin, layout->settingsListBaseline, FONT_SANS_9, layout->settingsLineHeight,
+                                   settingsItems, NUM_SETTINGS_ITEMS, visibleItems);
     }
+    settingsScrollOffset = listScrollOffset(settingsMenuIndex, NUM_SETTINGS_ITEMS, visibleItems);
 
-    // Draw settings items at the top of content area - adjusted spacing
-    int startY = CONTENT_START_Y + 15;  // Moved up to just below header
-    int lineHeight = 18;              // Reduced line height to fit 5 items
-
-    for (int i = settingsScrollOffset; i < min(NUM_SETTINGS_ITEMS, settingsScrollOffset + VISIBLE_ITEMS); i++) {
-        int y = startY + ((i - settingsScrollOffset) * lineHeight);
-
-        tft.setFreeFont(FONT_SANS_9);
-
-        // If the item is "Card Type" and smart text is disabled, draw it in gray and make it unselectable.
-        if (strcmp(settingsItems[i], "Card Type") == 0 && !smartTextEnabled) {
-            tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
-        } else {
-            if (i == settingsMenuIndex) {
-                tft.setTextColor(TFT_GREEN, TFT_BLACK);
-            } else {
-                tft.setTextColor(TFT_WHITE, TFT_BLACK);
-            }
-        }
-
-        tft.setCursor(10, y);
-        if (strcmp(settingsItems[i], "Card Type") == 0) {
-            tft.print("- Card Type");
-        } else {
-            tft.print(settingsItems[i]);
-        }
+    // "Card Type" belongs to Smart Text, so it is shown as its child and is
+    // grey and unselectable while smart text is disabled
+    int cardTypeItem = -1;
+    for (int i = 0; i < NUM_SETTINGS_ITEMS; i++) {
+        if (strcmp(settingsItems[i], "Card Type") == 0) cardTypeItem = i;
     }
+    setPageList(settingsList, settingsMenuIndex, settingsScrollOffset, smartTextEnabled ? -1 : cardTypeItem, cardTypeItem);
+    flushPage(rebuilt);
 }
 
 void drawSubMenu() {
-    clearContentArea();
-    tft.setRotation(1);
-
-    // Draw submenu title
-    tft.setTextColor(TFT_WHITE, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_BOLD_12);
-    tft.setCursor(5, HEADER_HEIGHT + 25);
-    
-    tft.print(settingsItems[settingsMenuIndex]);
-
-    // Draw navigation hints
-    tft.setTextColor(TFT_CYAN, TFT_BLACK);
-    tft.setFreeFont(FONT_SANS_9);
-    String nextHint = "Sel->";
-    String selectHint = "Nxt->";
-    int nextWidth = tft.textWidth(nextHint.c_str());
-    int selectWidth = tft.textWidth(selectHint.c_str());
-
-    tft.setCursor(tft.width() - nextWidth - 5, HEADER_HEIGHT + 25);
-    tft.print(nextHint);
-    tft.setCursor(tft.width() - selectWidth - 5, tft.height() - 10);
-    tft.print(selectHint);
-
-    // Default start position for options
-    int startY = HEADER_HEIGHT + 50;
-
-    // Add description for Mirror Screen sub-menu
-    if (settingsMenuIndex == 3) { // Mirror Screen
-        tft.setFreeFont(FONT_SANS_9);
-        tft.setCursor(5, startY);
-        tft.print("Mirror received messages");
-        startY += 20; // Move options down to make space for the description
-    } else if (settingsMenuIndex == 5) { // Smart Text
-        tft.setFreeFont(FONT_SANS_9);
-        tft.setCursor(5, startY);
-        tft.print("Enable commands like #");
-        startY += 20; // Move options down to make space for the description
-    }
-
-    // New 3-phase scrolling logic for sub-menus
-    const int SUB_VISIBLE_ITEMS = 3;
-    const int SUB_PIN_ROW = SUB_VISIBLE_ITEMS / 2; // Middle row (index 1 for 3 items)
     int num_options = 0;
-    if (settingsMenuIndex == 0) num_options = NUM_BRIGHTNESS_OPTIONS;
-    else if (settingsMenuIndex == 1) num_options = NUM_STANDBY_OPTIONS;
-    else if (settingsMenuIndex == 3) num_options = NUM_MIRROR_OPTIONS;
-    else if (settingsMenuIndex == 5) num_options = NUM_SMART_TEXT_OPTIONS;
-    else if (settingsMenuIndex == 6) num_options = NUM_CARD_TYPE_OPTIONS;
-
-    // Scrolling logic
-    if (num_options <= SUB_VISIBLE_ITEMS) {
-        // Simple case: The list is short and doesn't need to scroll.
-        subMenuScrollOffset = 0;
-    } else {
-        // Use 3-phase scrolling for lists that are longer than the visible area.
-        if (subMenuIndex < SUB_PIN_ROW) {
-            // Phase 1: Highlight moves down from top
-            subMenuScrollOffset = 0;
-        } else if (subMenuIndex >= (num_options - (SUB_VISIBLE_ITEMS - SUB_PIN_ROW))) {
-            // Phase 3: Highlight moves down at the bottom
-            subMenuScrollOffset = num_options - SUB_VISIBLE_ITEMS;
-        } else {
-            // Phase 2: Highlight is pinned to the middle, list scrolls
-            subMenuScrollOffset = subMenuIndex - SUB_PIN_ROW;
-        }
-    }
-
-    // Draw submenu items with adjusted spacing
-    int lineHeight = 20;
-
-    auto draw_items = [&](const char* items[], int count) {
-        for (int i = subMenuScrollOffset; i < min(count, subMenuScrollOffset + SUB_VISIBLE_ITEMS); i++) {
-            int y = startY + ((i - subMenuScrollOffset) * lineHeight);
-
-            tft.setFreeFont(FONT_SANS_9);
-
-            if (i == subMenuIndex) {
-                tft.setTextColor(TFT_GREEN, TFT_BLACK);
-            } else {
-                tft.setTextColor(TFT_WHITE, TFT_BLACK);
-            }
-            tft.setCursor(10, y);
-            tft.print(items[i]);
-        }
-    };
-
+    const char** options = nullptr;
     if (settingsMenuIndex == 0) { // Brightness
-        draw_items(brightnessOptions, NUM_BRIGHTNESS_OPTIONS);
+        options = brightnessOptions;
+        num_options = NUM_BRIGHTNESS_OPTIONS;
     } else if (settingsMenuIndex == 1) { // Auto Standby
-        draw_items(standbyOptions, NUM_STANDBY_OPTIONS);
+        options = standbyOptions;
+        num_options = NUM_STANDBY_OPTIONS;
+    } else if (settingsMenuIndex == 2) { // Rotate Screen
+        options = rotationOptions;
+        num_options = NUM_ROTATION_OPTIONS;
     } else if (settingsMenuIndex == 3) { // Mirror Screen
-        draw_items(mirrorOptions, NUM_MIRROR_OPTIONS);
+        options = mirrorOptions;
+        num_options = NUM_MIRROR_OPTIONS;
     } else if (settingsMenuIndex == 5) { // Smart Text
-        draw_items(smartTextOptions, NUM_SMART_TEXT_OPTIONS);
+        options = smartTextOptions;
+        num_options = NUM_SMART_TEXT_OPTIONS;
     } else if (settingsMenuIndex == 6) { // Card Type
-        draw_items(cardTypeOptions, NUM_CARD_TYPE_OPTIONS);
+        options = cardTypeOptions;
+        num_options = NUM_CARD_TYPE_OPTIONS;
+    } else if (settingsMenuIndex == 7) { // Transition
+        options = transitionOptions;
+        num_options = NUM_TRANSITION_OPTIONS;
     }
+
+    int visibleItems = layout->subRows;
+    static int optionList = INVALID_WIDGET;
+    bool rebuilt = beginPage(LAYOUT_SUB_MENU + settingsMenuIndex);
+    if (rebuilt) {
+        // Submenu title and navigation hints
+        const char* title = settingsItems[settingsMenuIndex];
+        addPageLabel(layout->margin, layout->subtitleBaseline,
+                     fittingFont(title, FONT_SANS_BOLD_12, FONT_SANS_BOLD_9, layout->width - 2 * layout->margin),
+                     INK_WHITE, title);
+        addPageHint(true, "Sel->");
+        addPageHint(false, "Nxt->");
+
+        // Default start position for options
+        int startY = layout->subListBaseline;
+
+        // Add description for Mirror Screen sub-menu
+        const char* description = nullptr;
+        if (settingsMenuIndex == 3) { // Mirror Screen
+            description = "Mirror received messages";
+        } else if (settingsMenuIndex == 5) { // Smart Text
+            description = "Enable commands like #";
+        }
+        if (description) {
+            // Move options down to make space for the description
+            startY += layout->subLineHeight * addPageText(layout->margin, startY, FONT_SANS_9, INK_WHITE, description,
+                                                          layout->width - 2 * layout->margin, layout->subLineHeight);
+        }
+
+        optionList = INVALID_WIDGET;
+        if (options) {
+            optionList = addPageList(2 * layout->margin, startY, FONT_SANS_9, layout->subLineHeight,
+                                     options, num_options, visibleItems);
+        }
+    }
+
+    subMenuScrollOffset = listScrollOffset(subMenuIndex, num_options, visibleItems);
+    setPageList(optionList, subMenuIndex, subMenuScrollOffset);
+    flushPage(rebuilt);
 }
 
 // ============================================================================
 // BRIGHTNESS OVERLAY
 // ============================================================================
 
-void showBrightnessChange() {
-    // Temporarily show brightness level
+static void drawBrightnessOverlay() {
     String brightnessText = "Brightness: " + String(brightness) + "%" ;
 
-    // Save current content area
     tft.setTextColor(TFT_YELLOW, TFT_BLACK);
     tft.setFreeFont(FONT_SANS_12);
+    if (tft.textWidth(brightnessText.c_str()) > layout->width - 2 * layout->margin) {
+        tft.setFreeFont(FONT_SANS_9);
+    }
     int textWidth = tft.textWidth(brightnessText.c_str());
-    int x = (tft.width() - textWidth) / 2;
-    int y = tft.height() / 2;
+    int x = (layout->width - textWidth) / 2;
+    int y = layout->overlayTop + layout->overlayHeight / 2;
 
     // Draw brightness indicator
-    tft.fillRect(0, y - 25, tft.width(), 50, TFT_BLACK);
+    tft.fillRect(0, layout->overlayTop, layout->width, layout->overlayHeight, TFT_BLACK);
     tft.setCursor(x, y);
     tft.print(brightnessText);
+}
+
+void showBrightnessChange() {
+    // Temporarily show brightness level
+    drawBrightnessOverlay();
 
     showingBrightness = true;
     brightnessChanged = true;
@@ -798,11 +1977,81 @@ void handleBrightnessDisplay() {
             case PAGE_MESSAGES:
                 displayCurrentMessage();
                 break;
-            // Add other cases if brightness can be changed from other pages
             default:
-                // Default action: clear the content area
+                // Menu pages only need what the overlay covered redrawn
+                if (pageLayout != LAYOUT_NONE) {
+                    repaintPageRect(0, layout->overlayTop, layout->width, layout->overlayHeight);
+                    break;
+                }
+                // Otherwise clear the content area
                 clearContentArea();
                 break;
         }
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// PROFILE OVERLAY
+// ============================================================================
+
+// Average and p99 of each stage with samples, top right of the content area in
+// the built-in font. Drawn straight to the panel over whatever is there, and
+// never inside a profiled stage, so it does not add to the times it shows.
+static bool profileOverlayShown = false;
+static unsigned long overlayDrawTime = 0;
+
+static void drawProfileOverlay() {
+    const int charWidth = 6; // built-in font 1
+    const int lineHeight = 8;
+    const int columns = 19;  // "trans 123456 123456"
+    int x = layout->width - columns * charWidth - 2;
+    int y = CONTENT_START_Y;
+
+    StageStats stats[NUM_RENDER_STAGES];
+    bool present[NUM_RENDER_STAGES];
+    int lines = 1;
+    for (int i = 0; i < NUM_RENDER_STAGES; i++) {
+        present[i] = getStageStats((RenderStage)i, stats[i]);
+        if (present[i]) lines++;
+    }
+
+    tft.fillRect(x - 2, y, columns * charWidth + 4, lines * lineHeight, TFT_BLACK);
+    tft.setTextFont(1);
+    tft.setTextSize(1);
+    tft.setTextColor(TFT_DARKGREY, TFT_BLACK);
+    tft.setCursor(x, y);
+    tft.print("us       avg    p99");
+
+    char text[columns + 1];
+    tft.setTextColor(TFT_YELLOW, TFT_BLACK);
+    for (int i = 0; i < NUM_RENDER_STAGES; i++) {
+        if (!present[i]) continue;
+        y += lineHeight;
+        snprintf(text, sizeof(text), "%-5s%7lu%7lu", stageShortName((RenderStage)i),
+                 (unsigned long)min(stats[i].avg, (uint32_t)999999), (unsigned long)min(stats[i].p99, (uint32_t)999999));
+        tft.setCursor(x, y);
+        tft.print(text);
+    }
+
+    overlayDrawTime = millis();
+}
+
+void toggleProfileOverlay() {
+    profileOverlayShown = !profileOverlayShown;
+    Serial.println(profileOverlayShown ? "Profile overlay on" : "Profile overlay off");
+    if (profileOverlayShown) {
+        drawProfileOverlay();
+    } else {
+        redrawCurrentPage();
+    }
+}
+
+void handleProfileOverlay() {
+    if (!profileOverlayShown || isAsleep) return;
+
+    // Only every PROFILE_OVERLAY_INTERVAL, even while scroll frames draw over
+    // it at 30 fps: repainting it after each one would add its own SPI traffic
+    // to the frames being measured
+    if (millis() - overlayDrawTime < PROFILE_OVERLAY_INTERVAL) return;
+    drawProfileOverlay();
+}
@@ -2,13 +2,27 @@
 #define DISPLAY_H
 
 #include "card_suits.h"
+#include "rle_font.h"
 #include "globals.h"
 #include <TFT_eSPI.h>
 #include "globals.h"
 
+// Header parts that can be invalidated individually
+const uint8_t HEADER_STATUS = 0x01;
+const uint8_t HEADER_TITLE = 0x02;
+const uint8_t HEADER_BATTERY = 0x04;
+const uint8_t HEADER_ALL = HEADER_STATUS | HEADER_TITLE | HEADER_BATTERY;
+
+// Pixels per line buffer used when expanding 1bpp/4bpp pixels on their way to
+// the panel. Two of these are kept so expansion overlaps the previous push.
+const int LINE_BUFFER_PIXELS = 1024;
+
 // Function declarations for display-related tasks
 void initializeDisplay();
+void applyScreenRotation();
+void setupHeaderWidgets();
 void updateHeader();
+void invalidateHeader(uint8_t parts);
 void drawConnectionStatus();
 void drawBatteryStatus();
 void clearContentArea();
@@ -18,16 +32,31 @@ void drawMainMenu();
 void drawInfoPage();
 void displayCard(String rank, String suit);
 void drawCardSymbol(String rank, String suitChar);
-void drawSuitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
+void buildSuitSprites();
+bool drawSuitSprite(int16_t x, int16_t y, char suit);
+void drawCardFace(String rank, String suitChar);
+void benchmarkCardFaces();
+void drawRleText(int16_t x, int16_t y, const String& text, const RleFont& font, uint16_t color, uint16_t background);
 void displayCurrentMessage();
+// As displayCurrentMessage(), animating from the message on screen. direction
+// is 1 for Next (the new message comes in from the right) and -1 for Prev.
+void displayMessageWithTransition(int direction);
 void drawMessageContent();
-int calculateWrappedTextHeight(String message, const GFXfont* font, int maxWidth);
 void updateDisplay();
 
 void drawSettingsMenu();
 void drawSubMenu();
 
+// Brackets the handling of a keypress, so the page update it causes can report
+// keypress to pixel latency. pressedMicros is when the press was first seen.
+void beginKeypress(unsigned long pressedMicros);
+void endKeypress();
+
 void showBrightnessChange();
 void handleBrightnessDisplay();
 
+// Render stage timings drawn over the page, toggled by #OVERLAY
+void toggleProfileOverlay();
+void handleProfileOverlay();
+
 #endif // DISPLAY_H
\ No newline at end of file
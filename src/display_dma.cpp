@@ -0,0 +1,144 @@
+#include "display_dma.h"
+
+static bool dmaReady = false;
+
+// Rotation to restore when mirroring ends, -1 while not mirrored
+static int8_t unmirroredRotation = -1;
+
+// ST7789 MADCTL value TFT_eSPI programs for each rotation
+static const uint8_t rotationMadctl[4] = {
+    TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MX | TFT_MAD_MV | TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MX | TFT_MAD_MY | TFT_MAD_COLOR_ORDER,
+    TFT_MAD_MV | TFT_MAD_MY | TFT_MAD_COLOR_ORDER
+};
+
+// Timing for the frame currently being drawn
+static unsigned long frameStartTime = 0;
+static unsigned long frameRenderTime = 0;
+static unsigned long frameWaitTime = 0;
+
+// Totals since the last report
+static uint32_t reportFrames = 0;
+static unsigned long reportTotalTime = 0;
+static unsigned long reportRenderTime = 0;
+static unsigned long reportWaitTime = 0;
+static unsigned long reportMaxTime = 0;
+
+// ============================================================================
+// DMA SETUP
+// ============================================================================
+void initDisplayDMA() {
+#if USE_DISPLAY_DMA
+    dmaReady = tft.initDMA();
+#else
+    dmaReady = false;
+#endif
+    if (dmaReady) {
+        Serial.println("Display DMA enabled");
+    } else {
+        Serial.println("Display DMA disabled - using blocking SPI pushes");
+    }
+}
+
+// ============================================================================
+// BANDED PUSHES
+// ============================================================================
+void beginBandPush() {
+    // DMA transfers need the SPI bus and CS held for the whole sequence
+    tft.startWrite();
+}
+
+void pushBand(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* pixels) {
+    unsigned long waitStart = micros();
+    if (dmaReady) {
+        // Only one transfer can be in flight. Waiting here means the band that was
+        // pushed before this one is done, so its buffer is free to render into again.
+        tft.dmaWait();
+        frameWaitTime += micros() - waitStart;
+        tft.pushImageDMA(x, y, w, h, pixels);
+    } else {
+        tft.pushImage(x, y, w, h, pixels);
+        frameWaitTime += micros() - waitStart;
+    }
+}
+
+void endBandPush() {
+    unsigned long waitStart = micros();
+    if (dmaReady) {
+        tft.dmaWait();
+    }
+    frameWaitTime += micros() - waitStart;
+    tft.endWrite();
+}
+
+// ============================================================================
+// MIRRORED COLUMN ORDER
+// ============================================================================
+void setMirroredColumnOrder(bool mirrored) {
+    if (mirrored == (unmirroredRotation >= 0)) return;
+    uint8_t rotation = mirrored ? (tft.getRotation() & 3) : unmirroredRotation;
+
+    // MX and MY reverse the controller's memory columns and rows, which MV
+    // has already matched up with x and y. In portrait x runs along the memory
+    // columns, so MX mirrors it; in landscape (MV set) x runs along the rows,
+    // so it is MY. There the 240 visible x addresses sit centred in the
+    // controller's 320, so the same addresses still cover them. In portrait
+    // the 135 columns start 52 from one side of 240 and 53 from the other; the
+    // rotation 180 degrees round has the offset for the mirrored side, so its
+    // offsets are borrowed while the panel is mirrored.
+    if (!(rotation & 1)) {
+        tft.setRotation(mirrored ? rotation ^ 2 : rotation);
+    }
+
+    uint8_t madctl = rotationMadctl[rotation];
+    if (mirrored) madctl ^= (rotation & 1) ? TFT_MAD_MY : TFT_MAD_MX;
+    tft.writecommand(TFT_MADCTL);
+    tft.writedata(madctl);
+
+    unmirroredRotation = mirrored ? rotation : -1;
+}
+
+// ============================================================================
+// FRAME TIMING
+// ============================================================================
+void beginFrameTiming() {
+    frameStartTime = micros();
+    frameRenderTime = 0;
+    frameWaitTime = 0;
+}
+
+void markFrameRenderTime(unsigned long renderMicros) {
+    frameRenderTime += renderMicros;
+}
+
+void endFrameTiming(const char* label) {
+    unsigned long frameTime = micros() - frameStartTime;
+
+    reportFrames++;
+    reportTotalTime += frameTime;
+    reportRenderTime += frameRenderTime;
+    reportWaitTime += frameWaitTime;
+    if (frameTime > reportMaxTime) reportMaxTime = frameTime;
+
+    if (reportFrames < FRAME_REPORT_INTERVAL) return;
+
+    Serial.print("Frame timing [");
+    Serial.print(label);
+    Serial.print("]: avg ");
+    Serial.print(reportTotalTime / reportFrames);
+    Serial.print(" us (render ");
+    Serial.print(reportRenderTime / reportFrames);
+    Serial.print(" us, SPI wait ");
+    Serial.print(reportWaitTime / reportFrames);
+    Serial.print(" us), max ");
+    Serial.print(reportMaxTime);
+    Serial.print(" us, ");
+    Serial.println(dmaReady ? "DMA" : "blocking");
+
+    reportFrames = 0;
+    reportTotalTime = 0;
+    reportRenderTime = 0;
+    reportWaitTime = 0;
+    reportMaxTime = 0;
+}
@@ -0,0 +1,28 @@
+#ifndef DISPLAY_DMA_H
+#define DISPLAY_DMA_H
+
+#include "globals.h"
+
+// How many frames to average before printing a frame timing report
+const int FRAME_REPORT_INTERVAL = 64;
+
+// Setup
+void initDisplayDMA();
+
+// Banded pushes. Every pushBand() must happen between beginBandPush() and
+// endBandPush(). The pixel data must stay untouched until the next pushBand()
+// or endBandPush() returns, which is what makes alternating two buffers safe.
+void beginBandPush();
+void pushBand(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* pixels);
+void endBandPush();
+
+// Mirrored output. While enabled the panel fills each window's columns right to
+// left, so a window pushed at x lands at width - x - w with its rows reversed.
+void setMirroredColumnOrder(bool mirrored);
+
+// Frame timing
+void beginFrameTiming();
+void markFrameRenderTime(unsigned long renderMicros);
+void endFrameTiming(const char* label);
+
+#endif // DISPLAY_DMA_H
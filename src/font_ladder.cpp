@@ -0,0 +1,277 @@
+#include "font_ladder.h"
+#include "smooth_font.h"
+#include "render_profile.h"
+#include "DejaVuSans_Bold28ptAscii.h"
+#include "DejaVuSans_Bold36ptAscii.h"
+
+// Message fonts, largest first. Smooth rungs are skipped when their font is
+// not loaded; GFX fallback rungs are skipped when any smooth font is.
+static const LadderFont MESSAGE_FONT_LADDER[] = {
+    { FONT_DEJAVU_BOLD_36, -1, "DejaVu Bold 36", false },
+    { FONT_DEJAVU_BOLD_28, -1, "DejaVu Bold 28", false },
+    { nullptr,              0, "Smooth Bold 24px", false },
+    { nullptr,              1, "Smooth Bold 20px", false },
+    { nullptr,              2, "Smooth Bold 16px", false },
+    { FONT_SANS_BOLD_12,   -1, "Sans Bold 12", true },
+    { FONT_SANS_12,        -1, "Sans 12", true },
+    { FONT_SANS_9,         -1, "Sans 9", true }
+};
+static const int NUM_LADDER_ENTRIES = sizeof(MESSAGE_FONT_LADDER) / sizeof(MESSAGE_FONT_LADDER[0]);
+
+const uint8_t FIRST_CHAR = 0x20;
+const uint8_t LAST_CHAR = 0x7E;
+const int TABLE_SIZE = LAST_CHAR - FIRST_CHAR + 1;
+
+// Cached metrics for one rung. Characters the font lacks are all zero.
+struct LadderMetrics {
+  const LadderFont* spec;
+  int16_t lineHeight;
+  uint8_t advance[TABLE_SIZE];
+  int8_t lastWidth[TABLE_SIZE]; // width when it ends a string (xOffset + width for GFX)
+  int8_t above[TABLE_SIZE];     // rows of ink above the baseline
+  int8_t below[TABLE_SIZE];     // rows of ink below the baseline
+};
+
+static bool ladderInitialized = false;
+static LadderMetrics ladder[MAX_LADDER_FONTS];
+static int ladderSize = 0;
+
+static inline int tableIndex(char c) {
+    uint8_t code = (uint8_t)c;
+    return (code >= FIRST_CHAR && code <= LAST_CHAR) ? code - FIRST_CHAR : -1;
+}
+
+// ============================================================================
+// SETUP
+// ============================================================================
+static void loadGfxMetrics(LadderMetrics& m, const GFXfont* font) {
+    m.lineHeight = font->yAdvance;
+    for (int i = 0; i < TABLE_SIZE; i++) {
+        uint16_t code = FIRST_CHAR + i;
+        if (code < font->first || code > font->last) continue;
+
+        const GFXglyph& glyph = font->glyph[code - font->first];
+        m.advance[i] = glyph.xAdvance;
+        m.lastWidth[i] = glyph.xOffset + glyph.width;
+        if (glyph.width > 0 && glyph.height > 0) {
+            m.above[i] = -glyph.yOffset;
+            m.below[i] = glyph.height + glyph.yOffset;
+        }
+    }
+}
+
+static void loadSmoothMetrics(LadderMetrics& m, int smoothFont) {
+    m.lineHeight = smoothFontLineHeight(smoothFont);
+    for (int i = 0; i < TABLE_SIZE; i++) {
+        int16_t advance, above, below;
+        if (!getSmoothGlyphMetrics(smoothFont, (char)(FIRST_CHAR + i), advance, above, below)) continue;
+
+        // Smooth text is measured by advances alone
+        m.advance[i] = advance;
+        m.lastWidth[i] = advance;
+        m.above[i] = above;
+        m.below[i] = below;
+    }
+}
+
+void initFontLadder() {
+    if (ladderInitialized) return;
+    ladderInitialized = true;
+
+    bool haveSmooth = smoothFontCount() > 0;
+    for (int i = 0; i < NUM_LADDER_ENTRIES && ladderSize < MAX_LADDER_FONTS; i++) {
+        const LadderFont& spec = MESSAGE_FONT_LADDER[i];
+        if (spec.smoothFont >= smoothFontCount()) continue;
+        if (spec.gfxFallback && haveSmooth) continue;
+
+        LadderMetrics& m = ladder[ladderSize++];
+        memset(&m, 0, sizeof(m));
+        m.spec = &spec;
+        if (spec.smoothFont >= 0) {
+            loadSmoothMetrics(m, spec.smoothFont);
+        } else {
+            loadGfxMetrics(m, spec.gfx);
+        }
+    }
+
+    Serial.print("Message font ladder: ");
+    for (int i = 0; i < ladderSize; i++) {
+        if (i > 0) Serial.print(", ");
+        Serial.print(ladder[i].spec->name);
+    }
+    Serial.println();
+}
+
+// ============================================================================
+// METRICS
+// ============================================================================
+int fontLadderSize() {
+    return ladderSize;
+}
+
+const char* ladderFontName(int font) {
+    return ladder[font].spec->name;
+}
+
+const GFXfont* ladderGfxFont(int font) {
+    return ladder[font].spec->gfx;
+}
+
+int ladderSmoothFont(int font) {
+    return ladder[font].spec->smoothFont;
+}
+
+int16_t ladderLineHeight(int font) {
+    return ladder[font].lineHeight;
+}
+
+// Advance sum to pixel width: the final character counts its ink, not its advance
+static inline int32_t lastCharCorrection(const LadderMetrics& m, char last) {
+    int i = tableIndex(last);
+    return (i < 0) ? 0 : m.advance[i] - m.lastWidth[i];
+}
+
+int16_t ladderTextWidth(int font, const char* text, int length) {
+    const LadderMetrics& m = ladder[font];
+    int32_t width = 0;
+    for (int i = 0; i < length; i++) {
+        int index = tableIndex(text[i]);
+        if (index >= 0) width += m.advance[index];
+    }
+    if (length > 0) {
+        width -= lastCharCorrection(m, text[length - 1]);
+    }
+    return width;
+}
+
+int16_t ladderTextWidth(int font, const String& text) {
+    return ladderTextWidth(font, text.c_str(), text.length());
+}
+
+// ============================================================================
+// FIT
+// ============================================================================
+
+// Wrap state of one rung, mirroring the currentLine/word strings of the
+// drawing code's word wrap without building them
+struct WrapState {
+  int32_t lineAdvance;
+  int32_t wordAdvance;
+  int16_t lines;
+  int8_t above;
+  int8_t below;
+  bool lineEmpty;
+  bool overflow; // a word is wider than a line on its own
+  bool active;
+};
+
+static int wrappedHeight(const LadderMetrics& m, const WrapState& s, int lines) {
+    if (lines <= 0) return 0;
+    return (lines - 1) * m.lineHeight + s.above + s.below;
+}
+
+void fitMessageText(const String& message, int maxWidth, int maxHeight, FitResult& result) {
+#if RENDER_TIMING_LOG
+    unsigned long start = micros();
+#endif
+
+    WrapState state[MAX_LADDER_FONTS];
+    for (int f = 0; f < ladderSize; f++) {
+        state[f] = { 0, 0, 0, 0, 0, true, false, true };
+    }
+    const int fallback = ladderSize - 1; // always tracked to the end
+
+    int wordLength = 0;
+    char wordLast = 0;
+    int length = message.length();
+
+    for (int i = 0; i < length; i++) {
+        char c = message[i];
+        bool lastChar = (i == length - 1);
+        bool boundary = (c == ' ' || c == '\n' || lastChar);
+
+        if (!boundary || (lastChar && c != ' ' && c != '\n')) {
+            int index = tableIndex(c);
+            for (int f = 0; f < ladderSize; f++) {
+                if (!state[f].active || index < 0) continue;
+                const LadderMetrics& m = ladder[f];
+                state[f].wordAdvance += m.advance[index];
+                if (m.above[index] > state[f].above) state[f].above = m.above[index];
+                if (m.below[index] > state[f].below) state[f].below = m.below[index];
+            }
+            wordLength++;
+            wordLast = c;
+        }
+        if (!boundary) continue;
+
+        for (int f = 0; f < ladderSize; f++) {
+            WrapState& s = state[f];
+            if (!s.active) continue;
+            const LadderMetrics& m = ladder[f];
+
+            // Width of currentLine + " " + word, or of word alone on an empty line
+            int32_t testAdvance = s.wordAdvance;
+            char testLast = (wordLength > 0) ? wordLast : 0;
+            if (!s.lineEmpty) {
+                testAdvance += s.lineAdvance + m.advance[' ' - FIRST_CHAR];
+                if (wordLength == 0) testLast = ' ';
+            }
+            int32_t testWidth = testAdvance - lastCharCorrection(m, testLast);
+
+            if (testWidth > maxWidth && !s.lineEmpty) {
+                if (wordLength > 0 && s.wordAdvance - lastCharCorrection(m, wordLast) > maxWidth) {
+                    s.overflow = true;
+                }
+                s.lines++;
+                s.lineAdvance = s.wordAdvance;
+                s.lineEmpty = (wordLength == 0);
+            } else {
+                if (testWidth > maxWidth) s.overflow = true;
+                s.lineAdvance = testAdvance;
+                s.lineEmpty = s.lineEmpty && wordLength == 0;
+            }
+            if (c == '\n') {
+                s.lines++;
+                s.lineAdvance = 0;
+                s.lineEmpty = true;
+            }
+            s.wordAdvance = 0;
+
+            // Lines only ever get added, so a rung that overflows is out. So is
+            // one that would have to clip a word.
+            if (f != fallback && (s.overflow || wrappedHeight(m, s, s.lines) > maxHeight)) {
+                s.active = false;
+            }
+        }
+        wordLength = 0;
+    }
+
+    result.font = fallback;
+    for (int f = 0; f < ladderSize; f++) {
+        if (!state[f].active) continue;
+        int lines = state[f].lines + (state[f].lineEmpty ? 0 : 1);
+        int height = wrappedHeight(ladder[f], state[f], lines);
+        if (height <= maxHeight || f == fallback) {
+            result.font = f;
+            result.lines = lines;
+            result.ascent = state[f].above;
+            result.height = height;
+            result.overflow = state[f].overflow;
+            break;
+        }
+    }
+
+#if RENDER_TIMING_LOG
+    Serial.print("Message fit: ");
+    Serial.print(ladderFontName(result.font));
+    Serial.print(", ");
+    Serial.print(result.lines);
+    Serial.print(" lines, ");
+    Serial.print(result.height);
+    Serial.print(" px");
+    if (result.overflow) Serial.print(", clipped");
+    Serial.print(" in ");
+    Serial.print(micros() - start);
+    Serial.println(" us");
+#endif
+}
@@ -0,0 +1,46 @@
+#ifndef FONT_LADDER_H
+#define FONT_LADDER_H
+
+#include "globals.h"
+
+// Message font ladder: the fonts a message may be shown in, largest first.
+// Each rung keeps an advance table for printable ASCII, so measuring text
+// never goes through a sprite.
+
+const int MAX_LADDER_FONTS = 8;
+
+struct LadderFont {
+  const GFXfont* gfx; // nullptr for smooth fonts
+  int smoothFont;     // smooth font id, -1 for GFX fonts
+  const char* name;
+  bool gfxFallback;   // only used when no smooth fonts are loaded
+};
+
+struct FitResult {
+  int font;   // ladder index
+  int lines;
+  int ascent; // rows from the top of the text to the first baseline
+  int height; // height of the wrapped text
+  bool overflow; // some word is wider than maxWidth even in this font
+};
+
+// Setup. Call after initSmoothFonts() so the smooth rungs can be included.
+void initFontLadder();
+
+int fontLadderSize();
+const char* ladderFontName(int font);
+const GFXfont* ladderGfxFont(int font);
+int ladderSmoothFont(int font);
+int16_t ladderLineHeight(int font);
+
+// Same result as TFT_eSPI's textWidth() for GFX fonts
+int16_t ladderTextWidth(int font, const String& text);
+int16_t ladderTextWidth(int font, const char* text, int length);
+
+// Picks the largest font whose wrapped text fits maxHeight without clipping
+// a word, or the smallest if none do. Wraps for every rung at once in a
+// single pass over the message and stops tracking a rung as soon as it
+// overflows.
+void fitMessageText(const String& message, int maxWidth, int maxHeight, FitResult& result);
+
+#endif // FONT_LADDER_H
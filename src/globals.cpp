@@ -0,0 +1,101 @@
+#include "globals.h"
+
+// ============================================================================
+// GLOBAL VARIABLE DEFINITIONS (declared in globals.h)
+// ============================================================================
+
+TFT_eSPI tft = TFT_eSPI();
+BLECharacteristic *pCharacteristic;
+Page currentPage = PAGE_MAIN_MENU;
+String currentScreenName = "BLE Ready";
+
+bool isConnected = false;
+int batteryLevel = -1;
+bool isAsleep = false;
+
+unsigned long lastActivityTime = 0;
+unsigned long SLEEP_TIMEOUT = 900000; // Default: 15 minutes
+
+int mainMenuSelection = 0;
+
+bool inSettingsMenu = false;
+bool inSubMenu = false;
+int settingsMenuIndex = 0;
+int subMenuIndex = 0;
+int settingsScrollOffset = 0;
+int subMenuScrollOffset = 0;
+
+int displayMessageIndex = -1;
+int totalMessages = 0;
+String messageHistory[MAX_MESSAGES];
+
+// Brightness control
+int brightness = 100; // Default brightness (100%)
+
+// Main Menu
+const char* mainMenuItems[] = {"Messages", "Settings", "Info"};
+const int NUM_MAIN_MENU_ITEMS = 3;
+
+// Settings items
+const char* settingsItems[] = {
+  "Brightness",
+  "Auto Standby",
+  "Rotate Screen",
+  "Mirror Screen",
+  "Button Actions",
+  "Smart Text",
+  "Card Type",
+  "Transition",
+  "Exit"
+};
+const int NUM_SETTINGS_ITEMS = 9;
+
+// Brightness options
+const char* brightnessOptions[] = {
+  "10%", "20%", "30%", "40%", "50%", 
+  "60%", "70%", "80%", "90%", "100%"
+};
+const int NUM_BRIGHTNESS_OPTIONS = 10;
+
+// Auto Standby options  
+const char* standbyOptions[] = {
+  "10 Seconds", "30 Seconds", "1 Minute", "5 Minutes", "10 Minutes", "15 Minutes", "20 Minutes",
+  "25 Minutes", "30 Minutes", "45 Minutes", "1 Hour", "2 Hours"
+};
+const int NUM_STANDBY_OPTIONS = 12;
+const unsigned long standbyValues[] = {
+  10000, 30000, 60000, 300000, 600000, 900000, 1200000,
+  1500000, 1800000, 2700000, 3600000, 7200000
+};
+
+// Rotation options, in TFT_eSPI rotation order
+const char* rotationOptions[] = {"Portrait", "Landscape", "Portrait 180", "Landscape 180"};
+const int NUM_ROTATION_OPTIONS = 4;
+uint8_t screenRotation = DEFAULT_ROTATION;
+
+// Mirror options
+const char* mirrorOptions[] = {"Off", "On"};
+const int NUM_MIRROR_OPTIONS = 2;
+bool mirrorMessages = false;
+
+// Smart Text options
+const char* smartTextOptions[] = {"Off", "On"};
+const int NUM_SMART_TEXT_OPTIONS = 2;
+bool smartTextEnabled = false;
+
+// Transition options
+const char* transitionOptions[] = {"Off", "Slide", "Fade"};
+const int NUM_TRANSITION_OPTIONS = 3;
+TransitionStyle messageTransition = TRANSITION_SLIDE;
+
+// Card Type options
+const char* cardTypeOptions[] = {"Words", "Symbols", "Faces"};
+const int NUM_CARD_TYPE_OPTIONS = 3;
+CardDisplayType cardTypeSelection = CARD_TYPE_WORDS;
+
+// Message Scrolling State
+ScrollState messageScroll = {
+  .isLong = false, .marquee = false, .offset = 0, .lastTime = 0, .lastFrame = 0,
+  .state = 0, .totalHeight = 0, .font = 0,
+  .ascent = 0
+};
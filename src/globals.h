@@ -2,6 +2,7 @@
 #define GLOBALS_H
 
 #include <TFT_eSPI.h>
+#include "layout.h"
 
 
 // ============================================================================
@@ -29,12 +30,9 @@
 #define FONT_SANS_BOLD_18 &FreeSansBold18pt7b
 #define FONT_SANS_24 &FreeSans24pt7b
 #define FONT_SANS_BOLD_24 &FreeSansBold24pt7b
-#define FONT_DEJAVU_BOLD_28 &DejaVuSans_Bold28pt7b
-#define FONT_DEJAVU_BOLD_36 &DejaVuSans_Bold36pt7b
-
-// Dimensions
-const int HEADER_HEIGHT = 28;
-const int CONTENT_START_Y = 32;
+#define FONT_DEJAVU_BOLD_28 &DejaVuSans_Bold28ptAscii
+#define FONT_DEJAVU_BOLD_36 &DejaVuSans_Bold36ptAscii
+#define FONT_CARD_RANK &DejaVuSans_Bold36ptRanks // RleFont with A, 0-9, J, Q, K only
 
 // Message history
 const int MAX_MESSAGES = 20;
@@ -52,12 +50,14 @@ const int MAX_BRIGHTNESS = 100;
 const int BRIGHTNESS_STEP = 10;
 
 // EEPROM addresses
-const int EEPROM_SIZE = 5;
+const int EEPROM_SIZE = 7;
 const int BRIGHTNESS_ADDR = 0;
 const int STANDBY_ADDR = 1;
 const int MIRROR_ADDR = 2;
 const int SMART_TEXT_ADDR = 3;
 const int CARD_TYPE_ADDR = 4;
+const int ROTATION_ADDR = 5;
+const int TRANSITION_ADDR = 6;
 
 // ============================================================================
 // ENUMS & STRUCTS
@@ -70,13 +70,20 @@ enum Page {
   PAGE_SETTINGS
 };
 
+enum TransitionStyle {
+  TRANSITION_OFF,
+  TRANSITION_SLIDE,
+  TRANSITION_FADE
+};
+
 enum CardDisplayType {
   CARD_TYPE_WORDS,
-  CARD_TYPE_SYMBOLS
+  CARD_TYPE_SYMBOLS,
+  CARD_TYPE_FACES
 };
 
 // ============================================================================
-// GLOBAL VARIABLES (declared here, defined in main.cpp)
+// GLOBAL VARIABLES (declared here, defined in globals.cpp)
 // ============================================================================
 
 // Hardware objects
@@ -127,6 +134,11 @@ extern const char* standbyOptions[];
 extern const int NUM_STANDBY_OPTIONS;
 extern const unsigned long standbyValues[];
 
+// Rotation Setting
+extern uint8_t screenRotation;
+extern const char* rotationOptions[];
+extern const int NUM_ROTATION_OPTIONS;
+
 // Mirror Setting
 extern bool mirrorMessages;
 extern const char* mirrorOptions[];
@@ -137,6 +149,11 @@ extern bool smartTextEnabled;
 extern const char* smartTextOptions[];
 extern const int NUM_SMART_TEXT_OPTIONS;
 
+// Transition Setting
+extern TransitionStyle messageTransition;
+extern const char* transitionOptions[];
+extern const int NUM_TRANSITION_OPTIONS;
+
 // Card Type Setting
 extern CardDisplayType cardTypeSelection;
 extern const char* cardTypeOptions[];
@@ -144,18 +161,36 @@ extern const int NUM_CARD_TYPE_OPTIONS;
 
 // Card Display
 extern bool expectingCardCode;
+extern bool expectingMarquee;
 
-const unsigned long SCROLL_DELAY = 50; // ms per pixel scroll
+const int SCROLL_SPEED = 40; // px per second once up to speed
+const int SCROLL_FPS = 30; // target scroll frame rate
+const unsigned long SCROLL_FRAME_INTERVAL = 1000 / SCROLL_FPS; // ms
+const unsigned long SCROLL_EASE = 400; // ms to ramp speed up or down at each end
 const unsigned long SCROLL_PAUSE = 2000; // ms to pause at top/bottom
 
+// Next/Prev animate from the old message to the new one in the message window
+const unsigned long TRANSITION_TIME = 240; // ms
+const int TRANSITION_FPS = 30;
+const unsigned long TRANSITION_FRAME_INTERVAL = 1000 / TRANSITION_FPS; // ms
+
+// Marquee: one line scrolled sideways, drawn once into a strip of this many
+// bytes at most and repeated with a gap
+const int MARQUEE_SPEED = 60; // px per second
+const int MARQUEE_GAP = 48; // px between the end of the text and its repeat
+const int32_t MARQUEE_STRIP_BYTES = 24576;
+
 // Message Scrolling
 struct ScrollState {
   bool isLong;
+  bool marquee; // scrolls sideways; offset is then the strip column at the left edge
   int offset;
-  unsigned long lastTime;
+  unsigned long lastTime;  // start of the current state
+  unsigned long lastFrame; // when the last scroll frame was due
   int state; // 0 = paused at top, 1 = scrolling down, 2 = paused at bottom
   int totalHeight;
-  const GFXfont* font;
+  int font;   // index into the message font ladder
+  int ascent; // rows from the top of the text to the first baseline
 };
 
 extern ScrollState messageScroll;
@@ -0,0 +1,226 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include <stdint.h>
+
+// Screen layout for each rotation, worked out at compile time from the panel's
+// native portrait size (TFT_WIDTH x TFT_HEIGHT from platformio.ini). Positions
+// first tuned by eye on the 240x135 landscape screen are kept relative to the
+// edge they belong to, and the number of list rows follows from the space left
+// between the first row and the bottom hint. Portrait screens are too narrow
+// for the button 2 hint to share a row with the menus, so there both hints go
+// on the bottom row and the lists stop above it.
+
+// Set by the header fonts, not the panel
+const int HEADER_HEIGHT = 28;
+const int CONTENT_START_Y = HEADER_HEIGHT + 4;
+
+// Header widths: the connection square on the left, the battery on the right
+// and the screen name between them
+const int HEADER_STATUS_WIDTH = 5 + 12 + 3;
+const int HEADER_BATTERY_ICON_WIDTH = 30; // icon only
+const int HEADER_BATTERY_TEXT_WIDTH = 60; // icon with "100%" beside it
+const int HEADER_TITLE_MIN_WIDTH = 72;    // "Settings" in FreeSansBold9pt7b
+
+// Rows above and below the baseline taken by the tallest glyphs of the page
+// fonts, rounded up. The layouts below are checked against them.
+const int SMALL_TEXT_ASCENT = 13; // FreeSans9pt7b: hints, settings and info
+const int SMALL_TEXT_DESCENT = 4;
+const int LARGE_TEXT_ASCENT = 18; // FreeSans12pt7b and FreeSansBold12pt7b
+const int LARGE_TEXT_DESCENT = 6;
+
+// Rotation used until another one is chosen
+const uint8_t DEFAULT_ROTATION = 1;
+
+// Most rows a menu list can show: one bit each in its dirty-row mask
+const int MAX_LIST_ROWS = 32;
+
+// Card symbol geometry, set by the rank font and suit bitmaps
+const int CARD_RANK_BASELINE = 58; // rows from the top of the rank box to its baseline
+const int CARD_SUIT_RAISE = 8;     // suit sits this much above centre
+const int CARD_SPACING = 8;        // gap between rank and suit
+
+struct ScreenLayout {
+  int16_t width;
+  int16_t height;
+
+  // Header
+  int16_t headerTitleWidth;
+  int16_t headerBatteryWidth; // HEADER_BATTERY_TEXT_WIDTH shows the percentage
+
+  // Page furniture
+  int16_t margin;             // text inset from the left and right edges
+  int16_t hintTopBaseline;    // button 2 hint
+  bool hintTopLeft;           // button 2 hint at the left of the bottom row, not top right
+  int16_t hintBottomBaseline; // button 1 hint, bottom right
+  int16_t listBottom;         // lowest baseline for a list row or line of info
+  int16_t subtitleBaseline;   // "BLE Ready!" and sub-menu titles
+  int16_t overlayTop;         // brightness overlay band
+  int16_t overlayHeight;
+
+  // Menus
+  int16_t mainListBaseline;
+  int16_t mainLineHeight;
+  int16_t settingsListBaseline;
+  int16_t settingsLineHeight;
+  int16_t settingsRows;
+  int16_t subListBaseline;    // moves down one line when there is a description
+  int16_t subLineHeight;
+  int16_t subRows;
+  int16_t infoBaseline;
+  int16_t infoLineHeight;
+
+  // Messages
+  int16_t messageHintBaseline;   // "Msg n/m" and the top button hint
+  int16_t messageFooterBaseline; // the bottom button hint
+  int16_t messageHoldBaseline;   // "Hold Bttn", on the footer row when it fits
+  int16_t messageTop;            // message text window
+  int16_t messageHeight;
+
+  // Cards
+  int16_t cardTop;               // space a card face may take
+  int16_t cardBottom;
+};
+
+// Screen size in a rotation: odd rotations are landscape
+constexpr int16_t rotatedWidth(uint8_t rotation) {
+    return (rotation & 1) ? TFT_HEIGHT : TFT_WIDTH;
+}
+
+constexpr int16_t rotatedHeight(uint8_t rotation) {
+    return (rotation & 1) ? TFT_WIDTH : TFT_HEIGHT;
+}
+
+constexpr bool isPortrait(uint8_t rotation) {
+    return rotatedWidth(rotation) < rotatedHeight(rotation);
+}
+
+// Bottom hint row. In landscape list rows may reach its baseline, since the
+// hints sit at its right end; in portrait they stop above it.
+constexpr int16_t hintRowBaseline(uint8_t rotation) {
+    return rotatedHeight(rotation) - 10;
+}
+
+constexpr int16_t lowestListBaseline(uint8_t rotation) {
+    return isPortrait(rotation)
+        ? hintRowBaseline(rotation) - SMALL_TEXT_ASCENT - SMALL_TEXT_DESCENT - 2
+        : hintRowBaseline(rotation);
+}
+
+// Rows of a list whose first baseline is `first` that fit above the bottom hint
+constexpr int16_t listRows(uint8_t rotation, int16_t first, int16_t lineHeight) {
+    return (lowestListBaseline(rotation) - first) / lineHeight + 1;
+}
+
+// "Hold Bttn: Main" and "Next->" only fit side by side in landscape
+constexpr int16_t holdBaseline(uint8_t rotation) {
+    return isPortrait(rotation) ? rotatedHeight(rotation) - 6 - 18 : rotatedHeight(rotation) - 6;
+}
+
+constexpr int16_t batteryWidth(uint8_t rotation) {
+    return isPortrait(rotation) ? HEADER_BATTERY_ICON_WIDTH : HEADER_BATTERY_TEXT_WIDTH;
+}
+
+constexpr ScreenLayout makeLayout(uint8_t rotation) {
+    return {
+        rotatedWidth(rotation),
+        rotatedHeight(rotation),
+
+        (int16_t)(rotatedWidth(rotation) - HEADER_STATUS_WIDTH - batteryWidth(rotation)),
+        batteryWidth(rotation),
+
+        5,
+        isPortrait(rotation) ? hintRowBaseline(rotation) : (int16_t)(HEADER_HEIGHT + 25),
+        isPortrait(rotation),
+        hintRowBaseline(rotation),
+        lowestListBaseline(rotation),
+        HEADER_HEIGHT + 25,
+        (int16_t)(rotatedHeight(rotation) / 2 - 25),
+        50,
+
+        HEADER_HEIGHT + 50,
+        22,
+        CONTENT_START_Y + 15,
+        18,
+        listRows(rotation, CONTENT_START_Y + 15, 18),
+        HEADER_HEIGHT + 50,
+        20,
+        listRows(rotation, HEADER_HEIGHT + 50, 20),
+        CONTENT_START_Y + 20,
+        18,
+
+        HEADER_HEIGHT + 16,
+        (int16_t)(rotatedHeight(rotation) - 6),
+        holdBaseline(rotation),
+        HEADER_HEIGHT + 16 + 8,
+        (int16_t)(holdBaseline(rotation) - 14 - (HEADER_HEIGHT + 16 + 8)),
+
+        HEADER_HEIGHT + 3,
+        isPortrait(rotation) ? (int16_t)(hintRowBaseline(rotation) - 16) : (int16_t)(rotatedHeight(rotation) - 3)
+    };
+}
+
+// Header parts add up to the screen width, with room for the longest title in
+// the small header font
+constexpr bool headerFits(const ScreenLayout& l) {
+    return HEADER_STATUS_WIDTH + l.headerTitleWidth + l.headerBatteryWidth == l.width &&
+           l.headerTitleWidth >= HEADER_TITLE_MIN_WIDTH;
+}
+
+// Everything on a page starts below the header line
+constexpr bool clearOfHeader(const ScreenLayout& l) {
+    return l.subtitleBaseline - LARGE_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.mainListBaseline - LARGE_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.settingsListBaseline - SMALL_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.subListBaseline - SMALL_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.infoBaseline - SMALL_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.hintTopBaseline - SMALL_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.messageHintBaseline - SMALL_TEXT_ASCENT > HEADER_HEIGHT &&
+           l.messageTop > HEADER_HEIGHT && l.cardTop > HEADER_HEIGHT;
+}
+
+// Lists, the message window and the card end above the bottom row, or share
+// it with the hints at its right end in landscape; the message footer fits on
+// the screen below the window
+constexpr bool clearOfFooter(const ScreenLayout& l) {
+    return l.settingsListBaseline + (l.settingsRows - 1) * l.settingsLineHeight <= l.listBottom &&
+           l.subListBaseline + (l.subRows - 1) * l.subLineHeight <= l.listBottom &&
+           l.mainListBaseline + 2 * l.mainLineHeight <= l.listBottom &&
+           l.infoBaseline + 3 * l.infoLineHeight <= l.listBottom &&
+           (!l.hintTopLeft || (l.listBottom + SMALL_TEXT_DESCENT < l.hintBottomBaseline - SMALL_TEXT_ASCENT &&
+                               l.cardBottom <= l.hintBottomBaseline - SMALL_TEXT_ASCENT)) &&
+           l.messageTop + l.messageHeight <= l.messageHoldBaseline - SMALL_TEXT_ASCENT &&
+           (l.messageHoldBaseline == l.messageFooterBaseline ||
+            l.messageHoldBaseline + SMALL_TEXT_DESCENT < l.messageFooterBaseline - SMALL_TEXT_ASCENT) &&
+           l.messageFooterBaseline + SMALL_TEXT_DESCENT <= l.height &&
+           l.cardBottom <= l.height;
+}
+
+constexpr ScreenLayout SCREEN_LAYOUTS[4] = {
+    makeLayout(0), makeLayout(1), makeLayout(2), makeLayout(3)
+};
+
+// Every rotation needs room for a line of message text and a menu row
+static_assert(SCREEN_LAYOUTS[0].messageHeight >= 24 && SCREEN_LAYOUTS[1].messageHeight >= 24,
+              "Panel too short for the message window");
+static_assert(SCREEN_LAYOUTS[0].settingsRows >= 1 && SCREEN_LAYOUTS[1].settingsRows >= 1 &&
+              SCREEN_LAYOUTS[0].subRows >= 1 && SCREEN_LAYOUTS[1].subRows >= 1,
+              "Panel too short for the menus");
+static_assert(SCREEN_LAYOUTS[0].settingsRows <= MAX_LIST_ROWS && SCREEN_LAYOUTS[1].settingsRows <= MAX_LIST_ROWS &&
+              SCREEN_LAYOUTS[0].subRows <= MAX_LIST_ROWS && SCREEN_LAYOUTS[1].subRows <= MAX_LIST_ROWS,
+              "Panel too tall for the menu lists' dirty-row masks");
+static_assert(headerFits(SCREEN_LAYOUTS[0]) && headerFits(SCREEN_LAYOUTS[1]),
+              "Header parts do not fit across the screen");
+static_assert(clearOfHeader(SCREEN_LAYOUTS[0]) && clearOfHeader(SCREEN_LAYOUTS[1]),
+              "Page content overlaps the header");
+static_assert(clearOfFooter(SCREEN_LAYOUTS[0]) && clearOfFooter(SCREEN_LAYOUTS[1]),
+              "Page content overlaps the bottom hint row");
+
+#if TFT_WIDTH == 135 && TFT_HEIGHT == 240
+// The layout the screens were designed on
+static_assert(SCREEN_LAYOUTS[1].messageTop == 52 && SCREEN_LAYOUTS[1].messageHeight == 63 &&
+              SCREEN_LAYOUTS[1].settingsRows == 5 && SCREEN_LAYOUTS[1].subRows == 3,
+              "240x135 layout changed");
+#endif
+
+#endif // LAYOUT_H
@@ -9,109 +9,26 @@
 #include "ble_handler.h"
 #include "power_management.h"
 #include "settings.h"
+#include "compositor.h"
+#include "render_task.h"
 
 // ============================================================================
-// GLOBAL VARIABLE DEFINITIONS (declared in globals.h)
+// MAIN LOOP STATE (the shared globals are defined in globals.cpp)
 // ============================================================================
 
-TFT_eSPI tft = TFT_eSPI();
-BLECharacteristic *pCharacteristic;
-Page currentPage = PAGE_MAIN_MENU;
-String currentScreenName = "BLE Ready";
-
-bool isConnected = false;
-int batteryLevel = -1;
-bool isAsleep = false;
-
-unsigned long lastActivityTime = 0;
-unsigned long SLEEP_TIMEOUT = 900000; // Default: 15 minutes
-
-int mainMenuSelection = 0;
-
-bool inSettingsMenu = false;
-bool inSubMenu = false;
-int settingsMenuIndex = 0;
-int subMenuIndex = 0;
-int settingsScrollOffset = 0;
-int subMenuScrollOffset = 0;
-
-int displayMessageIndex = -1;
-int totalMessages = 0;
-
 // Message buffering
 String messageBuffer = "";
 unsigned long lastDataTime = 0;
 unsigned long lastMessageReceivedTime = 0;
-String messageHistory[MAX_MESSAGES];
 
 // Connection and battery status
 unsigned long lastBatteryCheck = 0;
 
-// Brightness control
-int brightness = 100; // Default brightness (100%)
-
-// Main Menu
-const char* mainMenuItems[] = {"Messages", "Settings", "Info"};
-const int NUM_MAIN_MENU_ITEMS = 3;
-
 // Visible items calculation
 const int MAIN_MENU_VISIBLE_ITEMS = 5;    // Increased from 4 to 5
 const int SUB_MENU_VISIBLE_ITEMS = 3;     // Start scrolling after 3rd item
 const int INFO_MENU_VISIBLE_ITEMS = 3;    // For the main info screen
 
-// Settings items
-const char* settingsItems[] = {
-  "Brightness",
-  "Auto Standby",
-  "Rotate Screen",
-  "Mirror Screen",
-  "Button Actions",
-  "Smart Text",
-  "Card Type",
-  "Exit"
-};
-const int NUM_SETTINGS_ITEMS = 8;
-
-// Brightness options
-const char* brightnessOptions[] = {
-  "10%", "20%", "30%", "40%", "50%", 
-  "60%", "70%", "80%", "90%", "100%"
-};
-const int NUM_BRIGHTNESS_OPTIONS = 10;
-
-// Auto Standby options  
-const char* standbyOptions[] = {
-  "10 Seconds", "30 Seconds", "1 Minute", "5 Minutes", "10 Minutes", "15 Minutes", "20 Minutes",
-  "25 Minutes", "30 Minutes", "45 Minutes", "1 Hour", "2 Hours"
-};
-const int NUM_STANDBY_OPTIONS = 12;
-const unsigned long standbyValues[] = {
-  10000, 30000, 60000, 300000, 600000, 900000, 1200000,
-  1500000, 1800000, 2700000, 3600000, 7200000
-};
-
-// Mirror options
-const char* mirrorOptions[] = {"Off", "On"};
-const int NUM_MIRROR_OPTIONS = 2;
-bool mirrorMessages = false;
-
-// Smart Text options
-const char* smartTextOptions[] = {"Off", "On"};
-const int NUM_SMART_TEXT_OPTIONS = 2;
-bool smartTextEnabled = false;
-
-// Card Type options
-const char* cardTypeOptions[] = {"Words", "Symbols"};
-const int NUM_CARD_TYPE_OPTIONS = 2;
-CardDisplayType cardTypeSelection = CARD_TYPE_WORDS;
-
-// Message Scrolling State
-ScrollState messageScroll = {
-  .isLong = false, .offset = 0, .lastTime = 0, 
-  .state = 0, .totalHeight = 0, .font = FONT_SANS_9
-};
-
-
 // ============================================================================ 
 void clearAllMessages() {
     Serial.println(">>> CLEARING ALL MESSAGES");
@@ -123,10 +40,10 @@ void clearAllMessages() {
     
     // Clear entire screen and redraw header
     tft.fillScreen(TFT_BLACK);
-    tft.setRotation(1);
     
-    // Update header first
-    setScreenName("Cleared");
+    // The whole screen was wiped, so repaint the full header first
+    currentScreenName = "Cleared";
+    updateHeader();
     
     // Then display content starting well below header
     tft.setTextColor(TFT_WHITE, TFT_BLACK);
@@ -166,9 +83,11 @@ void setup() {
     // Load settings from EEPROM
     loadBrightness();
     loadStandbySetting();
+    loadRotationSetting();
     loadMirrorSetting();
     loadSmartTextSetting();
     loadCardTypeSetting();
+    loadTransitionSetting();
 
     // Initialize display
     initializeDisplay();
@@ -181,12 +100,15 @@ void setup() {
     tft.setFreeFont(FONT_SANS_12);
     tft.setCursor(0, CONTENT_START_Y + 20);
     tft.println("Starting BLE...");
+
+    // From here on only the render task draws. It has to be running before
+    // BLE, whose callbacks post to it.
+    startRenderTask();
     
     // Initialize BLE
     setupBLE();
 
-    currentPage = PAGE_MAIN_MENU;
-    drawMainMenu();
+    postRenderCommand(RENDER_MAIN_MENU);
     
     // Initialize activity timer
     lastActivityTime = millis();
@@ -196,37 +118,23 @@ void setup() {
 }
 
 // ============================================================================ 
-// LOOP - Check for timeout to process final message
+// LOOP - Buttons, battery, received data and sleep; runs on ARDUINO_RUNNING_CORE
 // ============================================================================ 
 void loop() {
+    // Input and ingest only; all drawing happens on the render task
     handleButtons();
-    updateDisplay();
-    handleBrightnessDisplay();
     
     // Check battery level periodically
     if (millis() - lastBatteryCheck > BATTERY_CHECK_INTERVAL) {
         int newBatteryLevel = readBatteryLevel();
         if (newBatteryLevel != batteryLevel) {
-            batteryLevel = newBatteryLevel;
-            updateHeader();
+            postRenderCommand(RENDER_BATTERY, newBatteryLevel);
         }
         lastBatteryCheck = millis();
     }
     
     // Centralized message processing logic
-    if (messageBuffer.length() > 0) {
-        int newlinePos;
-        // Process all complete messages ending in a newline
-        while ((newlinePos = messageBuffer.indexOf('\n')) >= 0) {
-            addMessageToHistory(messageBuffer.substring(0, newlinePos));
-            messageBuffer = messageBuffer.substring(newlinePos + 1);
-        }
-        // If there's a remaining fragment and a timeout occurs, process it
-        if (messageBuffer.length() > 0 && (millis() - lastDataTime) > MESSAGE_TIMEOUT) {
-            addMessageToHistory(messageBuffer);
-            messageBuffer = "";
-        }
-    }
+    processReceivedData();
 
     // Check if we should enter deep sleep
     checkSleep();
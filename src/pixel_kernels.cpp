@@ -0,0 +1,171 @@
+#include "pixel_kernels.h"
+#include <string.h>
+
+// 32-bit view of pixel buffers. may_alias keeps the compiler from reordering
+// these accesses against plain uint16_t ones.
+typedef uint32_t __attribute__((__may_alias__)) word32;
+
+static inline bool isWordAligned(const void* ptr) {
+    return ((uintptr_t)ptr & 3) == 0;
+}
+
+// ============================================================================
+// 1BPP EXPANSION
+// ============================================================================
+void buildMonoExpandLut(MonoExpandLut& lut, uint16_t foreground, uint16_t background) {
+    for (int nibble = 0; nibble < 16; nibble++) {
+        uint16_t pixels[4];
+        for (int i = 0; i < 4; i++) {
+            pixels[i] = (nibble & (0x08 >> i)) ? foreground : background;
+        }
+        // Copy in memory order so the words come out right on either endianness
+        memcpy(lut.words[nibble], pixels, sizeof(pixels));
+    }
+    lut.foreground = foreground;
+    lut.background = background;
+}
+
+void expandMonoRow(uint16_t* dst, const uint8_t* src, int32_t bitOffset, int32_t w, const MonoExpandLut& lut) {
+    src += bitOffset >> 3;
+    int bit = bitOffset & 7;
+
+    // Leading pixels up to the next source byte boundary
+    while (w > 0 && bit != 0) {
+        *dst++ = (*src & (0x80 >> bit)) ? lut.foreground : lut.background;
+        w--;
+        if (++bit == 8) {
+            bit = 0;
+            src++;
+        }
+    }
+
+    // Whole bytes, eight pixels at a time
+    if (isWordAligned(dst)) {
+        while (w >= 8) {
+            uint8_t bits = *src++;
+            const uint32_t* high = lut.words[bits >> 4];
+            const uint32_t* low = lut.words[bits & 0x0F];
+            word32* out = (word32*)dst;
+            out[0] = high[0];
+            out[1] = high[1];
+            out[2] = low[0];
+            out[3] = low[1];
+            dst += 8;
+            w -= 8;
+        }
+    } else {
+        while (w >= 8) {
+            uint8_t bits = *src++;
+            memcpy(dst, lut.words[bits >> 4], 8);
+            memcpy(dst + 4, lut.words[bits & 0x0F], 8);
+            dst += 8;
+            w -= 8;
+        }
+    }
+
+    // Trailing pixels from the last partial byte
+    if (w > 0) {
+        uint8_t bits = *src;
+        for (int i = 0; i < w; i++) {
+            dst[i] = (bits & (0x80 >> i)) ? lut.foreground : lut.background;
+        }
+    }
+}
+
+// ============================================================================
+// 4BPP PALETTE EXPANSION
+// ============================================================================
+void buildPaletteExpandLut(PaletteExpandLut& lut, const uint16_t* palette, int colorCount) {
+    for (int i = 0; i < 16; i++) {
+        lut.colors[i] = (i < colorCount) ? palette[i] : 0;
+    }
+    for (int byte = 0; byte < 256; byte++) {
+        uint16_t pixels[2] = { lut.colors[byte >> 4], lut.colors[byte & 0x0F] };
+        memcpy(&lut.pairs[byte], pixels, sizeof(pixels));
+    }
+}
+
+void expandPaletteRow(uint16_t* dst, const uint8_t* src, int32_t w, const PaletteExpandLut& lut) {
+    if (isWordAligned(dst)) {
+        // One table load and one store per source byte
+        word32* out = (word32*)dst;
+        while (w >= 8) {
+            out[0] = lut.pairs[src[0]];
+            out[1] = lut.pairs[src[1]];
+            out[2] = lut.pairs[src[2]];
+            out[3] = lut.pairs[src[3]];
+            out += 4;
+            src += 4;
+            w -= 8;
+        }
+        while (w >= 2) {
+            *out++ = lut.pairs[*src++];
+            w -= 2;
+        }
+        dst = (uint16_t*)out;
+    } else {
+        while (w >= 2) {
+            memcpy(dst, &lut.pairs[*src++], 4);
+            dst += 2;
+            w -= 2;
+        }
+    }
+
+    // Odd width: the last pixel is the high nibble of the final byte
+    if (w > 0) {
+        *dst = lut.colors[*src >> 4];
+    }
+}
+
+// ============================================================================
+// SPAN FILL & BYTE SWAP
+// ============================================================================
+void fillSpan565(uint16_t* dst, uint16_t color, int32_t count) {
+    if (count > 0 && !isWordAligned(dst)) {
+        *dst++ = color;
+        count--;
+    }
+
+    uint32_t pair = ((uint32_t)color << 16) | color;
+    word32* out = (word32*)dst;
+    while (count >= 8) {
+        out[0] = pair;
+        out[1] = pair;
+        out[2] = pair;
+        out[3] = pair;
+        out += 4;
+        count -= 8;
+    }
+    while (count >= 2) {
+        *out++ = pair;
+        count -= 2;
+    }
+
+    if (count > 0) {
+        *(uint16_t*)out = color;
+    }
+}
+
+void swapBytes565(uint16_t* dst, const uint16_t* src, int32_t count) {
+    if (count > 0 && !isWordAligned(dst)) {
+        *dst++ = swap565(*src++);
+        count--;
+    }
+
+    // Word path needs both pointers aligned, which holds when they started with
+    // the same alignment (including the in-place case)
+    if (isWordAligned(src)) {
+        while (count >= 2) {
+            uint32_t pair = *(const word32*)src;
+            *(word32*)dst = ((pair & 0x00FF00FF) << 8) | ((pair >> 8) & 0x00FF00FF);
+            src += 2;
+            dst += 2;
+            count -= 2;
+        }
+    }
+
+    while (count > 0) {
+        *dst++ = swap565(*src++);
+        count--;
+    }
+}
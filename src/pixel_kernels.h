@@ -0,0 +1,49 @@
+#ifndef PIXEL_KERNELS_H
+#define PIXEL_KERNELS_H
+
+#include <stdint.h>
+
+// Small RGB565 pixel kernels that work on 32 bits (two pixels) at a time.
+// They only depend on <stdint.h> so they build the same on the ESP32 and on a
+// desktop compiler. Colours are stored exactly as given; pass colours through
+// swap565() first when the buffer is going straight to the panel.
+
+// Lookup table for expanding 1bpp data. Each entry holds the four RGB565
+// pixels for one nibble, packed as two 32-bit words in memory order.
+struct MonoExpandLut {
+  uint32_t words[16][2];
+  uint16_t foreground;
+  uint16_t background;
+};
+
+// Lookup table for expanding 4bpp palette data. Each entry holds the two
+// RGB565 pixels for one source byte (high nibble first) as one 32-bit word.
+struct PaletteExpandLut {
+  uint32_t pairs[256];
+  uint16_t colors[16];
+};
+
+// Byte-swaps a single RGB565 colour (for the panel's big-endian byte order)
+inline uint16_t swap565(uint16_t color) {
+  return (uint16_t)((color >> 8) | (color << 8));
+}
+
+// Builds the nibble table for the given colours
+void buildMonoExpandLut(MonoExpandLut& lut, uint16_t foreground, uint16_t background);
+
+// Expands w pixels of MSB-first 1bpp data, starting bitOffset bits into src
+void expandMonoRow(uint16_t* dst, const uint8_t* src, int32_t bitOffset, int32_t w, const MonoExpandLut& lut);
+
+// Builds the byte table for a palette of up to 16 colours
+void buildPaletteExpandLut(PaletteExpandLut& lut, const uint16_t* palette, int colorCount);
+
+// Expands w pixels of 4bpp data (high nibble first) starting at pixel 0 of src
+void expandPaletteRow(uint16_t* dst, const uint8_t* src, int32_t w, const PaletteExpandLut& lut);
+
+// Fills count pixels with color
+void fillSpan565(uint16_t* dst, uint16_t color, int32_t count);
+
+// Byte-swaps count pixels from src into dst. dst may equal src.
+void swapBytes565(uint16_t* dst, const uint16_t* src, int32_t count);
+
+#endif // PIXEL_KERNELS_H
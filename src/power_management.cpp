@@ -2,19 +2,39 @@
 #include "settings.h"
 #include "display.h"
 #include "ble_handler.h"
+#include "render_task.h"
+#include "backlight.h"
 
 // ============================================================================
 // SLEEP FUNCTIONS
 // ============================================================================
+static bool backlightDimmed = false;
+
 void checkSleep() {
-    if (!isAsleep && (millis() - lastActivityTime) > SLEEP_TIMEOUT) {
+    // Other tasks update lastActivityTime, so read it before the time it is
+    // compared against
+    unsigned long lastActivity = lastActivityTime;
+    unsigned long idle = millis() - lastActivity;
+
+    if (!isAsleep && idle > SLEEP_TIMEOUT) {
         Serial.println(">>> ENTERING DEEP SLEEP - INACTIVITY");
         enterDeepSleep();
     }
+
+    // Dim a little before sleeping, and come back up on any activity
+    unsigned long dimAfter = SLEEP_TIMEOUT - min(DIM_BEFORE_SLEEP, SLEEP_TIMEOUT / 2);
+    if (!backlightDimmed && idle > dimAfter) {
+        Serial.println(">>> DIMMING BACKLIGHT BEFORE SLEEP");
+        backlightDimmed = true;
+        fadeBacklight(min(brightness, BACKLIGHT_DIM_LEVEL), BACKLIGHT_DIM_FADE_TIME);
+    } else if (backlightDimmed && idle <= dimAfter) {
+        backlightDimmed = false;
+        fadeBacklight(brightness, BACKLIGHT_FADE_TIME);
+    }
 }
 
 void enterDeepSleep() {
-    digitalWrite(4, LOW); // Turn off backlight
+    backlightOffForSleep();
     BLEDevice::deinit(true);
     
     Serial.println("Entering deep sleep... Press any button to wake");
@@ -32,10 +52,12 @@ void wakeFromSleep() {
 
     loadBrightness();
     loadStandbySetting();
+    loadRotationSetting();
     loadMirrorSetting();
+    loadTransitionSetting();
     
     initializeDisplay();
-    setupBLE();
+    updateHeader();
 
     pinMode(BUTTON_1, INPUT_PULLUP);
     pinMode(BUTTON_2, INPUT_PULLUP);
@@ -45,6 +67,10 @@ void wakeFromSleep() {
     
     currentPage = PAGE_MAIN_MENU;
     drawMainMenu();
+
+    // Drawing belongs to the render task from here on, see setup()
+    startRenderTask();
+    setupBLE();
     
     Serial.println("Woke from deep sleep - Ready for messages...");
 }
@@ -0,0 +1,104 @@
+#include "render_profile.h"
+#include <algorithm>
+
+#ifdef ESP_PLATFORM
+#include <esp_timer.h>
+#else
+#include <chrono>
+#endif
+
+struct StageInfo {
+  const char* name;
+  const char* shortName;
+};
+
+static const StageInfo STAGE_INFO[NUM_RENDER_STAGES] = {
+    { "Message text",     "text" },
+    { "Message push",     "push" },
+    { "Marquee frame",    "marq" },
+    { "Transition frame", "trans" },
+    { "Header",           "head" },
+    { "Menu page",        "menu" },
+    { "Card symbol",      "card" },
+    { "Card face",        "face" }
+};
+
+struct StageRing {
+  uint32_t samples[PROFILE_WINDOW];
+  uint32_t count; // since boot; the ring holds the last PROFILE_WINDOW
+};
+
+static StageRing stageRings[NUM_RENDER_STAGES];
+
+uint32_t profileMicros() {
+#ifdef ESP_PLATFORM
+    return (uint32_t)esp_timer_get_time();
+#else
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void endStage(RenderStage stage, uint32_t start) {
+    StageRing& ring = stageRings[stage];
+    ring.samples[ring.count % PROFILE_WINDOW] = profileMicros() - start;
+    ring.count++;
+}
+
+bool getStageStats(RenderStage stage, StageStats& stats) {
+    const StageRing& ring = stageRings[stage];
+    uint32_t n = min(ring.count, (uint32_t)PROFILE_WINDOW);
+    if (n == 0) return false;
+
+    uint32_t sorted[PROFILE_WINDOW];
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        sorted[i] = ring.samples[i];
+        total += sorted[i];
+    }
+    std::sort(sorted, sorted + n);
+
+    stats.samples = n;
+    stats.min = sorted[0];
+    stats.avg = (uint32_t)(total / n);
+    stats.max = sorted[n - 1];
+    stats.p99 = sorted[(n * 99 + 99) / 100 - 1]; // nearest rank
+    return true;
+}
+
+const char* stageName(RenderStage stage) {
+    return STAGE_INFO[stage].name;
+}
+
+const char* stageShortName(RenderStage stage) {
+    return STAGE_INFO[stage].shortName;
+}
+
+void printRenderProfile() {
+    Serial.print("Render profile (last ");
+    Serial.print(PROFILE_WINDOW);
+    Serial.println(" samples per stage, us):");
+
+    bool any = false;
+    for (int i = 0; i < NUM_RENDER_STAGES; i++) {
+        StageStats stats;
+        if (!getStageStats((RenderStage)i, stats)) continue;
+        any = true;
+
+        Serial.print("  ");
+        Serial.print(stageName((RenderStage)i));
+        Serial.print(": n ");
+        Serial.print(stats.samples);
+        Serial.print(", min ");
+        Serial.print(stats.min);
+        Serial.print(", avg ");
+        Serial.print(stats.avg);
+        Serial.print(", max ");
+        Serial.print(stats.max);
+        Serial.print(", p99 ");
+        Serial.println(stats.p99);
+    }
+    if (!any) {
+        Serial.println("  nothing drawn yet");
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef RENDER_PROFILE_H
+#define RENDER_PROFILE_H
+
+#include "globals.h"
+
+// Time spent in each render stage. Every stage keeps its most recent samples
+// in a ring, and min/avg/max/p99 are worked out from the ring when asked for,
+// so recording a sample is only a clock read and a store. Stages are recorded
+// and read on the render task.
+
+enum RenderStage : uint8_t {
+  STAGE_MESSAGE_TEXT, // text into the message canvas
+  STAGE_MESSAGE_PUSH, // canvas expanded and sent to the panel, mirrored or not
+  STAGE_MARQUEE,      // one marquee frame
+  STAGE_TRANSITION,   // one transition frame
+  STAGE_HEADER,       // header widgets repainted
+  STAGE_MENU_PAGE,    // menu page widgets repainted
+  STAGE_CARD_SYMBOL,
+  STAGE_CARD_FACE,
+  NUM_RENDER_STAGES
+};
+
+const int PROFILE_WINDOW = 128; // samples kept per stage
+const unsigned long PROFILE_OVERLAY_INTERVAL = 500; // ms between overlay refreshes
+
+// Timing lines printed to Serial as things are drawn (message fits, page
+// updates, card faces). Off unless built with -DRENDER_TIMING_LOG=1; the
+// stages are profiled either way.
+#ifndef RENDER_TIMING_LOG
+#define RENDER_TIMING_LOG 0
+#endif
+
+struct StageStats {
+  uint32_t samples; // in the window
+  uint32_t min;     // us
+  uint32_t avg;
+  uint32_t max;
+  uint32_t p99;
+};
+
+// Microseconds from a monotonic clock: esp_timer on the device, the host's
+// steady clock elsewhere
+uint32_t profileMicros();
+
+// Start of a stage, to hand back to endStage()
+inline uint32_t beginStage() {
+  return profileMicros();
+}
+
+void endStage(RenderStage stage, uint32_t start);
+
+// Returns false if the stage has no samples yet
+bool getStageStats(RenderStage stage, StageStats& stats);
+
+const char* stageName(RenderStage stage);
+const char* stageShortName(RenderStage stage); // 5 characters at most
+
+// Prints the statistics of every stage with samples
+void printRenderProfile();
+
+#endif // RENDER_PROFILE_H
@@ -0,0 +1,144 @@
+#include "render_task.h"
+#include "display.h"
+#include "buttons.h"
+#include "ble_handler.h"
+#include "compositor.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+static QueueHandle_t renderQueue = nullptr;
+static TaskHandle_t renderTaskHandle = nullptr;
+
+// Counters, written by the render task except for dropped
+static volatile uint32_t droppedCommands = 0;
+static uint32_t appliedCommands = 0;
+static uint16_t maxQueueDepth = 0;
+static unsigned long latencyTotal = 0;
+static unsigned long latencyMax = 0;
+
+// ============================================================================
+// POSTING
+// ============================================================================
+bool postRenderCommand(uint8_t type, int16_t arg, const char* text) {
+    if (renderQueue == nullptr) {
+        droppedCommands++;
+        return false;
+    }
+
+    RenderCommand command = { type, arg, nullptr, micros() };
+    if (text != nullptr) {
+        command.text = strdup(text);
+        if (command.text == nullptr) {
+            droppedCommands++;
+            return false;
+        }
+    }
+
+    // Posters never wait on a full queue; the render task is behind already
+    if (xQueueSend(renderQueue, &command, 0) != pdTRUE) {
+        free(command.text);
+        droppedCommands++;
+        Serial.println("Render queue full - command dropped");
+        return false;
+    }
+    return true;
+}
+
+void getRenderQueueStats(RenderQueueStats& stats) {
+    stats.commands = appliedCommands;
+    stats.dropped = droppedCommands;
+    stats.depth = (renderQueue != nullptr) ? uxQueueMessagesWaiting(renderQueue) : 0;
+    stats.maxDepth = maxQueueDepth;
+    stats.latencyTotal = latencyTotal;
+    stats.latencyMax = latencyMax;
+}
+
+// ============================================================================
+// RENDER TASK
+// ============================================================================
+static void applyRenderCommand(const RenderCommand& command) {
+    switch (command.type) {
+        case RENDER_BUTTON:
+        case RENDER_LONG_PRESS:
+            // Latency runs from when the input loop saw the press
+            beginKeypress(command.queuedMicros);
+            handleButtonEvent(command.arg, command.type == RENDER_LONG_PRESS);
+            endKeypress();
+            break;
+        case RENDER_MESSAGE:
+            addMessageToHistory(String(command.text));
+            break;
+        case RENDER_CONNECTION:
+            setConnected(command.arg != 0);
+            break;
+        case RENDER_BATTERY:
+            if (batteryLevel != command.arg) {
+                batteryLevel = command.arg;
+                invalidateHeader(HEADER_BATTERY);
+            }
+            break;
+        case RENDER_MAIN_MENU:
+            currentPage = PAGE_MAIN_MENU;
+            drawMainMenu();
+            break;
+    }
+}
+
+static void reportRenderQueue() {
+    if (appliedCommands % RENDER_REPORT_INTERVAL != 0) return;
+
+    Serial.print("Render queue: ");
+    Serial.print(appliedCommands);
+    Serial.print(" commands, max depth ");
+    Serial.print(maxQueueDepth);
+    Serial.print(" of ");
+    Serial.print(RENDER_QUEUE_LENGTH);
+    Serial.print(", latency avg ");
+    Serial.print(latencyTotal / appliedCommands);
+    Serial.print(" us, max ");
+    Serial.print(latencyMax);
+    Serial.print(" us, ");
+    Serial.print(droppedCommands);
+    Serial.println(" dropped");
+}
+
+static void renderTask(void* parameter) {
+    Serial.print("Render task running on core ");
+    Serial.println(xPortGetCoreID());
+
+    RenderCommand command;
+    for (;;) {
+        // Sleep until a command arrives or the next scroll frame could be due
+        if (xQueueReceive(renderQueue, &command, pdMS_TO_TICKS(RENDER_IDLE_MS)) == pdTRUE) {
+            do {
+                uint16_t depth = uxQueueMessagesWaiting(renderQueue) + 1;
+                if (depth > maxQueueDepth) maxQueueDepth = depth;
+
+                applyRenderCommand(command);
+                free(command.text);
+
+                unsigned long latency = micros() - command.queuedMicros;
+                appliedCommands++;
+                latencyTotal += latency;
+                if (latency > latencyMax) latencyMax = latency;
+                reportRenderQueue();
+            } while (xQueueReceive(renderQueue, &command, 0) == pdTRUE);
+        }
+
+        updateDisplay();
+        handleBrightnessDisplay();
+
+        // Repaint any widgets that were invalidated since the last pass
+        compositeDirtyWidgets();
+        handleProfileOverlay();
+    }
+}
+
+void startRenderTask() {
+    if (renderTaskHandle != nullptr) return;
+
+    renderQueue = xQueueCreate(RENDER_QUEUE_LENGTH, sizeof(RenderCommand));
+    xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr, 1,
+                            &renderTaskHandle, RENDER_TASK_CORE);
+}
@@ -0,0 +1,49 @@
+#ifndef RENDER_TASK_H
+#define RENDER_TASK_H
+
+#include "globals.h"
+
+// Everything that touches the panel runs on one task pinned to its own core.
+// BLE callbacks and the input/ingest loop never draw; they post commands here
+// and the render task applies them in order, between scroll frames.
+enum RenderCommandType : uint8_t {
+  RENDER_BUTTON,     // arg: button number (1 or 2)
+  RENDER_LONG_PRESS, // arg: button number (1 or 2)
+  RENDER_MESSAGE,    // text: received data, may hold several lines
+  RENDER_CONNECTION, // arg: 1 when connected
+  RENDER_BATTERY,    // arg: battery level in percent
+  RENDER_MAIN_MENU   // setup is done: the main menu replaces the start-up screen
+};
+
+struct RenderCommand {
+  uint8_t type;
+  int16_t arg;
+  char* text;                 // heap copy owned by the queue, freed once applied
+  unsigned long queuedMicros; // when the command was posted
+};
+
+const int RENDER_QUEUE_LENGTH = 16;
+const int RENDER_TASK_CORE = 1; // the Arduino loop and BLE stack run on core 0
+const uint32_t RENDER_TASK_STACK = 8192;
+const unsigned long RENDER_IDLE_MS = 10; // longest wait for a command between frames
+const uint32_t RENDER_REPORT_INTERVAL = 32; // commands between queue reports
+
+// Queue counters since boot
+struct RenderQueueStats {
+  uint32_t commands;         // applied
+  uint32_t dropped;          // queue full or out of memory
+  uint16_t depth;            // waiting right now
+  uint16_t maxDepth;         // most ever waiting, including the one being taken
+  unsigned long latencyTotal; // posted to applied, us
+  unsigned long latencyMax;
+};
+
+// Call once setup has drawn the first page; drawing belongs to the task after this
+void startRenderTask();
+
+// Safe from any task. text is copied. Returns false if the command was dropped.
+bool postRenderCommand(uint8_t type, int16_t arg = 0, const char* text = nullptr);
+
+void getRenderQueueStats(RenderQueueStats& stats);
+
+#endif // RENDER_TASK_H
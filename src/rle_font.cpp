@@ -0,0 +1,71 @@
+#include "rle_font.h"
+
+// Font data is const and lives in flash, which the ESP32 maps into the data
+// address space, so it is read directly rather than through pgm_read_*.
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+const RleGlyph* findRleGlyph(const RleFont& font, char c) {
+    uint8_t code = (uint8_t)c;
+    if (code < font.first || code > font.last) return nullptr;
+
+    const RleGlyph* glyph = &font.glyphs[code - font.first];
+    // Gaps in a subset are stored as empty glyphs with no advance
+    if (glyph->xAdvance == 0) return nullptr;
+    return glyph;
+}
+
+int16_t rleTextWidth(const RleFont& font, const char* text) {
+    int16_t width = 0;
+    for (; *text; text++) {
+        const RleGlyph* glyph = findRleGlyph(font, *text);
+        if (glyph) width += glyph->xAdvance;
+    }
+    return width;
+}
+
+// ============================================================================
+// DECODING
+// ============================================================================
+void beginRleGlyph(RleCursor& cursor, const RleFont& font, const RleGlyph& glyph) {
+    cursor.data = font.data + glyph.dataOffset;
+    cursor.width = glyph.width;
+    cursor.rowsLeft = glyph.height;
+    cursor.runLeft = 0;
+    cursor.ink = false;
+}
+
+int decodeRleRow(RleCursor& cursor, RleSpan* spans) {
+    if (cursor.rowsLeft <= 0) return -1;
+    cursor.rowsLeft--;
+
+    int count = 0;
+    int16_t x = 0;
+    while (x < cursor.width) {
+        if (cursor.runLeft == 0) {
+            uint8_t run = *cursor.data++;
+            cursor.ink = run & 0x80;
+            cursor.runLeft = (run & 0x7F) + 1;
+        }
+
+        // The part of the run that fits in this row
+        int16_t length = cursor.runLeft;
+        if (length > cursor.width - x) length = cursor.width - x;
+
+        if (cursor.ink) {
+            // The encoder never writes two ink runs in a row, except where a
+            // run is longer than 128 pixels, so merge with the previous span
+            if (count > 0 && spans[count - 1].x + spans[count - 1].length == x) {
+                spans[count - 1].length += length;
+            } else {
+                spans[count].x = x;
+                spans[count].length = length;
+                count++;
+            }
+        }
+        x += length;
+        cursor.runLeft -= length;
+    }
+    return count;
+}
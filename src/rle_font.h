@@ -0,0 +1,57 @@
+#ifndef RLE_FONT_H
+#define RLE_FONT_H
+
+#include <stdint.h>
+
+// Run-length encoded 1bpp fonts, generated by tools/font_subset.py.
+//
+// Each glyph is a sequence of run bytes covering its width x height box in
+// row-major order. Bit 7 is set for ink and clear for background, and bits 0-6
+// hold the run length minus one. Runs carry on across row ends, so the blank
+// right edge of one row and left edge of the next share a byte.
+
+struct RleGlyph {
+  uint16_t dataOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset; // baseline to top row, negative above the baseline
+};
+
+struct RleFont {
+  const uint8_t* data;
+  const RleGlyph* glyphs;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+};
+
+// A run of ink pixels within one row
+struct RleSpan {
+  int16_t x;
+  int16_t length;
+};
+
+// Largest number of ink spans a row can hold (alternating pixels at width 255)
+const int MAX_RLE_SPANS = 128;
+
+// Decoding state for one glyph
+struct RleCursor {
+  const uint8_t* data;
+  int16_t width;
+  int16_t rowsLeft;
+  int16_t runLeft; // pixels of the current run not yet emitted
+  bool ink;
+};
+
+// Glyph lookup, nullptr when the font has no glyph for c
+const RleGlyph* findRleGlyph(const RleFont& font, char c);
+int16_t rleTextWidth(const RleFont& font, const char* text);
+
+// Row-by-row decoding. decodeRleRow() fills spans with the ink runs of the next
+// row and returns how many there are, or -1 once every row has been decoded.
+void beginRleGlyph(RleCursor& cursor, const RleFont& font, const RleGlyph& glyph);
+int decodeRleRow(RleCursor& cursor, RleSpan* spans);
+
+#endif // RLE_FONT_H
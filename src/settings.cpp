@@ -1,5 +1,6 @@
 #include "settings.h"
 #include "display.h"
+#include "backlight.h"
 #include <EEPROM.h>
 
 // ============================================================================
@@ -35,8 +36,7 @@ void setBrightness(int level) {
     int oldBrightness = brightness;
     brightness = constrain(level, MIN_BRIGHTNESS, MAX_BRIGHTNESS);
     
-    int pwmValue = map(brightness, MIN_BRIGHTNESS, MAX_BRIGHTNESS, 25, 255);
-    analogWrite(4, pwmValue);
+    fadeBacklight(brightness, BACKLIGHT_FADE_TIME);
     
     if (oldBrightness != brightness) {
         showBrightnessChange();
@@ -76,6 +76,35 @@ void saveStandbySetting() {
     Serial.println(SLEEP_TIMEOUT);
 }
 
+// ============================================================================
+// ROTATION SETTINGS
+// ============================================================================
+void loadRotationSetting() {
+    EEPROM.begin(EEPROM_SIZE);
+    byte savedRotation = EEPROM.read(ROTATION_ADDR);
+
+    if (savedRotation < NUM_ROTATION_OPTIONS) {
+        screenRotation = savedRotation;
+        Serial.print("Loaded rotation from EEPROM: ");
+        Serial.println(rotationOptions[screenRotation]);
+    } else {
+        screenRotation = DEFAULT_ROTATION;
+        EEPROM.write(ROTATION_ADDR, screenRotation);
+        Serial.print("Using default rotation: ");
+        Serial.println(rotationOptions[screenRotation]);
+    }
+    EEPROM.end();
+}
+
+void saveRotationSetting() {
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.write(ROTATION_ADDR, screenRotation);
+    EEPROM.commit();
+    EEPROM.end();
+    Serial.print("Saved rotation to EEPROM: ");
+    Serial.println(rotationOptions[screenRotation]);
+}
+
 // ============================================================================
 // MIRROR SETTINGS
 // ============================================================================
@@ -139,10 +168,10 @@ void loadCardTypeSetting() {
     EEPROM.begin(EEPROM_SIZE);
     byte savedCardType = EEPROM.read(CARD_TYPE_ADDR);
     
-    if (savedCardType == 0 || savedCardType == 1) {
+    if (savedCardType < NUM_CARD_TYPE_OPTIONS) {
         cardTypeSelection = (CardDisplayType)savedCardType;
         Serial.print("Loaded Card Type from EEPROM: ");
-        Serial.println(cardTypeSelection == CARD_TYPE_WORDS ? "Words" : "Symbols");
+        Serial.println(cardTypeOptions[cardTypeSelection]);
     } else {
         cardTypeSelection = CARD_TYPE_WORDS; // Default to Words
         EEPROM.write(CARD_TYPE_ADDR, cardTypeSelection);
@@ -157,9 +186,37 @@ void saveCardTypeSetting() {
     EEPROM.commit();
     EEPROM.end();
     Serial.print("Saved Card Type to EEPROM: ");
-    Serial.println(cardTypeSelection == CARD_TYPE_WORDS ? "Words" : "Symbols");
+    Serial.println(cardTypeOptions[cardTypeSelection]);
 }
 
+// ============================================================================
+// TRANSITION SETTINGS
+// ============================================================================
+void loadTransitionSetting() {
+    EEPROM.begin(EEPROM_SIZE);
+    byte savedTransition = EEPROM.read(TRANSITION_ADDR);
+
+    if (savedTransition < NUM_TRANSITION_OPTIONS) {
+        messageTransition = (TransitionStyle)savedTransition;
+        Serial.print("Loaded transition from EEPROM: ");
+        Serial.println(transitionOptions[messageTransition]);
+    } else {
+        messageTransition = TRANSITION_SLIDE;
+        EEPROM.write(TRANSITION_ADDR, messageTransition);
+        Serial.print("Using default transition: ");
+        Serial.println(transitionOptions[messageTransition]);
+    }
+    EEPROM.end();
+}
+
+void saveTransitionSetting() {
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.write(TRANSITION_ADDR, messageTransition);
+    EEPROM.commit();
+    EEPROM.end();
+    Serial.print("Saved transition to EEPROM: ");
+    Serial.println(transitionOptions[messageTransition]);
+}
 
 // ============================================================================
 // SETTINGS MENU NAVIGATION LOGIC
@@ -193,12 +250,16 @@ void enterSubMenu() {
         subMenuIndex = EEPROM.read(STANDBY_ADDR);
         if (subMenuIndex < 0 || subMenuIndex >= NUM_STANDBY_OPTIONS) subMenuIndex = 5; // Default to 15 mins
         EEPROM.end();
+    } else if (settingsMenuIndex == 2) { // Rotate Screen
+        subMenuIndex = screenRotation;
     } else if (settingsMenuIndex == 3) { // Mirror Screen
         subMenuIndex = (int)mirrorMessages;
     } else if (settingsMenuIndex == 5) { // Smart Text
         subMenuIndex = (int)smartTextEnabled;
     } else if (settingsMenuIndex == 6) { // Card Type
         subMenuIndex = (int)cardTypeSelection;
+    } else if (settingsMenuIndex == 7) { // Transition
+        subMenuIndex = (int)messageTransition;
     }
     drawSubMenu();
 }
@@ -218,6 +279,12 @@ void cycleSubMenuOption() {
             subMenuIndex = (subMenuIndex + 1) % NUM_STANDBY_OPTIONS;
             saveStandbySetting();
             break;
+        case 2: // Rotate Screen
+            subMenuIndex = (subMenuIndex + 1) % NUM_ROTATION_OPTIONS;
+            screenRotation = subMenuIndex;
+            saveRotationSetting();
+            applyScreenRotation();
+            break;
         case 3: // Mirror Screen
             subMenuIndex = (subMenuIndex + 1) % NUM_MIRROR_OPTIONS;
             mirrorMessages = (bool)subMenuIndex;
@@ -233,6 +300,11 @@ void cycleSubMenuOption() {
             cardTypeSelection = (CardDisplayType)subMenuIndex;
             saveCardTypeSetting();
             break;
+        case 7: // Transition
+            subMenuIndex = (subMenuIndex + 1) % NUM_TRANSITION_OPTIONS;
+            messageTransition = (TransitionStyle)subMenuIndex;
+            saveTransitionSetting();
+            break;
         default:
             // Do nothing for unimplemented sub-menus
             break;
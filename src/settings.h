@@ -12,6 +12,10 @@ void setBrightness(int level);
 void loadStandbySetting();
 void saveStandbySetting();
 
+// Rotation
+void loadRotationSetting();
+void saveRotationSetting();
+
 // Mirror
 void loadMirrorSetting();
 void saveMirrorSetting();
@@ -24,6 +28,10 @@ void saveSmartTextSetting();
 void loadCardTypeSetting();
 void saveCardTypeSetting();
 
+// Transition
+void loadTransitionSetting();
+void saveTransitionSetting();
+
 // Menu Navigation
 void enterSettingsMenu();
 void exitSettingsMenu();
@@ -0,0 +1,367 @@
+#include "smooth_font.h"
+#include <LittleFS.h>
+
+// Message font ladder, largest first. Generated by tools/make_vlw.py and
+// uploaded with "pio run -t uploadfs".
+static const char* SMOOTH_FONT_FILES[] = {
+    "/fonts/DejaVuSansBold24.vlw",
+    "/fonts/DejaVuSansBold20.vlw",
+    "/fonts/DejaVuSansBold16.vlw"
+};
+static const int NUM_SMOOTH_FONT_FILES = sizeof(SMOOTH_FONT_FILES) / sizeof(SMOOTH_FONT_FILES[0]);
+
+// .vlw layout: header and per-glyph metrics are big-endian int32 fields
+const int VLW_HEADER_BYTES = 24;
+const int VLW_GLYPH_BYTES = 28;
+
+const uint8_t FIRST_ASCII = 0x20;
+const uint8_t LAST_ASCII = 0x7E;
+
+struct SmoothGlyph {
+  uint16_t codepoint;
+  uint8_t width;
+  uint8_t height;
+  uint8_t advance;
+  int8_t left;
+  int16_t top;           // rows from the top of the mask to the baseline
+  uint32_t bitmapOffset; // file offset of the 8-bit alpha mask
+  int16_t slot;          // cache slot holding the 4-bit mask, -1 if not cached
+};
+
+struct SmoothFont {
+  File file;
+  SmoothGlyph* glyphs;
+  uint16_t glyphCount;
+  int16_t ascent;
+  int16_t descent;
+  int16_t asciiIndex[LAST_ASCII - FIRST_ASCII + 1]; // -1 when the font lacks it
+};
+
+struct GlyphSlot {
+  int8_t font; // -1 when the slot is free
+  int16_t glyph;
+  uint32_t lastUse;
+};
+
+static bool fontsInitialized = false;
+static SmoothFont fonts[NUM_SMOOTH_FONT_FILES];
+static int fontCount = 0;
+
+// Glyph cache: slotCount masks of slotBytes each, evicted least recently used
+static uint8_t* slotPool = nullptr;
+static int32_t slotBytes = 0;
+static int slotCount = 0;
+static GlyphSlot slots[MAX_GLYPH_SLOTS];
+static uint32_t useClock = 0;
+
+// Totals since the last report
+static uint32_t cacheHits = 0;
+static uint32_t cacheMisses = 0;
+static uint32_t charsDrawn = 0;
+static unsigned long drawMicros = 0;
+
+static int32_t readInt32(const uint8_t* p) {
+    return (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]);
+}
+
+// ============================================================================
+// LOADING
+// ============================================================================
+static bool loadFont(const char* path, SmoothFont& font) {
+    File file = LittleFS.open(path, "r");
+    if (!file) return false;
+
+    uint8_t header[VLW_HEADER_BYTES];
+    if (file.read(header, VLW_HEADER_BYTES) != VLW_HEADER_BYTES) {
+        file.close();
+        return false;
+    }
+
+    uint16_t count = (uint16_t)readInt32(header);
+    SmoothGlyph* glyphs = (SmoothGlyph*)malloc(count * sizeof(SmoothGlyph));
+    if (!glyphs) {
+        file.close();
+        return false;
+    }
+
+    for (int i = 0; i <= LAST_ASCII - FIRST_ASCII; i++) {
+        font.asciiIndex[i] = -1;
+    }
+
+    // Line metrics come from the glyph extents rather than the header, the same
+    // way TFT_eSPI sizes its smooth fonts
+    int16_t ascent = 0;
+    int16_t descent = 0;
+    uint32_t bitmapOffset = VLW_HEADER_BYTES + (uint32_t)count * VLW_GLYPH_BYTES;
+
+    for (int i = 0; i < count; i++) {
+        uint8_t metrics[VLW_GLYPH_BYTES];
+        if (file.read(metrics, VLW_GLYPH_BYTES) != VLW_GLYPH_BYTES) {
+            free(glyphs);
+            file.close();
+            return false;
+        }
+
+        SmoothGlyph& glyph = glyphs[i];
+        glyph.codepoint = (uint16_t)readInt32(metrics);
+        glyph.height = (uint8_t)readInt32(metrics + 4);
+        glyph.width = (uint8_t)readInt32(metrics + 8);
+        glyph.advance = (uint8_t)readInt32(metrics + 12);
+        glyph.top = (int16_t)readInt32(metrics + 16);
+        glyph.left = (int8_t)readInt32(metrics + 20);
+        glyph.bitmapOffset = bitmapOffset;
+        glyph.slot = -1;
+        bitmapOffset += glyph.width * glyph.height;
+
+        if (glyph.codepoint >= FIRST_ASCII && glyph.codepoint <= LAST_ASCII) {
+            font.asciiIndex[glyph.codepoint - FIRST_ASCII] = i;
+            if (glyph.top > ascent) ascent = glyph.top;
+            if (glyph.height - glyph.top > descent) descent = glyph.height - glyph.top;
+        }
+    }
+
+    if (file.size() < bitmapOffset) {
+        free(glyphs);
+        file.close();
+        return false;
+    }
+
+    font.file = file;
+    font.glyphs = glyphs;
+    font.glyphCount = count;
+    font.ascent = ascent;
+    font.descent = descent;
+    return true;
+}
+
+void initSmoothFonts() {
+    if (fontsInitialized) return;
+    fontsInitialized = true;
+
+    if (!LittleFS.begin(false)) {
+        Serial.println("LittleFS mount failed - using GFX fonts");
+        return;
+    }
+
+    for (int i = 0; i < NUM_SMOOTH_FONT_FILES; i++) {
+        if (loadFont(SMOOTH_FONT_FILES[i], fonts[fontCount])) {
+            fontCount++;
+        } else {
+            Serial.print("Smooth font not found: ");
+            Serial.println(SMOOTH_FONT_FILES[i]);
+        }
+    }
+    if (fontCount == 0) {
+        Serial.println("No smooth fonts loaded - using GFX fonts");
+        return;
+    }
+
+    // Every slot must fit the biggest mask of any loaded font
+    for (int f = 0; f < fontCount; f++) {
+        for (int i = 0; i < fonts[f].glyphCount; i++) {
+            const SmoothGlyph& glyph = fonts[f].glyphs[i];
+            int32_t bytes = ((glyph.width + 1) / 2) * glyph.height;
+            if (bytes > slotBytes) slotBytes = bytes;
+        }
+    }
+    slotCount = min(MAX_GLYPH_SLOTS, (int)(GLYPH_CACHE_BYTES / max(slotBytes, (int32_t)1)));
+    slotPool = (uint8_t*)malloc(slotCount * slotBytes);
+    if (!slotPool) {
+        Serial.println("Failed to allocate glyph cache - using GFX fonts");
+        fontCount = 0;
+        return;
+    }
+    for (int i = 0; i < slotCount; i++) {
+        slots[i].font = -1;
+    }
+
+    Serial.print("Smooth fonts loaded: ");
+    Serial.print(fontCount);
+    Serial.print(", glyph cache ");
+    Serial.print(slotCount);
+    Serial.print(" x ");
+    Serial.print(slotBytes);
+    Serial.println(" bytes");
+}
+
+// ============================================================================
+// METRICS
+// ============================================================================
+int smoothFontCount() {
+    return fontCount;
+}
+
+int16_t smoothFontLineHeight(int font) {
+    return fonts[font].ascent + fonts[font].descent;
+}
+
+int16_t smoothFontAscent(int font) {
+    return fonts[font].ascent;
+}
+
+static int findGlyph(const SmoothFont& font, uint8_t c) {
+    if (c < FIRST_ASCII || c > LAST_ASCII) return -1;
+    return font.asciiIndex[c - FIRST_ASCII];
+}
+
+int16_t smoothTextWidth(int font, const String& text) {
+    const SmoothFont& f = fonts[font];
+    int16_t width = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        int glyphIndex = findGlyph(f, (uint8_t)text[i]);
+        if (glyphIndex >= 0) width += f.glyphs[glyphIndex].advance;
+    }
+    return width;
+}
+
+bool getSmoothGlyphMetrics(int font, char c, int16_t& advance, int16_t& above, int16_t& below) {
+    int glyphIndex = findGlyph(fonts[font], (uint8_t)c);
+    if (glyphIndex < 0) return false;
+
+    const SmoothGlyph& glyph = fonts[font].glyphs[glyphIndex];
+    advance = glyph.advance;
+    above = (glyph.height > 0) ? glyph.top : 0;
+    below = (glyph.height > 0) ? glyph.height - glyph.top : 0;
+    return true;
+}
+
+// ============================================================================
+// GLYPH CACHE
+// ============================================================================
+static void printCacheReport() {
+    uint32_t lookups = cacheHits + cacheMisses;
+    Serial.print("Glyph cache: ");
+    Serial.print(lookups ? cacheHits * 100 / lookups : 0);
+    Serial.print("% hits (");
+    Serial.print(cacheHits);
+    Serial.print("/");
+    Serial.print(lookups);
+    Serial.print("), ");
+    Serial.print(drawMicros / charsDrawn);
+    Serial.println(" us/char");
+
+    cacheHits = 0;
+    cacheMisses = 0;
+    charsDrawn = 0;
+    drawMicros = 0;
+}
+
+// Returns the 4-bit mask for a glyph, reading it from flash on a miss. The
+// pointer is only valid until the next call.
+static const uint8_t* glyphMask(int font, int glyphIndex) {
+    SmoothGlyph& glyph = fonts[font].glyphs[glyphIndex];
+    useClock++;
+
+    if (glyph.slot >= 0) {
+        cacheHits++;
+        slots[glyph.slot].lastUse = useClock;
+        return slotPool + glyph.slot * slotBytes;
+    }
+    cacheMisses++;
+
+    // Take a free slot, or evict the least recently used one
+    int victim = 0;
+    for (int i = 0; i < slotCount; i++) {
+        if (slots[i].font < 0) {
+            victim = i;
+            break;
+        }
+        if (slots[i].lastUse < slots[victim].lastUse) victim = i;
+    }
+    if (slots[victim].font >= 0) {
+        fonts[slots[victim].font].glyphs[slots[victim].glyph].slot = -1;
+    }
+
+    // Requantise each row of 8-bit alpha to packed 4-bit coverage
+    static uint8_t row[256];
+    uint8_t* mask = slotPool + victim * slotBytes;
+    int32_t maskStride = (glyph.width + 1) / 2;
+    File& file = fonts[font].file;
+    file.seek(glyph.bitmapOffset);
+
+    memset(mask, 0, maskStride * glyph.height);
+    for (int y = 0; y < glyph.height; y++) {
+        if (file.read(row, glyph.width) != glyph.width) break;
+        row[glyph.width] = 0;
+        uint8_t* out = mask + y * maskStride;
+        for (int x = 0; x < glyph.width; x += 2) {
+            uint8_t high = (row[x] * 15 + 127) / 255;
+            uint8_t low = (row[x + 1] * 15 + 127) / 255;
+            out[x >> 1] = (high << 4) | low;
+        }
+    }
+
+    slots[victim].font = font;
+    slots[victim].glyph = glyphIndex;
+    slots[victim].lastUse = useClock;
+    glyph.slot = victim;
+    return mask;
+}
+
+// ============================================================================
+// DRAWING
+// ============================================================================
+static inline uint8_t maskCoverage(const uint8_t* maskRow, int32_t col) {
+    return (col & 1) ? (maskRow[col >> 1] & 0x0F) : (maskRow[col >> 1] >> 4);
+}
+
+static void blendGlyph(const SpanCanvas& canvas, int32_t gx, int32_t gy, const SmoothGlyph& glyph,
+                       const uint8_t* mask) {
+    int32_t maskStride = (glyph.width + 1) / 2;
+    int32_t rowStart = max((int32_t)0, -gy);
+    int32_t rowEnd = min((int32_t)glyph.height, canvas.height - gy);
+    int32_t left = max(gx, (int32_t)0); // canvas columns covered
+    int32_t right = min(gx + glyph.width, canvas.width);
+    int32_t start = left >> 1;
+    int32_t end = ((right - 1) >> 1) + 1;
+
+    for (int32_t row = rowStart; row < rowEnd; row++) {
+        const uint8_t* src = mask + row * maskStride;
+        int32_t fresh = claimSpanRow(canvas, gy + row, start, end);
+        uint8_t* dst = canvas.pixels + (gy + row) * canvas.stride;
+
+        for (int32_t b = start; b < end; b++) {
+            // The two coverage values that land in this byte, 0 off the glyph
+            int32_t col = b * 2 - gx;
+            uint8_t high = (col >= 0) ? maskCoverage(src, col) : 0;
+            uint8_t low = (b * 2 + 1 < right) ? maskCoverage(src, col + 1) : 0;
+
+            if (b >= fresh) {
+                dst[b] = (high << 4) | low;
+            } else {
+                // Overlapping glyphs keep the higher coverage
+                uint8_t pair = dst[b];
+                if (high > (pair >> 4)) pair = (pair & 0x0F) | (high << 4);
+                if (low > (pair & 0x0F)) pair = (pair & 0xF0) | low;
+                dst[b] = pair;
+            }
+        }
+    }
+}
+
+void drawSmoothTextSpans(const SpanCanvas& canvas, int font, int32_t x, int32_t baseline, const String& text) {
+    if (font < 0 || font >= fontCount || canvas.depth != 4) return;
+    unsigned long start = micros();
+
+    const SmoothFont& f = fonts[font];
+    uint32_t drawn = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        int glyphIndex = findGlyph(f, (uint8_t)text[i]);
+        if (glyphIndex < 0) continue;
+
+        const SmoothGlyph& glyph = f.glyphs[glyphIndex];
+        int32_t gx = x + glyph.left;
+        int32_t gy = baseline - glyph.top;
+        if (glyph.width > 0 && gx < canvas.width && gx + glyph.width > 0 && gy < canvas.height && gy + glyph.height > 0) {
+            blendGlyph(canvas, gx, gy, glyph, glyphMask(font, glyphIndex));
+            drawn++;
+        }
+        x += glyph.advance;
+    }
+
+    charsDrawn += drawn;
+    drawMicros += micros() - start;
+    if (charsDrawn >= GLYPH_REPORT_INTERVAL) {
+        printCacheReport();
+    }
+}
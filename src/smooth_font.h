@@ -0,0 +1,36 @@
+#ifndef SMOOTH_FONT_H
+#define SMOOTH_FONT_H
+
+#include "globals.h"
+#include "span_text.h"
+
+// Anti-aliased .vlw fonts read from LittleFS. Glyph metrics stay in RAM; the
+// alpha masks are read from flash on first use and kept in an LRU cache as
+// 4-bit coverage, which is what the 4bpp message canvas stores anyway.
+
+// Total RAM for cached glyph masks, and the most glyphs it may hold
+const int GLYPH_CACHE_BYTES = 12288;
+const int MAX_GLYPH_SLOTS = 64;
+
+// Characters drawn between glyph cache reports
+const int GLYPH_REPORT_INTERVAL = 2048;
+
+// Setup. Loads every font of the ladder that is present on the filesystem.
+void initSmoothFonts();
+
+// Loaded fonts, largest first. Font ids run from 0 to smoothFontCount() - 1.
+int smoothFontCount();
+int16_t smoothFontLineHeight(int font);
+int16_t smoothFontAscent(int font);
+int16_t smoothTextWidth(int font, const String& text);
+
+// Advance and vertical extent (rows above and below the baseline) of one
+// character. Returns false if the font has no glyph for it.
+bool getSmoothGlyphMetrics(int font, char c, int16_t& advance, int16_t& above, int16_t& below);
+
+// Draws text into a 4bpp span canvas. Coverage is written as palette index
+// 0-15 and blends with text already drawn in the pass by keeping the higher
+// value. Clipped to the canvas.
+void drawSmoothTextSpans(const SpanCanvas& canvas, int font, int32_t x, int32_t baseline, const String& text);
+
+#endif // SMOOTH_FONT_H
@@ -0,0 +1,92 @@
+#include "span_text.h"
+
+// Bytes at the start of each row written so far in the current pass
+static uint16_t rowFilled[MAX_SPAN_CANVAS_ROWS];
+
+bool beginSpanCanvas(SpanCanvas& canvas, uint8_t* pixels, int32_t width, int32_t height, int8_t depth) {
+    if (!pixels || height > MAX_SPAN_CANVAS_ROWS) return false;
+
+    canvas.pixels = pixels;
+    canvas.stride = (depth == 1) ? (width + 7) / 8 : (width + 1) / 2;
+    canvas.width = width;
+    canvas.height = height;
+    canvas.depth = depth;
+    memset(rowFilled, 0, height * sizeof(rowFilled[0]));
+    return true;
+}
+
+int32_t claimSpanRow(const SpanCanvas& canvas, int32_t y, int32_t start, int32_t end) {
+    int32_t filled = rowFilled[y];
+    if (filled >= end) return end;
+
+    if (filled < start) {
+        memset(canvas.pixels + y * canvas.stride + filled, 0, start - filled);
+        filled = start;
+    }
+    rowFilled[y] = end;
+    return filled;
+}
+
+void finishSpanCanvas(const SpanCanvas& canvas) {
+    for (int32_t y = 0; y < canvas.height; y++) {
+        int32_t filled = rowFilled[y];
+        memset(canvas.pixels + y * canvas.stride + filled, 0, canvas.stride - filled);
+    }
+}
+
+// Reads count (1-8) bits of MSB-first src, starting p bits in, into the top
+// of a byte
+static inline uint8_t readBits(const uint8_t* src, int32_t p, int32_t count) {
+    int32_t shift = p & 7;
+    uint32_t bits = (uint32_t)src[p >> 3] << shift;
+    if (shift + count > 8) bits |= src[(p >> 3) + 1] >> (8 - shift);
+    return (uint8_t)bits & (uint8_t)(0xFF << (8 - count));
+}
+
+void drawGfxTextSpans(const SpanCanvas& canvas, const GFXfont* font, int32_t x, int32_t baseline,
+                      const char* text, int length) {
+    if (canvas.depth != 1) return;
+
+    for (int i = 0; i < length; i++) {
+        uint8_t c = (uint8_t)text[i];
+        if (c < font->first || c > font->last) continue;
+
+        // Same placement as TFT_eSPI: the box is offset from the pen position,
+        // and its bits run on from one row to the next without padding
+        const GFXglyph& glyph = font->glyph[c - font->first];
+        int32_t w = glyph.width;
+        int32_t h = glyph.height;
+        int32_t gx = x + glyph.xOffset;
+        int32_t gy = baseline + glyph.yOffset;
+        x += glyph.xAdvance;
+        if (w == 0 || h == 0 || gx >= canvas.width || gx + w <= 0 || gy >= canvas.height || gy + h <= 0) continue;
+
+        const uint8_t* bits = font->bitmap + glyph.bitmapOffset;
+        int32_t rowStart = max((int32_t)0, -gy);
+        int32_t rowEnd = min(h, canvas.height - gy);
+        int32_t left = max(gx, (int32_t)0); // canvas columns covered
+        int32_t right = min(gx + w, canvas.width);
+        int32_t start = left >> 3;
+        int32_t end = ((right - 1) >> 3) + 1;
+
+        // Each canvas byte takes the glyph bits that fall in it, with zeros
+        // around them, in a single store
+        for (int32_t row = rowStart; row < rowEnd; row++) {
+            int32_t y = gy + row;
+            int32_t fresh = claimSpanRow(canvas, y, start, end);
+            uint8_t* dst = canvas.pixels + y * canvas.stride;
+            int32_t rowBits = row * w - gx; // source bit of canvas column 0
+
+            for (int32_t b = start; b < end; b++) {
+                int32_t lo = max(left, b * 8);
+                int32_t hi = min(right, b * 8 + 8);
+                uint8_t byte = readBits(bits, rowBits + lo, hi - lo) >> (lo - b * 8);
+                if (b >= fresh) {
+                    dst[b] = byte;
+                } else {
+                    dst[b] |= byte;
+                }
+            }
+        }
+    }
+}
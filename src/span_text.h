@@ -0,0 +1,41 @@
+#ifndef SPAN_TEXT_H
+#define SPAN_TEXT_H
+
+#include "globals.h"
+
+// Message text written straight into a 1bpp or 4bpp canvas a glyph row at a
+// time. The canvas is not cleared first. Bytes a glyph row is first to reach
+// are stored outright, glyph and background (0) together; only where glyphs
+// overlap is anything blended. finishSpanCanvas() fills the bytes no glyph
+// reached, so every byte is written once in a pass unless glyphs share it.
+
+// Tallest canvas a span pass can cover
+const int MAX_SPAN_CANVAS_ROWS = (TFT_WIDTH > TFT_HEIGHT) ? TFT_WIDTH : TFT_HEIGHT;
+
+struct SpanCanvas {
+  uint8_t* pixels;
+  int32_t stride; // bytes per row
+  int32_t width;
+  int32_t height;
+  int8_t depth;   // 1 (MSB first) or 4 (high nibble first)
+};
+
+// Starts a pass over a canvas whose contents are about to be replaced.
+// Returns false if it is taller than MAX_SPAN_CANVAS_ROWS.
+bool beginSpanCanvas(SpanCanvas& canvas, uint8_t* pixels, int32_t width, int32_t height, int8_t depth);
+
+// Claims bytes [start, end) of row y for a glyph row. Untouched bytes before
+// start are filled with background. Returns the first byte of the range that
+// nothing has written yet: bytes from there on must be stored outright, the
+// ones before it blended with what is there.
+int32_t claimSpanRow(const SpanCanvas& canvas, int32_t y, int32_t start, int32_t end);
+
+// Fills every byte no glyph reached. The canvas is complete after this.
+void finishSpanCanvas(const SpanCanvas& canvas);
+
+// Draws text in a GFX font at 1bpp with its baseline at row baseline, clipped
+// to the canvas. Only set bits are written; the background comes from the pass.
+void drawGfxTextSpans(const SpanCanvas& canvas, const GFXfont* font, int32_t x, int32_t baseline,
+                      const char* text, int length);
+
+#endif // SPAN_TEXT_H
@@ -0,0 +1,94 @@
+// Times each pixel kernel against its one pixel at a time reference on a
+// 240 pixel row, the widest the panel has. Host numbers only show the gain
+// from working a word at a time; the ESP32 figures are in the frame timing
+// and #PROFILE reports.
+//
+//   pio run -e native_kernels -t exec
+
+#ifndef PIO_UNIT_TESTING
+
+#include <stdio.h>
+#include <chrono>
+#include "pixel_kernels.h"
+#include "../test_pixel_kernels/reference_kernels.h"
+
+const int32_t ROW_WIDTH = 240;
+const int ROWS_PER_RUN = 100000;
+const int RUNS = 5;
+
+alignas(4) static uint16_t row[ROW_WIDTH + 2];
+alignas(4) static uint16_t sourcePixels[ROW_WIDTH + 2];
+alignas(4) static uint8_t sourceBytes[ROW_WIDTH + 2];
+
+// Keeps the compiler from dropping or merging the stores into row
+static inline void useRow() {
+    asm volatile("" : : "r"(row) : "memory");
+}
+
+// Fastest of RUNS runs, in nanoseconds per row
+template <typename Fn>
+static double timeRow(Fn fn) {
+    double best = 1e30;
+    for (int run = 0; run < RUNS; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ROWS_PER_RUN; i++) {
+            fn();
+            useRow();
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = elapsed.count() / ROWS_PER_RUN < best ? elapsed.count() / ROWS_PER_RUN : best;
+    }
+    return best;
+}
+
+template <typename Kernel, typename Reference>
+static void compare(const char* name, Kernel kernel, Reference reference) {
+    double kernelNs = timeRow(kernel);
+    double referenceNs = timeRow(reference);
+    printf("%-28s %7.1f ns  reference %7.1f ns  %4.1fx\n", name, kernelNs, referenceNs, referenceNs / kernelNs);
+}
+
+int main() {
+    for (int i = 0; i < ROW_WIDTH + 2; i++) {
+        sourceBytes[i] = (uint8_t)(i * 37 + 11);
+        sourcePixels[i] = (uint16_t)(i * 2654435761u >> 16);
+    }
+
+    const uint16_t foreground = 0xFFFF;
+    const uint16_t background = 0x0841;
+    MonoExpandLut monoLut;
+    buildMonoExpandLut(monoLut, foreground, background);
+
+    uint16_t palette[16];
+    for (int i = 0; i < 16; i++) {
+        palette[i] = (uint16_t)(i * 0x1111);
+    }
+    PaletteExpandLut paletteLut;
+    buildPaletteExpandLut(paletteLut, palette, 16);
+
+    printf("%d pixel row, fastest of %d runs of %d rows\n", (int)ROW_WIDTH, RUNS, ROWS_PER_RUN);
+    compare("expandMonoRow",
+            [&] { expandMonoRow(row, sourceBytes, 0, ROW_WIDTH, monoLut); },
+            [&] { referenceExpandMono(row, sourceBytes, 0, ROW_WIDTH, foreground, background); });
+    compare("expandMonoRow (bit 3)",
+            [&] { expandMonoRow(row, sourceBytes, 3, ROW_WIDTH, monoLut); },
+            [&] { referenceExpandMono(row, sourceBytes, 3, ROW_WIDTH, foreground, background); });
+    compare("expandPaletteRow",
+            [&] { expandPaletteRow(row, sourceBytes, ROW_WIDTH, paletteLut); },
+            [&] { referenceExpandPalette(row, sourceBytes, ROW_WIDTH, palette); });
+    compare("expandPaletteRow (odd dst)",
+            [&] { expandPaletteRow(row + 1, sourceBytes, ROW_WIDTH, paletteLut); },
+            [&] { referenceExpandPalette(row + 1, sourceBytes, ROW_WIDTH, palette); });
+    compare("fillSpan565",
+            [&] { fillSpan565(row, background, ROW_WIDTH); },
+            [&] { referenceFill(row, background, ROW_WIDTH); });
+    compare("swapBytes565",
+            [&] { swapBytes565(row, sourcePixels, ROW_WIDTH); },
+            [&] { referenceSwapBytes(row, sourcePixels, ROW_WIDTH); });
+    compare("swapBytes565 (in place)",
+            [&] { swapBytes565(row, row, ROW_WIDTH); },
+            [&] { referenceSwapBytes(row, row, ROW_WIDTH); });
+    return 0;
+}
+
+#endif // PIO_UNIT_TESTING
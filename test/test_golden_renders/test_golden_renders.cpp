@@ -0,0 +1,35 @@
+// Draws every screen and checks it pixel for pixel against the reference
+// images in golden/, which were rendered with the DejaVu stand-ins for
+// TFT_eSPI's fonts in host/fonts. Each image that differs is listed with the
+// box the differences are in; the new renders are left in .pio/golden_renders
+// to look at. After an intended change, render the references again:
+//
+//   pio test -e native_golden
+//   pio run -e native_golden
+//   .pio/build/native_golden/program test/test_golden_renders/golden
+
+#include <unity.h>
+#include "render_dump.h"
+
+static const char* const OUTPUT_DIR = ".pio/golden_renders";
+static const char* const GOLDEN_DIR = "test/test_golden_renders/golden";
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+static void testRendersMatchGolden() {
+    TEST_ASSERT_EQUAL_MESSAGE(0, renderScreens(OUTPUT_DIR, GOLDEN_DIR),
+                              "renders differ from test/test_golden_renders/golden or have text problems, see above");
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(testRendersMatchGolden);
+    return UNITY_END();
+}
@@ -0,0 +1,38 @@
+#ifndef REFERENCE_KERNELS_H
+#define REFERENCE_KERNELS_H
+
+#include <stdint.h>
+
+// One pixel at a time versions of the kernels in pixel_kernels.h, written as
+// plainly as possible. The tests check the kernels against these and the
+// benchmark times the kernels against them.
+
+inline void referenceExpandMono(uint16_t* dst, const uint8_t* src, int32_t bitOffset, int32_t w,
+                                uint16_t foreground, uint16_t background) {
+    for (int32_t i = 0; i < w; i++) {
+        int32_t bit = bitOffset + i;
+        dst[i] = (src[bit >> 3] & (0x80 >> (bit & 7))) ? foreground : background;
+    }
+}
+
+inline void referenceExpandPalette(uint16_t* dst, const uint8_t* src, int32_t w, const uint16_t* colors) {
+    for (int32_t i = 0; i < w; i++) {
+        uint8_t byte = src[i >> 1];
+        dst[i] = colors[(i & 1) ? (byte & 0x0F) : (byte >> 4)];
+    }
+}
+
+inline void referenceFill(uint16_t* dst, uint16_t color, int32_t count) {
+    for (int32_t i = 0; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+inline void referenceSwapBytes(uint16_t* dst, const uint16_t* src, int32_t count) {
+    for (int32_t i = 0; i < count; i++) {
+        uint16_t pixel = src[i];
+        dst[i] = (uint16_t)(((pixel & 0xFF) << 8) | (pixel >> 8));
+    }
+}
+
+#endif // REFERENCE_KERNELS_H
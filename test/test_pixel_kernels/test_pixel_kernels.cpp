@@ -0,0 +1,180 @@
+// Checks every pixel kernel against the one pixel at a time loops in
+// reference_kernels.h, over every width up to a few words and random wider
+// ones, with the destination (and source) starting on and off a word boundary.
+//
+//   pio test -e native_kernels
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "pixel_kernels.h"
+#include "reference_kernels.h"
+
+const int32_t MAX_WIDTH = 320;
+const int32_t GUARD = 4;                 // untouched pixels each side of the row
+const uint16_t GUARD_COLOR = 0xA5C3;
+const int NUM_RANDOM_WIDTHS = 200;
+
+// Kernel output and reference output, each with guard pixels around the row
+alignas(4) static uint16_t actual[MAX_WIDTH + 2 * GUARD + 4];
+alignas(4) static uint16_t expected[MAX_WIDTH + 2 * GUARD + 4];
+alignas(4) static uint16_t sourcePixels[MAX_WIDTH + 4];
+alignas(4) static uint8_t sourceBytes[MAX_WIDTH + 4];
+
+static uint32_t randomState = 0x12345678;
+
+// xorshift32, so every run checks the same cases
+static uint32_t nextRandom() {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+static void fillRandom(uint8_t* bytes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        bytes[i] = (uint8_t)nextRandom();
+    }
+}
+
+// Widths to try: all of 0..64, then random ones up to MAX_WIDTH
+static int32_t testWidth(int i) {
+    return i <= 64 ? i : (int32_t)(nextRandom() % (MAX_WIDTH + 1));
+}
+const int NUM_TEST_WIDTHS = 65 + NUM_RANDOM_WIDTHS;
+
+static void resetOutputs() {
+    for (size_t i = 0; i < sizeof(actual) / sizeof(actual[0]); i++) {
+        actual[i] = GUARD_COLOR;
+        expected[i] = GUARD_COLOR;
+    }
+}
+
+// Compares the rows and their guards, naming the case on a mismatch
+static void checkOutputs(const char* kernel, int32_t width, int dstOffset, int srcOffset) {
+    for (size_t i = 0; i < sizeof(actual) / sizeof(actual[0]); i++) {
+        if (actual[i] == expected[i]) continue;
+        char message[160];
+        snprintf(message, sizeof(message), "%s: width %d, dst offset %d, src offset %d: pixel %d is 0x%04X, expected 0x%04X",
+                 kernel, (int)width, dstOffset, srcOffset, (int)i - GUARD - dstOffset, actual[i], expected[i]);
+        TEST_FAIL_MESSAGE(message);
+    }
+}
+
+void setUp() {
+    randomState = 0x12345678;
+}
+
+void tearDown() {
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+static void testSwap565() {
+    TEST_ASSERT_EQUAL_HEX16(0x3412, swap565(0x1234));
+    TEST_ASSERT_EQUAL_HEX16(0x00FF, swap565(0xFF00));
+}
+
+static void testExpandMonoRow() {
+    for (int i = 0; i < NUM_TEST_WIDTHS; i++) {
+        int32_t width = testWidth(i);
+        uint16_t foreground = (uint16_t)nextRandom();
+        uint16_t background = (uint16_t)nextRandom();
+        MonoExpandLut lut;
+        buildMonoExpandLut(lut, foreground, background);
+
+        for (int dstOffset = 0; dstOffset < 4; dstOffset++) {
+            for (int32_t bitOffset = 0; bitOffset < 16; bitOffset++) {
+                fillRandom(sourceBytes, sizeof(sourceBytes));
+                resetOutputs();
+                expandMonoRow(actual + GUARD + dstOffset, sourceBytes, bitOffset, width, lut);
+                referenceExpandMono(expected + GUARD + dstOffset, sourceBytes, bitOffset, width, foreground, background);
+                checkOutputs("expandMonoRow", width, dstOffset, bitOffset);
+            }
+        }
+    }
+}
+
+static void testExpandPaletteRow() {
+    for (int i = 0; i < NUM_TEST_WIDTHS; i++) {
+        int32_t width = testWidth(i);
+
+        // Colours past colorCount must come out as 0
+        int colorCount = 1 + nextRandom() % 16;
+        uint16_t palette[16];
+        uint16_t colors[16] = {};
+        for (int c = 0; c < colorCount; c++) {
+            palette[c] = (uint16_t)nextRandom();
+            colors[c] = palette[c];
+        }
+        PaletteExpandLut lut;
+        buildPaletteExpandLut(lut, palette, colorCount);
+
+        for (int dstOffset = 0; dstOffset < 4; dstOffset++) {
+            for (int srcOffset = 0; srcOffset < 4; srcOffset++) {
+                fillRandom(sourceBytes, sizeof(sourceBytes));
+                resetOutputs();
+                expandPaletteRow(actual + GUARD + dstOffset, sourceBytes + srcOffset, width, lut);
+                referenceExpandPalette(expected + GUARD + dstOffset, sourceBytes + srcOffset, width, colors);
+                checkOutputs("expandPaletteRow", width, dstOffset, srcOffset);
+            }
+        }
+    }
+}
+
+static void testFillSpan565() {
+    for (int i = 0; i < NUM_TEST_WIDTHS; i++) {
+        int32_t width = testWidth(i);
+        uint16_t color = (uint16_t)nextRandom();
+
+        for (int dstOffset = 0; dstOffset < 4; dstOffset++) {
+            resetOutputs();
+            fillSpan565(actual + GUARD + dstOffset, color, width);
+            referenceFill(expected + GUARD + dstOffset, color, width);
+            checkOutputs("fillSpan565", width, dstOffset, 0);
+        }
+    }
+}
+
+static void testSwapBytes565() {
+    for (int i = 0; i < NUM_TEST_WIDTHS; i++) {
+        int32_t width = testWidth(i);
+
+        for (int dstOffset = 0; dstOffset < 4; dstOffset++) {
+            for (int srcOffset = 0; srcOffset < 4; srcOffset++) {
+                fillRandom((uint8_t*)sourcePixels, sizeof(sourcePixels));
+                resetOutputs();
+                swapBytes565(actual + GUARD + dstOffset, sourcePixels + srcOffset, width);
+                referenceSwapBytes(expected + GUARD + dstOffset, sourcePixels + srcOffset, width);
+                checkOutputs("swapBytes565", width, dstOffset, srcOffset);
+            }
+        }
+    }
+}
+
+static void testSwapBytes565InPlace() {
+    for (int i = 0; i < NUM_TEST_WIDTHS; i++) {
+        int32_t width = testWidth(i);
+
+        for (int dstOffset = 0; dstOffset < 4; dstOffset++) {
+            fillRandom((uint8_t*)sourcePixels, sizeof(sourcePixels));
+            resetOutputs();
+            memcpy(actual + GUARD + dstOffset, sourcePixels, width * sizeof(uint16_t));
+            swapBytes565(actual + GUARD + dstOffset, actual + GUARD + dstOffset, width);
+            referenceSwapBytes(expected + GUARD + dstOffset, sourcePixels, width);
+            checkOutputs("swapBytes565 in place", width, dstOffset, 0);
+        }
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(testSwap565);
+    RUN_TEST(testExpandMonoRow);
+    RUN_TEST(testExpandPaletteRow);
+    RUN_TEST(testFillSpan565);
+    RUN_TEST(testSwapBytes565);
+    RUN_TEST(testSwapBytes565InPlace);
+    return UNITY_END();
+}
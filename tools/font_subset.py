@@ -0,0 +1,196 @@
+"""Generates subsetted GFXfont headers from the bundled DejaVu TTF.
+
+Each use site gets a header with only the characters it can ever draw, so the
+firmware does not link glyphs that never reach the screen. After generating,
+a flash-size report compares every subset with the full header it replaces.
+
+Usage:
+    python tools/font_subset.py        # or: pio run -t fonts
+
+Also loaded by platformio.ini as an extra script, where it registers the
+"fonts" custom target instead of running.
+"""
+
+import os
+import re
+
+# PlatformIO runs extra scripts from the project folder without __file__
+if '__file__' in globals():
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+else:
+    ROOT = os.getcwd()
+TTF_PATH = os.path.join(ROOT, 'dejavu-sans', 'dejavu-sans.bold.ttf')
+
+# Point sizes are converted at 141 DPI, which reproduces the metrics of the
+# original DejaVuSans_Bold*pt7b.h headers
+DPI = 141
+
+# sizeof(GFXglyph)/sizeof(RleGlyph) and sizeof(GFXfont)/sizeof(RleFont) on the ESP32
+GLYPH_STRUCT_BYTES = 8
+FONT_STRUCT_BYTES = 16
+
+PRINTABLE_ASCII = ''.join(chr(c) for c in range(0x20, 0x7F))
+
+# (header, font name, point size, characters, format, use site, full header it replaces)
+# Format is 'gfx' for a GFXfont or 'rle' for an RleFont (see src/rle_font.h).
+SUBSETS = [
+    ('DejaVuSans_Bold36ptRanks.h', 'DejaVuSans_Bold36ptRanks', 36, 'A0123456789JQK', 'rle',
+     'card ranks in drawCardSymbol()', 'DejaVuSans_Bold36pt7b.h'),
+    ('DejaVuSans_Bold36ptAscii.h', 'DejaVuSans_Bold36ptAscii', 36, PRINTABLE_ASCII, 'gfx',
+     'message font ladder', None),
+    ('DejaVuSans_Bold28ptAscii.h', 'DejaVuSans_Bold28ptAscii', 28, PRINTABLE_ASCII, 'gfx',
+     'message font ladder', None),
+]
+
+
+def pack_bits(glyph):
+    """GFX bitmap: one bit per pixel, MSB first, rows packed back to back."""
+    bits = [1 if a else 0 for a in glyph.alpha]
+    bits += [0] * (-len(bits) % 8)
+    data = []
+    for i in range(0, len(bits), 8):
+        byte = 0
+        for bit in bits[i:i + 8]:
+            byte = (byte << 1) | bit
+        data.append(byte)
+    return data
+
+
+def encode_runs(glyph):
+    """RLE bitmap: bit 7 ink, bits 0-6 length - 1, runs continue across rows."""
+    data = []
+    pixels = [1 if a else 0 for a in glyph.alpha]
+    i = 0
+    while i < len(pixels):
+        value = pixels[i]
+        end = i
+        while end < len(pixels) and pixels[end] == value:
+            end += 1
+        length = end - i
+        while length > 0:
+            run = min(length, 128)
+            data.append((0x80 if value else 0x00) | (run - 1))
+            length -= run
+        i = end
+    return data
+
+
+def build_subset(ttf, name, point_size, chars, fmt):
+    """Returns (header text, bitmap bytes, glyph count, 1bpp bitmap bytes)."""
+    pixel_size = point_size * DPI / 72.0
+    codepoints = sorted(set(ord(c) for c in chars))
+    first, last = codepoints[0], codepoints[-1]
+    encode = encode_runs if fmt == 'rle' else pack_bits
+
+    bitmap = []
+    mono_bytes = 0
+    glyph_lines = []
+    bitmap_lines = []
+    for code in range(first, last + 1):
+        # Glyphs are indexed by code - first, so gaps get empty entries
+        if code not in codepoints:
+            glyph_lines.append('  { %5d,   0,   0,   0,    0,    0 }, // 0x%02X unused' % (len(bitmap), code))
+            continue
+
+        glyph = ttf.render(code, pixel_size).mono()
+        offset = len(bitmap)
+        data = encode(glyph)
+        bitmap.extend(data)
+        mono_bytes += len(pack_bits(glyph))
+
+        for i in range(0, len(data), 16):
+            line = ', '.join('0x%02X' % b for b in data[i:i + 16])
+            if i + 16 >= len(data):
+                line += ', // \'%s\'' % chr(code)
+            else:
+                line += ','
+            bitmap_lines.append('  ' + line)
+        glyph_lines.append('  { %5d, %3d, %3d, %3d, %4d, %4d }, // \'%s\'' % (
+            offset, glyph.width, glyph.height, glyph.advance, glyph.left, -glyph.top, chr(code)))
+
+    y_advance = ttf.line_height(pixel_size)
+    if fmt == 'rle':
+        preamble = ['#include "rle_font.h"', '']
+        bitmap_array = '%sRuns' % name
+        glyph_type, font_type = 'RleGlyph', 'RleFont'
+        font_fields = ['  %s,' % bitmap_array, '  %sGlyphs,' % name]
+    else:
+        preamble = []
+        bitmap_array = '%sBitmaps' % name
+        glyph_type, font_type = 'GFXglyph', 'GFXfont'
+        font_fields = ['  (uint8_t  *)%s,' % bitmap_array, '  (GFXglyph *)%sGlyphs,' % name]
+
+    text = '\n'.join([
+        '// Generated by tools/font_subset.py from dejavu-sans.bold.ttf - do not edit',
+        '// Characters: %s' % ''.join(chr(c) for c in codepoints),
+        '',
+    ] + preamble + [
+        'const uint8_t %s[] PROGMEM = {' % bitmap_array,
+    ] + bitmap_lines + [
+        '};',
+        '',
+        'const %s %sGlyphs[] PROGMEM = {' % (glyph_type, name),
+    ] + glyph_lines + [
+        '};',
+        '',
+        'const %s %s PROGMEM = {' % (font_type, name),
+    ] + font_fields + [
+        '  0x%02X, 0x%02X, %d' % (first, last, y_advance),
+        '};',
+        '',
+    ])
+    return text, len(bitmap), last - first + 1, mono_bytes
+
+
+def header_size(path):
+    """Bitmap bytes and glyph count of an existing GFXfont header."""
+    with open(path) as f:
+        text = f.read()
+    bitmaps = re.search(r'(?:Bitmaps|Runs)\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S).group(1)
+    glyphs = re.search(r'Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S).group(1)
+    bitmaps = re.sub(r'//[^\n]*', '', bitmaps)
+    glyphs = re.sub(r'//[^\n]*', '', glyphs)
+    return len(re.findall(r'0x[0-9A-Fa-f]{2}', bitmaps)), glyphs.count('{')
+
+
+def flash_bytes(bitmap_bytes, glyph_count):
+    return bitmap_bytes + glyph_count * GLYPH_STRUCT_BYTES + FONT_STRUCT_BYTES
+
+
+def main():
+    from fontkit import TrueTypeFont
+
+    ttf = TrueTypeFont(TTF_PATH)
+    total_before = 0
+    total_after = 0
+
+    print('Font subsets (flash bytes):')
+    for header, name, point_size, chars, fmt, use_site, replaces in SUBSETS:
+        text, bitmap_bytes, glyph_count, mono_bytes = build_subset(ttf, name, point_size, chars, fmt)
+        with open(os.path.join(ROOT, 'include', header), 'w') as f:
+            f.write(text)
+
+        after = flash_bytes(bitmap_bytes, glyph_count)
+        before = flash_bytes(*header_size(os.path.join(ROOT, 'include', replaces))) if replaces else 0
+        total_before += before
+        total_after += after
+        print('  %-28s %7d -> %6d  (%s, %s)' % (
+            header, before, after, use_site, 'was %s' % replaces if replaces else 'new'))
+        if fmt == 'rle':
+            print('  %-28s %7s    %6d  (same subset as a 1bpp GFXfont)' % ('', '', flash_bytes(mono_bytes, glyph_count)))
+
+    print('  %-28s %7d -> %6d  (%+d)' % ('total', total_before, total_after, total_after - total_before))
+
+
+try:
+    Import('env')  # noqa: F821 - provided by PlatformIO
+    env.AddCustomTarget(  # noqa: F821
+        name='fonts',
+        dependencies=None,
+        actions=['$PYTHONEXE tools/font_subset.py', '$PYTHONEXE tools/make_vlw.py',
+                 '$PYTHONEXE tools/make_host_fonts.py'],
+        title='Generate fonts',
+        description='Regenerate subsetted GFX font headers, LittleFS .vlw fonts and host stand-in fonts')
+except NameError:
+    if __name__ == '__main__':
+        main()
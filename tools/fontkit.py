@@ -0,0 +1,343 @@
+"""Minimal TrueType reader and anti-aliased rasterizer.
+
+Only what the font tools in this folder need: cmap format 4, hmtx, simple and
+composite glyf outlines, and a scanline coverage rasterizer. It has no
+dependencies beyond the Python standard library so it runs inside the
+PlatformIO Python environment as is.
+"""
+
+import math
+import struct
+
+# Vertical samples per pixel row when computing coverage
+SUBSAMPLES = 16
+
+
+class Glyph:
+    """A rasterized glyph. alpha holds width*height coverage values 0-255."""
+
+    def __init__(self, codepoint, width, height, left, top, advance, alpha):
+        self.codepoint = codepoint
+        self.width = width
+        self.height = height
+        self.left = left          # x offset from the cursor to the first column
+        self.top = top            # rows from the top row down to the baseline
+        self.advance = advance    # cursor advance in pixels
+        self.alpha = alpha
+
+    def mono_rows(self, threshold=128):
+        """Yields each row as a list of 0/1 pixels."""
+        for y in range(self.height):
+            row = self.alpha[y * self.width:(y + 1) * self.width]
+            yield [1 if a >= threshold else 0 for a in row]
+
+    def mono(self, threshold=128):
+        """Returns a 1-bit copy (alpha 0 or 255) cropped to the inked pixels."""
+        alpha = [255 if a >= threshold else 0 for a in self.alpha]
+        return _trim(Glyph(self.codepoint, self.width, self.height, self.left, self.top, self.advance, alpha))
+
+
+class TrueTypeFont:
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        self.tables = {}
+        num_tables = struct.unpack_from('>H', self.data, 4)[0]
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from('>4sIII', self.data, 12 + 16 * i)
+            self.tables[tag.decode('latin-1')] = (offset, length)
+
+        head = self.tables['head'][0]
+        self.units_per_em = struct.unpack_from('>H', self.data, head + 18)[0]
+        self.loca_long = struct.unpack_from('>h', self.data, head + 50)[0] == 1
+
+        self.num_glyphs = struct.unpack_from('>H', self.data, self.tables['maxp'][0] + 4)[0]
+
+        hhea = self.tables['hhea'][0]
+        self.ascender, self.descender, self.line_gap = struct.unpack_from('>hhh', self.data, hhea + 4)
+        self.num_hmetrics = struct.unpack_from('>H', self.data, hhea + 34)[0]
+
+        self._read_cmap()
+
+    # ------------------------------------------------------------------
+    # Tables
+    # ------------------------------------------------------------------
+    def _read_cmap(self):
+        cmap = self.tables['cmap'][0]
+        count = struct.unpack_from('>H', self.data, cmap + 2)[0]
+        subtable = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from('>HHI', self.data, cmap + 4 + 8 * i)
+            if (platform, encoding) in ((3, 1), (0, 3), (0, 4)):
+                if struct.unpack_from('>H', self.data, cmap + offset)[0] == 4:
+                    subtable = cmap + offset
+                    break
+        if subtable is None:
+            raise ValueError('font has no cmap format 4 subtable')
+
+        seg_count = struct.unpack_from('>H', self.data, subtable + 6)[0] // 2
+        ends = subtable + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        range_offsets = deltas + 2 * seg_count
+
+        self.cmap = {}
+        for seg in range(seg_count):
+            end = struct.unpack_from('>H', self.data, ends + 2 * seg)[0]
+            start = struct.unpack_from('>H', self.data, starts + 2 * seg)[0]
+            delta = struct.unpack_from('>h', self.data, deltas + 2 * seg)[0]
+            range_address = range_offsets + 2 * seg
+            range_offset = struct.unpack_from('>H', self.data, range_address)[0]
+            for code in range(start, min(end, 0xFFFE) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    address = range_address + range_offset + 2 * (code - start)
+                    glyph = struct.unpack_from('>H', self.data, address)[0]
+                    if glyph:
+                        glyph = (glyph + delta) & 0xFFFF
+                if glyph:
+                    self.cmap[code] = glyph
+
+    def advance_width(self, glyph_index):
+        hmtx = self.tables['hmtx'][0]
+        index = min(glyph_index, self.num_hmetrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + 4 * index)[0]
+
+    def _glyph_offset(self, glyph_index):
+        loca = self.tables['loca'][0]
+        if self.loca_long:
+            start, end = struct.unpack_from('>II', self.data, loca + 4 * glyph_index)
+        else:
+            start, end = struct.unpack_from('>HH', self.data, loca + 2 * glyph_index)
+            start, end = start * 2, end * 2
+        if start == end:
+            return None
+        return self.tables['glyf'][0] + start
+
+    # ------------------------------------------------------------------
+    # Outlines
+    # ------------------------------------------------------------------
+    def outline(self, glyph_index):
+        """Returns contours as lists of (x, y, on_curve) in font units."""
+        offset = self._glyph_offset(glyph_index)
+        if offset is None:
+            return []
+        contour_count = struct.unpack_from('>h', self.data, offset)[0]
+        if contour_count >= 0:
+            return self._simple_outline(offset, contour_count)
+        return self._composite_outline(offset)
+
+    def _simple_outline(self, offset, contour_count):
+        pos = offset + 10
+        end_points = struct.unpack_from('>%dH' % contour_count, self.data, pos)
+        pos += 2 * contour_count
+        instruction_length = struct.unpack_from('>H', self.data, pos)[0]
+        pos += 2 + instruction_length
+
+        point_count = end_points[-1] + 1 if end_points else 0
+        flags = []
+        while len(flags) < point_count:
+            flag = self.data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 0x08:
+                repeat = self.data[pos]
+                pos += 1
+                flags.extend([flag] * repeat)
+
+        def read_coords(short_bit, same_bit):
+            nonlocal pos
+            coords = []
+            value = 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from('>h', self.data, pos)[0]
+                    pos += 2
+                coords.append(value)
+            return coords
+
+        xs = read_coords(0x02, 0x10)
+        ys = read_coords(0x04, 0x20)
+
+        contours = []
+        start = 0
+        for end in end_points:
+            contours.append([(xs[i], ys[i], bool(flags[i] & 0x01)) for i in range(start, end + 1)])
+            start = end + 1
+        return contours
+
+    def _composite_outline(self, offset):
+        pos = offset + 10
+        contours = []
+        while True:
+            flags, glyph_index = struct.unpack_from('>HH', self.data, pos)
+            pos += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from('>hh', self.data, pos)
+                pos += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, pos)
+                pos += 2
+            if not flags & 0x0002:
+                dx, dy = 0, 0  # point matching is not supported
+
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = d = struct.unpack_from('>h', self.data, pos)[0] / 16384.0
+                pos += 2
+            elif flags & 0x0040:
+                a, d = (v / 16384.0 for v in struct.unpack_from('>hh', self.data, pos))
+                pos += 4
+            elif flags & 0x0080:
+                a, b, c, d = (v / 16384.0 for v in struct.unpack_from('>hhhh', self.data, pos))
+                pos += 8
+
+            for contour in self.outline(glyph_index):
+                contours.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+
+            if not flags & 0x0020:
+                break
+        return contours
+
+    # ------------------------------------------------------------------
+    # Rasterization
+    # ------------------------------------------------------------------
+    def pixel_scale(self, pixel_size):
+        return pixel_size / self.units_per_em
+
+    def line_height(self, pixel_size):
+        scale = self.pixel_scale(pixel_size)
+        return int(math.ceil((self.ascender - self.descender + self.line_gap) * scale))
+
+    def render(self, codepoint, pixel_size):
+        """Rasterizes one character. Returns None if the font lacks it."""
+        glyph_index = self.cmap.get(codepoint)
+        if glyph_index is None:
+            return None
+        scale = self.pixel_scale(pixel_size)
+        advance = int(round(self.advance_width(glyph_index) * scale))
+
+        edges = []
+        for contour in self.outline(glyph_index):
+            points = _flatten(contour)
+            for i in range(len(points)):
+                x0, y0 = points[i - 1]
+                x1, y1 = points[i]
+                # Font units are y-up; pixels are y-down with the baseline at 0
+                edges.append((x0 * scale, -y0 * scale, x1 * scale, -y1 * scale))
+
+        if not edges:
+            return Glyph(codepoint, 0, 0, 0, 0, advance, [])
+
+        left = int(math.floor(min(min(e[0], e[2]) for e in edges)))
+        right = int(math.ceil(max(max(e[0], e[2]) for e in edges)))
+        top = int(math.floor(min(min(e[1], e[3]) for e in edges)))
+        bottom = int(math.ceil(max(max(e[1], e[3]) for e in edges)))
+        width, height = right - left, bottom - top
+
+        coverage = _rasterize(edges, left, top, width, height)
+        alpha = [min(255, int(c * 255 + 0.5)) for c in coverage]
+        return _trim(Glyph(codepoint, width, height, left, -top, advance, alpha))
+
+
+def _flatten(contour, steps=8):
+    """Turns a quadratic TrueType contour into a closed polyline."""
+    if not contour:
+        return []
+    # Start from an on-curve point, inserting an implied one if there is none
+    start = next((i for i, p in enumerate(contour) if p[2]), None)
+    if start is None:
+        p0, p1 = contour[0], contour[1]
+        contour = [((p0[0] + p1[0]) / 2.0, (p0[1] + p1[1]) / 2.0, True)] + contour
+        start = 0
+    points = contour[start:] + contour[:start]
+
+    result = [(points[0][0], points[0][1])]
+    current = (points[0][0], points[0][1])
+    control = None
+    for x, y, on in points[1:] + [points[0]]:
+        if on:
+            if control is None:
+                result.append((x, y))
+            else:
+                result.extend(_quad(current, control, (x, y), steps))
+                control = None
+            current = (x, y)
+        else:
+            if control is not None:
+                mid = ((control[0] + x) / 2.0, (control[1] + y) / 2.0)
+                result.extend(_quad(current, control, mid, steps))
+                current = mid
+            control = (x, y)
+    return result
+
+
+def _quad(p0, p1, p2, steps):
+    out = []
+    for i in range(1, steps + 1):
+        t = i / float(steps)
+        u = 1.0 - t
+        out.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return out
+
+
+def _rasterize(edges, left, top, width, height):
+    """Non-zero winding coverage with exact horizontal span coverage."""
+    coverage = [0.0] * (width * height)
+    weight = 1.0 / SUBSAMPLES
+    for row in range(height):
+        base = row * width
+        for sub in range(SUBSAMPLES):
+            y = top + row + (sub + 0.5) / SUBSAMPLES
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            if not crossings:
+                continue
+            crossings.sort()
+            winding = 0
+            for i in range(len(crossings) - 1):
+                winding += crossings[i][1]
+                if winding == 0:
+                    continue
+                _add_span(coverage, base, width, crossings[i][0] - left, crossings[i + 1][0] - left, weight)
+    return coverage
+
+
+def _add_span(coverage, base, width, xa, xb, weight):
+    xa = max(0.0, xa)
+    xb = min(float(width), xb)
+    if xb <= xa:
+        return
+    first = int(xa)
+    last = int(xb)
+    if first == last:
+        coverage[base + first] += (xb - xa) * weight
+        return
+    coverage[base + first] += (first + 1 - xa) * weight
+    for x in range(first + 1, min(last, width)):
+        coverage[base + x] += weight
+    if last < width:
+        coverage[base + last] += (xb - last) * weight
+
+
+def _trim(glyph):
+    """Crops fully transparent rows and columns from the glyph edges."""
+    w, h, a = glyph.width, glyph.height, glyph.alpha
+    rows = [y for y in range(h) if any(a[y * w:(y + 1) * w])]
+    cols = [x for x in range(w) if any(a[y * w + x] for y in range(h))]
+    if not rows or not cols:
+        return Glyph(glyph.codepoint, 0, 0, 0, 0, glyph.advance, [])
+    y0, y1, x0, x1 = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    alpha = []
+    for y in range(y0, y1):
+        alpha.extend(a[y * w + x0:y * w + x1])
+    return Glyph(glyph.codepoint, x1 - x0, y1 - y0, glyph.left + x0, glyph.top - y0, glyph.advance, alpha)
@@ -0,0 +1,124 @@
+"""Generates stand-ins for TFT_eSPI's fonts from the bundled DejaVu TTFs.
+
+The golden render test (test/test_golden_renders) builds the host renderer
+against these instead of the fonts in the TFT_eSPI library folder, so its
+reference images only change when this project's drawing code or fonts do,
+not when the library is updated. They go in host/fonts under the same names
+and paths as TFT_eSPI's:
+
+    Fonts/GFXFF/gfxfont.h         GFXglyph and GFXfont
+    Fonts/GFXFF/FreeSans*pt7b.h   one per FONT_SANS_* in src/globals.h
+    Fonts/glcdfont.c              the 5x8 GLCD font used by setTextFont(1)
+
+Usage:
+    python tools/make_host_fonts.py        # or: pio run -t fonts
+"""
+
+import os
+
+from fontkit import TrueTypeFont
+from font_subset import PRINTABLE_ASCII, ROOT, build_subset
+
+OUT_DIR = os.path.join(ROOT, 'host', 'fonts', 'Fonts')
+REGULAR_TTF = os.path.join(ROOT, 'dejavu-sans', 'ttf', 'DejaVuSans.ttf')
+BOLD_TTF = os.path.join(ROOT, 'dejavu-sans', 'ttf', 'DejaVuSans-Bold.ttf')
+
+# DejaVu is bigger than FreeSans at the same point size. At 0.8 of it the
+# cap heights and string widths come out close, so layouts made for FreeSans
+# fit the same way.
+POINT_SCALE = 0.8
+POINT_SIZES = [9, 12, 18, 24]
+
+GLCD_PIXEL_SIZE = 9
+GLCD_COLUMNS = 5
+GLCD_BASELINE = 7
+
+GFXFONT_H = '''\
+// Generated by tools/make_host_fonts.py - do not edit
+// The GFXfont structures as TFT_eSPI declares them.
+#ifndef _GFXFONT_H_
+#define _GFXFONT_H_
+
+#ifdef LOAD_GFXFF
+
+typedef struct {
+  uint32_t bitmapOffset;
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  xAdvance;
+  int8_t   xOffset;
+  int8_t   yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t  *bitmap;
+  GFXglyph *glyph;
+  uint16_t  first;
+  uint16_t  last;
+  uint8_t   yAdvance;
+} GFXfont;
+
+#endif // LOAD_GFXFF
+
+#endif // _GFXFONT_H_
+'''
+
+
+def write(path, text):
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'w') as f:
+        f.write(text)
+    print('%s: %d bytes' % (os.path.relpath(path, ROOT), len(text)))
+
+
+def glcd_columns(ttf, code):
+    """Five column bytes, bit 0 at the top, as the GLCD font stores a character."""
+    columns = [0] * GLCD_COLUMNS
+    if not 0x20 <= code < 0x7F:
+        return columns
+    glyph = ttf.render(code, GLCD_PIXEL_SIZE)
+    if glyph is None or glyph.width == 0:
+        return columns
+    glyph = glyph.mono()
+    for y in range(glyph.height):
+        row = GLCD_BASELINE - glyph.top + y
+        if not 0 <= row < 8:
+            continue
+        for x in range(min(glyph.width, GLCD_COLUMNS)):
+            if glyph.alpha[y * glyph.width + x]:
+                columns[x] |= 1 << row
+    return columns
+
+
+def main():
+    write(os.path.join(OUT_DIR, 'GFXFF', 'gfxfont.h'), GFXFONT_H)
+
+    for ttf_path, style in ((REGULAR_TTF, ''), (BOLD_TTF, 'Bold')):
+        ttf = TrueTypeFont(ttf_path)
+        for point_size in POINT_SIZES:
+            name = 'FreeSans%s%dpt7b' % (style, point_size)
+            text = build_subset(ttf, name, point_size * POINT_SCALE, PRINTABLE_ASCII, 'gfx')[0]
+            text = text.replace('by tools/font_subset.py from dejavu-sans.bold.ttf',
+                                'by tools/make_host_fonts.py from %s' % os.path.basename(ttf_path), 1)
+            write(os.path.join(OUT_DIR, 'GFXFF', name + '.h'), text)
+
+    ttf = TrueTypeFont(REGULAR_TTF)
+    rows = []
+    for code in range(256):
+        rows.append('  ' + ', '.join('0x%02X' % b for b in glcd_columns(ttf, code)) + ',')
+    write(os.path.join(OUT_DIR, 'glcdfont.c'), '\n'.join([
+        '// Generated by tools/make_host_fonts.py from DejaVuSans.ttf - do not edit',
+        '#ifndef FONT5X7_H',
+        '#define FONT5X7_H',
+        '',
+        'static const unsigned char font[] PROGMEM = {',
+    ] + rows + [
+        '};',
+        '',
+        '#endif // FONT5X7_H',
+        '',
+    ]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,70 @@
+"""Generates anti-aliased .vlw fonts for the LittleFS data folder.
+
+The .vlw layout is the one TFT_eSPI's smooth font code and the Processing
+"Create Font" tool use: a 24 byte header, 28 bytes of metrics per glyph, then
+one 8-bit alpha byte per pixel for every glyph in the same order. All values
+are big-endian int32.
+
+Usage:
+    python tools/make_vlw.py                      # regenerate data/fonts
+    python tools/make_vlw.py --size 30 --out x.vlw
+"""
+
+import argparse
+import os
+import struct
+
+from fontkit import TrueTypeFont
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_TTF = os.path.join(ROOT, 'dejavu-sans', 'dejavu-sans.bold.ttf')
+DATA_DIR = os.path.join(ROOT, 'data', 'fonts')
+
+# Message font ladder, largest first. Must match SMOOTH_FONT_FILES in
+# src/smooth_font.cpp.
+MESSAGE_FONT_SIZES = [24, 20, 16]
+
+PRINTABLE_ASCII = list(range(0x20, 0x7F))
+
+
+def write_vlw(ttf, pixel_size, codepoints, path):
+    glyphs = [g for g in (ttf.render(c, pixel_size) for c in codepoints) if g is not None]
+    glyphs.sort(key=lambda g: g.codepoint)
+
+    # Header ascent/descent are the extents of 'd' and 'p', as Processing writes them
+    ascent = next((g.top for g in glyphs if g.codepoint == ord('d')), pixel_size)
+    descent = next((g.height - g.top for g in glyphs if g.codepoint == ord('p')), 0)
+
+    out = bytearray()
+    out += struct.pack('>6i', len(glyphs), 11, pixel_size, 0, ascent, descent)
+    for g in glyphs:
+        out += struct.pack('>7i', g.codepoint, g.height, g.width, g.advance, g.top, g.left, 0)
+    for g in glyphs:
+        out += bytes(g.alpha)
+
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, 'wb') as f:
+        f.write(out)
+    return len(glyphs), len(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--ttf', default=DEFAULT_TTF)
+    parser.add_argument('--size', type=int, help='pixel size of a single font to generate')
+    parser.add_argument('--out', help='output path for --size')
+    args = parser.parse_args()
+
+    ttf = TrueTypeFont(args.ttf)
+    if args.size:
+        jobs = [(args.size, args.out or 'font%d.vlw' % args.size)]
+    else:
+        jobs = [(size, os.path.join(DATA_DIR, 'DejaVuSansBold%d.vlw' % size)) for size in MESSAGE_FONT_SIZES]
+
+    for size, path in jobs:
+        count, length = write_vlw(ttf, size, PRINTABLE_ASCII, path)
+        print('%s: %d glyphs, %d bytes' % (os.path.relpath(path, ROOT), count, length))
+
+
+if __name__ == '__main__':
+    main()